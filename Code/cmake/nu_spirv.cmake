@@ -0,0 +1,50 @@
+# @file     nu_spirv.cmake
+# @author   Erik ZORZIN
+# @date     19OCT2026
+# @brief    Ahead-of-time compilation of OpenCL kernel sources to SPIR-V.
+#
+# @details  Provides the "nu_add_spirv" function: it adds a build target compiling a list of
+# OpenCL kernel source files into a single SPIR-V module, by means of clang and llvm-spirv. The
+# module is written in the output directory with the name of the last source file (the one
+# holding the kernel entry points) and the ".spv" extension, where the Neutrino "kernel" and
+# "library" classes look for it at run time. The other source files (e.g. common utilities) are
+# included before it, as the OpenCL runtime would do with multiple sources.
+#
+# Usage: nu_add_spirv(my_kernels ${KERNEL_HOME} ${KERNEL_HOME}/utilities.cl ${KERNEL_HOME}/my_kernel.cl)
+
+message("Checking whether clang and llvm-spirv are installed...")                                   # Printing message...
+find_program(NU_CLANG NAMES clang)                                                                  # Finding clang...
+find_program(NU_LLVM_SPIRV NAMES llvm-spirv)                                                        # Finding SPIR-V LLVM translator...
+set(NU_SPIRV_STD "CL1.2" CACHE STRING "OpenCL C standard of the kernel sources")                    # Setting OpenCL C standard...
+
+function(nu_add_spirv NU_TARGET NU_OUTPUT_DIRECTORY)                                                # Defining SPIR-V compilation function...
+  if(NOT NU_CLANG OR NOT NU_LLVM_SPIRV)                                                             # Detecting compilers...
+    message("clang and llvm-spirv need to be installed to compile ${NU_TARGET} to SPIR-V!")           # Printing message...
+    return()
+  endif()
+
+  set(NU_SOURCES ${ARGN})                                                                           # Getting kernel source files...
+  list(GET NU_SOURCES -1 NU_ENTRY)                                                                  # Getting entry source file...
+  list(REMOVE_AT NU_SOURCES -1)                                                                     # Getting included source files...
+  get_filename_component(NU_NAME ${NU_ENTRY} NAME_WE)                                               # Getting module name...
+  get_filename_component(NU_HOME ${NU_ENTRY} DIRECTORY)                                             # Getting kernel home directory...
+  set(NU_BITCODE ${CMAKE_CURRENT_BINARY_DIR}/${NU_NAME}.bc)                                         # Setting LLVM bitcode file...
+  set(NU_MODULE ${NU_OUTPUT_DIRECTORY}/${NU_NAME}.spv)                                              # Setting SPIR-V module file...
+  set(NU_INCLUDES "")                                                                               # Resetting included sources...
+
+  foreach(NU_SOURCE ${NU_SOURCES})                                                                  # Scanning included sources...
+    list(APPEND NU_INCLUDES -include ${NU_SOURCE})                                                  # Adding included source...
+  endforeach()
+
+  add_custom_command(                                                                               # Compiling kernel sources...
+    OUTPUT ${NU_MODULE}                                                                             # SPIR-V module.
+    COMMAND ${NU_CLANG} -c -target spir64 -cl-std=${NU_SPIRV_STD} -emit-llvm                        # OpenCL C front-end.
+            -Xclang -finclude-default-header -I${NU_HOME} ${NU_INCLUDES}                            # Kernel home and included sources.
+            ${NU_ENTRY} -o ${NU_BITCODE}                                                            # Entry source and LLVM bitcode.
+    COMMAND ${NU_LLVM_SPIRV} ${NU_BITCODE} -o ${NU_MODULE}                                          # LLVM bitcode to SPIR-V.
+    DEPENDS ${ARGN}                                                                                 # Kernel source files.
+    COMMENT "Compiling ${NU_NAME} to SPIR-V..."                                                     # Comment...
+    VERBATIM)                                                                                       # Escaping all commands properly for the build tool...
+
+  add_custom_target(${NU_TARGET} ALL DEPENDS ${NU_MODULE})                                          # Adding SPIR-V build target...
+endfunction()
@@ -0,0 +1,203 @@
+/// @file     cluster.hpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Declaration of the "cluster" class.
+///
+/// @details  A Neutrino "cluster" runs the same kernel on all the OpenCL devices of a given type
+/// found on all the OpenCL platforms of the host (e.g. an integrated GPU together with a CPU
+/// runtime, or the GPUs of two vendors), each one in its own OpenCL context, beside the single
+/// context of the @link opencl @endlink class. It is meant for independent work units (e.g. mesh
+/// partitions or ensemble members): at each execution the units are handed out in batches, which
+/// the devices take dynamically as soon as they are free, the batch size of each device being
+/// proportional to its throughput observed in the previous executions. As contexts of different
+/// platforms cannot share memory, the data of each batch are explicitly staged through the host:
+/// the kernel arguments are host arrays, written to the device before the batch and read back
+/// after it.
+
+#ifndef cluster_hpp
+#define cluster_hpp
+
+#include "neutrino.hpp"
+
+/// @brief    **Data structure. Internally used by Neutrino.**
+/// @details  This structure stores a device of a cluster, with its own OpenCL context.
+typedef struct _node_structure
+{
+  cl_platform_id      platform;                                                                     ///< Platform ID.
+  cl_device_id        device;                                                                       ///< Device ID.
+  cl_context          context;                                                                      ///< Device context.
+  cl_command_queue    queue;                                                                        ///< Device queue.
+  cl_program          program;                                                                      ///< Device program.
+  cl_kernel           kernel_id;                                                                    ///< Device kernel.
+  std::vector<cl_mem> buffer;                                                                       ///< Device buffers (one per argument).
+  std::vector<size_t> capacity;                                                                     ///< Device buffer sizes [bytes].
+  std::string         name;                                                                         ///< Device name.
+  double              estimate;                                                                     ///< Device estimated throughput (compute units times clock frequency).
+  double              rate;                                                                         ///< Device measured throughput (0 = not yet measured) [units/s].
+  size_t              units;                                                                        ///< Units executed in the last execution [#].
+  double              time;                                                                         ///< Time spent in the last execution [s].
+  cl_int              error;                                                                        ///< Error code of the last execution (CL_SUCCESS = none).
+} node_structure;
+
+/// @brief    **Data structure. Internally used by Neutrino.**
+/// @details  This structure stores a host array used as kernel argument of a cluster.
+typedef struct _shard_structure
+{
+  char*  data;                                                                                      ///< Host array.
+  size_t unit_bytes;                                                                                ///< Size per work unit (0 = whole array) [bytes].
+  size_t bytes;                                                                                     ///< Size of the whole array (unit_bytes = 0) [bytes].
+  bool   output;                                                                                    ///< Output flag (read back after each batch).
+  std::vector<char> value;                                                                          ///< By-value argument (empty = host array).
+} shard_structure;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// "cluster" class ///////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class cluster
+/// ### Heterogeneous cluster of OpenCL devices.
+/// Declares a heterogeneous cluster of OpenCL devices, across platforms. To be used to share
+/// independent work units among all the devices of the host.
+class cluster                                                                                       /// @brief **Heterogeneous cluster of OpenCL devices.**
+{
+private:
+  neutrino*                    baseline;                                                            ///< @brief **Neutrino baseline.**
+  std::vector<node_structure>  node;                                                                ///< @brief **Cluster devices.**
+  std::vector<shard_structure> shard;                                                               ///< @brief **Kernel arguments (by argument index).**
+  std::atomic<size_t>          next_unit;                                                           ///< @brief **Next work unit to be executed [#].**
+
+  /// @brief **Node function.**
+  /// @details Executes batches of work units on a device until none is left: it is run by one
+  /// host thread per device. The whole arrays are written once, before the first batch. In case
+  /// of an OpenCL error, the device stops and its error code is stored in the node, to be
+  /// reported by the calling thread.
+  void run (
+            size_t loc_node,                                                                        ///< Node index.
+            size_t loc_units,                                                                       ///< Number of work units [#].
+            size_t loc_unit_size,                                                                   ///< Work-items per work unit [#].
+            size_t loc_batch                                                                        ///< Work units per batch [#].
+           );
+
+  /// @brief **Buffer function.**
+  /// @details Makes sure a device buffer of an argument is at least "loc_bytes" large,
+  /// reallocating it if needed, and sets it as kernel argument. It returns the OpenCL error code.
+  cl_int reserve (
+                node_structure& loc_node,                                                           ///< Node.
+                cl_uint         loc_index,                                                          ///< Argument index.
+                size_t          loc_bytes                                                           ///< Buffer size [bytes].
+               );
+
+public:
+  std::string                        compiler_options;                                              ///< @brief **OpenCL JIT complier options string [std::string].**
+  std::map<std::string, std::string> constant;                                                      ///< @brief **Specialization constant map (macro name, macro value).**
+
+  /// @brief **Class constructor.**
+  /// @details It resets the Neutrino baseline.
+  cluster ();
+
+  /// @brief **Compiler option function.**
+  /// @details Appends an option to the OpenCL JIT compiler options, as for a @link kernel
+  /// @endlink. To be called before the @link cluster::init @endlink method.
+  void option (
+               std::string loc_option                                                               ///< Compiler option.
+              );
+
+  /// @brief **Specialization constant function.**
+  /// @details Defines a specialization constant, injected in the kernel program of each device
+  /// as a "-D" macro, as for a @link kernel @endlink. To be called before the @link cluster::init
+  /// @endlink method.
+  void define (
+               std::string loc_name,                                                                ///< Macro name.
+               std::string loc_value                                                                ///< Macro value (verbatim).
+              );
+
+  /// @overload define(std::string loc_name, T loc_value)
+  /// @details Defines a numeric specialization constant, printed as an OpenCL C literal of the
+  /// same type (see @link neutrino::literal @endlink).
+  template <typename T, typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+  void define (
+               std::string loc_name,                                                                ///< Macro name.
+               T           loc_value                                                                ///< Macro value.
+              )
+  {
+    define (loc_name, neutrino::literal (loc_value));                                               // Setting specialization constant...
+  }
+
+  /// @brief **Class initializer.**
+  /// @details Scans all the OpenCL platforms for devices of the given type and, for each one,
+  /// creates a context, a queue and the kernel built from the given source files, with the same
+  /// compiler options, specialization constants and binary cache of a @link kernel @endlink (see
+  /// @link neutrino::build_program @endlink); the kernel home directory is also added to the
+  /// include path. Devices which cannot host a context or fail to build the kernel are skipped,
+  /// with a warning. Until all devices have been measured, their throughput is estimated from
+  /// their compute units times their clock frequency. The kernel arguments must be set after this
+  /// method.
+  void init (
+             neutrino*                loc_baseline,                                                 ///< Neutrino baseline.
+             compute_device_type      loc_device_type,                                              ///< Compute device type.
+             std::string              loc_kernel_home,                                              ///< Kernel home directory.
+             std::vector<std::string> loc_kernel_file_name,                                         ///< OpenCL kernel file names.
+             std::string              loc_kernel_name                                               ///< OpenCL kernel name.
+            );
+
+  /// @brief **Sharded argument function.**
+  /// @details Sets a host array, split in work units of "loc_unit_bytes" bytes each, as kernel
+  /// argument: each batch gets the contiguous units it executes, starting from the beginning of
+  /// the device buffer. The units are written to the device before each batch and, in case of an
+  /// output argument, read back into the host array after it.
+  void set_shard (
+                  cl_uint loc_index,                                                                ///< Argument index.
+                  void*   loc_data,                                                                 ///< Host array.
+                  size_t  loc_unit_bytes,                                                           ///< Size per work unit [bytes].
+                  bool    loc_output                                                                ///< Output flag.
+                 );
+
+  /// @brief **Shared argument function.**
+  /// @details Sets a read-only host array as kernel argument, whole on every device (e.g. common
+  /// parameters or tables). It is written to each device once per execution.
+  void set_shared (
+                   cl_uint loc_index,                                                               ///< Argument index.
+                   void*   loc_data,                                                                ///< Host array.
+                   size_t  loc_bytes                                                                ///< Host array size [bytes].
+                  );
+
+  /// @brief **Value argument function.**
+  /// @details Sets a by-value kernel argument (e.g. a scalar or a vector type) of "loc_bytes"
+  /// bytes, copied at once and set on every device before each execution.
+  void set_value (
+                  cl_uint loc_index,                                                                ///< Argument index.
+                  void*   loc_data,                                                                 ///< Argument value.
+                  size_t  loc_bytes                                                                 ///< Argument size [bytes].
+                 );
+
+  /// @brief **Cluster execution function.**
+  /// @details Executes the kernel on "loc_units" independent work units of "loc_unit_size"
+  /// work-items each (1D). Each device executes batches of contiguous units (global size = units
+  /// of the batch times loc_unit_size, so that the kernel sees the batch as a whole problem) on its
+  /// own host thread, taking the next batch as soon as it is free. At the end, the throughput of
+  /// each device (units per second, including the host-staged transfers) is updated with its
+  /// observed step time, smoothed by NU_SPREAD_WEIGHT, and it sizes its batches in the next
+  /// execution: each device gets about 1/NU_CLUSTER_ROUNDS of its share of the units per batch.
+  /// A device which got no units keeps its previous throughput or, if never measured, its
+  /// estimate scaled as the measured devices. The host waits for all the units to be complete;
+  /// in case a device failed, its OpenCL error is then reported and the application exits.
+  void execute (
+                size_t loc_units,                                                                   ///< Number of work units [#].
+                size_t loc_unit_size                                                                ///< Work-items per work unit [#].
+               );
+
+  /// @brief **Share function.**
+  /// @details Returns the fraction of the work units executed by a device in the last execution.
+  double get_share (
+                    size_t loc_node                                                                 ///< Node index.
+                   );
+
+  /// @brief **Size function.**
+  /// @details Returns the number of devices of the cluster.
+  size_t size ();
+
+  /// @brief **Class destructor.**
+  /// @details It releases the kernels, programs, buffers, queues and contexts of all devices.
+  ~cluster ();
+};
+
+#endif
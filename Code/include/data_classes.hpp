@@ -120,6 +120,65 @@ typedef struct _float4G_structure
 } float4G_structure;
 #pragma pack(pop)
 
+/// @brief    **Data structure. Internally used by Neutrino.**
+/// @details  This structure is used by the "dirty_range" class in order to store a range of
+/// data elements modified on the host PC since the last upload to the client GPU.
+typedef struct _range_structure
+{
+  size_t begin;                                                                                     ///< Range begin index (included).
+  size_t end;                                                                                       ///< Range end index (excluded).
+} range_structure;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// "dirty_range" class /////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class dirty_range
+/// ### Dirty range tracker.
+/// Declares a list of ranges of data elements which have been modified on the host PC since the
+/// last upload to the client GPU. Each data class has got one. The ranges are marked by the
+/// "at" and "mark" methods of the data classes and consumed by the @link queue::flush @endlink
+/// method, which coalesces them and uploads only the modified parts of the data.
+class dirty_range                                                                                   /// @brief **Dirty range tracker.**
+{
+private:
+
+public:
+  std::vector<range_structure> range;                                                               ///< @brief **Modified data ranges.**
+
+  /// @brief **Class constructor.**
+  /// @details It resets the range list.
+  dirty_range ();
+
+  /// @brief **Mark function.**
+  /// @details Marks the [begin, end) range of data elements as modified. Ranges overlapping or
+  /// adjacent to the last marked one are merged on the fly, so that marking elements in sequence
+  /// does not grow the list. In case the number of ranges exceeds NU_DIRTY_MAX_RANGES, the list
+  /// is coalesced and, if still too long, collapsed into a single enclosing range.
+  void mark (
+             size_t loc_begin,                                                                      ///< Range begin index (included).
+             size_t loc_end                                                                         ///< Range end index (excluded).
+            );
+
+  /// @brief **Coalesce function.**
+  /// @details Sorts the range list and merges all ranges whose distance is not bigger than the
+  /// given gap. This gives the minimum set of partial writes to be issued on an OpenCL queue.
+  void coalesce (
+                 size_t loc_gap                                                                     ///< Maximum merge gap [#].
+                );
+
+  /// @brief **Empty function.**
+  /// @details Returns true if no data element has been marked as modified.
+  bool empty ();
+
+  /// @brief **Clear function.**
+  /// @details Clears the range list. To be called after the data has been uploaded.
+  void clear ();
+
+  /// @brief **Class destructor.**
+  /// @details Does nothing.
+  ~dirty_range ();
+};
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////// "int1" class ////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -169,6 +228,11 @@ public:
   /// calls of the @link kernel::setarg @endlink method. It is internally managed by Neutrino.
   bool    ready;                                                                                    ///< @brief **Buffer "ready" flag.**
 
+  /// @details List of the data ranges modified on the host PC since the last upload to the client
+  /// GPU. It is filled by the @link at @endlink and @link mark @endlink methods and consumed by
+  /// the @link queue::flush @endlink method. It is internally managed by Neutrino.
+  dirty_range dirty;                                                                                ///< @brief **Dirty ranges.**
+
   /// @brief **Class constructor.**
   /// @details It resets the @link ready @endlink. The initialization of the class must occur
   /// after the initialization of the @link opencl @endlink and the @link opengl @endlink object,
@@ -193,6 +257,21 @@ public:
              std::string loc_file_name                                                              /// File name.
             );
 
+  /// @brief **Element accessor.**
+  /// @details Returns a reference to the data element at the given index and marks it as
+  /// modified, so that a subsequent @link queue::flush @endlink uploads it to the client GPU.
+  cl_long& at (
+               size_t loc_index                                                                     ///< Data index [#].
+              );
+
+  /// @brief **Mark function.**
+  /// @details Marks the [begin, end) range of data elements as modified. To be used after having
+  /// modified the @link data @endlink array directly.
+  void mark (
+             size_t loc_begin,                                                                      ///< Range begin index (included).
+             size_t loc_end                                                                         ///< Range end index (excluded).
+            );
+
   /// @brief **Class destructor.**
   /// @details It deallocates the host PC memory previously allocated by the
   /// @link int1::init @endlink as data storage.
@@ -249,6 +328,11 @@ public:
   /// calls of the @link kernel::setarg @endlink method. It is internally managed by Neutrino.
   bool    ready;                                                                                    ///< @brief **Buffer "ready" flag.**
 
+  /// @details List of the data ranges modified on the host PC since the last upload to the client
+  /// GPU. It is filled by the @link at @endlink and @link mark @endlink methods and consumed by
+  /// the @link queue::flush @endlink method. It is internally managed by Neutrino.
+  dirty_range     dirty;                                                                            ///< @brief **Dirty ranges.**
+
   /// @brief **Class constructor.**
   /// @details It resets the @link ready @endlink. The initialization of the class must occur
   /// after the initialization of the @link opencl @endlink and the @link opengl @endlink object,
@@ -262,6 +346,21 @@ public:
              size_t loc_size                                                                        ///< Data size [#].
             );
 
+  /// @brief **Element accessor.**
+  /// @details Returns a reference to the data element at the given index and marks it as
+  /// modified, so that a subsequent @link queue::flush @endlink uploads it to the client GPU.
+  int2_structure& at (
+                      size_t loc_index                                                              ///< Data index [#].
+                     );
+
+  /// @brief **Mark function.**
+  /// @details Marks the [begin, end) range of data elements as modified. To be used after having
+  /// modified the @link data @endlink array directly.
+  void mark (
+             size_t loc_begin,                                                                      ///< Range begin index (included).
+             size_t loc_end                                                                         ///< Range end index (excluded).
+            );
+
   /// @brief **Class destructor.**
   /// @details It deallocates the host PC memory previously allocated by the
   /// @link int2::init @endlink as data storage.
@@ -311,6 +410,11 @@ public:
   /// calls of the @link kernel::setarg @endlink method. It is internally managed by Neutrino.
   bool            ready;                                                                            ///< @brief **Buffer "ready" flag.**
 
+  /// @details List of the data ranges modified on the host PC since the last upload to the client
+  /// GPU. It is filled by the @link at @endlink and @link mark @endlink methods and consumed by
+  /// the @link queue::flush @endlink method. It is internally managed by Neutrino.
+  dirty_range     dirty;                                                                            ///< @brief **Dirty ranges.**
+
   /// @brief **Class constructor.**
   /// @details It resets the @link ready @endlink. The initialization of the class must occur
   /// after the initialization of the @link opencl @endlink and the @link opengl @endlink object,
@@ -324,6 +428,21 @@ public:
              size_t loc_size                                                                        ///< Data size [#].
             );
 
+  /// @brief **Element accessor.**
+  /// @details Returns a reference to the data element at the given index and marks it as
+  /// modified, so that a subsequent @link queue::flush @endlink uploads it to the client GPU.
+  int3_structure& at (
+                      size_t loc_index                                                              ///< Data index [#].
+                     );
+
+  /// @brief **Mark function.**
+  /// @details Marks the [begin, end) range of data elements as modified. To be used after having
+  /// modified the @link data @endlink array directly.
+  void mark (
+             size_t loc_begin,                                                                      ///< Range begin index (included).
+             size_t loc_end                                                                         ///< Range end index (excluded).
+            );
+
   /// @brief **Class destructor.**
   /// @details It deallocates the host PC memory previously allocated by the
   /// @link int3::init @endlink as data storage.
@@ -373,6 +492,11 @@ public:
   /// calls of the @link kernel::setarg @endlink method. It is internally managed by Neutrino.
   bool            ready;                                                                            ///< @brief **Buffer "ready" flag.**
 
+  /// @details List of the data ranges modified on the host PC since the last upload to the client
+  /// GPU. It is filled by the @link at @endlink and @link mark @endlink methods and consumed by
+  /// the @link queue::flush @endlink method. It is internally managed by Neutrino.
+  dirty_range     dirty;                                                                            ///< @brief **Dirty ranges.**
+
   /// @brief **Class constructor.**
   /// @details It resets the @link ready @endlink. The initialization of the class must occur
   /// after the initialization of the @link opencl @endlink and the @link opengl @endlink object,
@@ -386,6 +510,21 @@ public:
              size_t loc_size                                                                        ///< Data size [#].
             );
 
+  /// @brief **Element accessor.**
+  /// @details Returns a reference to the data element at the given index and marks it as
+  /// modified, so that a subsequent @link queue::flush @endlink uploads it to the client GPU.
+  int4_structure& at (
+                      size_t loc_index                                                              ///< Data index [#].
+                     );
+
+  /// @brief **Mark function.**
+  /// @details Marks the [begin, end) range of data elements as modified. To be used after having
+  /// modified the @link data @endlink array directly.
+  void mark (
+             size_t loc_begin,                                                                      ///< Range begin index (included).
+             size_t loc_end                                                                         ///< Range end index (excluded).
+            );
+
   /// @brief **Class destructor.**
   /// @details It deallocates the host PC memory previously allocated by the
   /// @link int4::init @endlink as data storage.
@@ -435,6 +574,11 @@ public:
   /// calls of the @link kernel::setarg @endlink method. It is internally managed by Neutrino.
   bool      ready;                                                                                  ///< @brief **Buffer "ready" flag.**
 
+  /// @details List of the data ranges modified on the host PC since the last upload to the client
+  /// GPU. It is filled by the @link at @endlink and @link mark @endlink methods and consumed by
+  /// the @link queue::flush @endlink method. It is internally managed by Neutrino.
+  dirty_range dirty;                                                                                ///< @brief **Dirty ranges.**
+
   /// @brief **Class constructor.**
   /// @details It resets the @link ready @endlink. The initialization of the class must occur
   /// after the initialization of the @link opencl @endlink and the @link opengl @endlink object,
@@ -448,6 +592,21 @@ public:
              size_t loc_size                                                                        ///< Data size [#].
             );
 
+  /// @brief **Element accessor.**
+  /// @details Returns a reference to the data element at the given index and marks it as
+  /// modified, so that a subsequent @link queue::flush @endlink uploads it to the client GPU.
+  cl_float& at (
+                size_t loc_index                                                                    ///< Data index [#].
+               );
+
+  /// @brief **Mark function.**
+  /// @details Marks the [begin, end) range of data elements as modified. To be used after having
+  /// modified the @link data @endlink array directly.
+  void mark (
+             size_t loc_begin,                                                                      ///< Range begin index (included).
+             size_t loc_end                                                                         ///< Range end index (excluded).
+            );
+
   /// @brief **Class destructor.**
   /// @details It deallocates the host PC memory previously allocated by the
   /// @link float1::init @endlink as data storage.
@@ -510,6 +669,11 @@ public:
   /// calls of the @link kernel::setarg @endlink method. It is internally managed by Neutrino.
   bool        ready;                                                                                ///< @brief **Buffer "ready" flag.**
 
+  /// @details List of the data ranges modified on the host PC since the last upload to the client
+  /// GPU. It is filled by the @link at @endlink and @link mark @endlink methods and consumed by
+  /// the @link queue::flush @endlink method. It is internally managed by Neutrino.
+  dirty_range dirty;                                                                                ///< @brief **Dirty ranges.**
+
   /// @brief **Class constructor.**
   /// @details It resets the @link ready @endlink. The initialization of the class must occur
   /// after the initialization of the @link opencl @endlink and the @link opengl @endlink object,
@@ -523,6 +687,21 @@ public:
              GLsizeiptr loc_size                                                                    ///< Data size [#].
             );
 
+  /// @brief **Element accessor.**
+  /// @details Returns a reference to the data element at the given index and marks it as
+  /// modified, so that a subsequent @link queue::flush @endlink uploads it to the client GPU.
+  GLfloat& at (
+               size_t loc_index                                                                     ///< Data index [#].
+              );
+
+  /// @brief **Mark function.**
+  /// @details Marks the [begin, end) range of data elements as modified. To be used after having
+  /// modified the @link data @endlink array directly.
+  void mark (
+             size_t loc_begin,                                                                      ///< Range begin index (included).
+             size_t loc_end                                                                         ///< Range end index (excluded).
+            );
+
   /// @brief **Class destructor.**
   /// @details It deallocates the host PC memory previously allocated by the
   /// @link float1G::init @endlink as data storage.
@@ -572,6 +751,11 @@ public:
   /// calls of the @link kernel::setarg @endlink method. It is internally managed by Neutrino.
   bool              ready;                                                                          ///< @brief **Buffer "ready" flag.**
 
+  /// @details List of the data ranges modified on the host PC since the last upload to the client
+  /// GPU. It is filled by the @link at @endlink and @link mark @endlink methods and consumed by
+  /// the @link queue::flush @endlink method. It is internally managed by Neutrino.
+  dirty_range       dirty;                                                                          ///< @brief **Dirty ranges.**
+
   /// @brief **Class constructor.**
   /// @details It resets the @link ready @endlink. The initialization of the class must occur
   /// after the initialization of the @link opencl @endlink and the @link opengl @endlink object,
@@ -585,6 +769,21 @@ public:
              size_t loc_size                                                                        ///< Data size [#].
             );
 
+  /// @brief **Element accessor.**
+  /// @details Returns a reference to the data element at the given index and marks it as
+  /// modified, so that a subsequent @link queue::flush @endlink uploads it to the client GPU.
+  float2_structure& at (
+                        size_t loc_index                                                            ///< Data index [#].
+                       );
+
+  /// @brief **Mark function.**
+  /// @details Marks the [begin, end) range of data elements as modified. To be used after having
+  /// modified the @link data @endlink array directly.
+  void mark (
+             size_t loc_begin,                                                                      ///< Range begin index (included).
+             size_t loc_end                                                                         ///< Range end index (excluded).
+            );
+
   /// @brief **Class destructor.**
   /// @details It deallocates the host PC memory previously allocated by the
   /// @link float2::init @endlink as data storage.
@@ -634,6 +833,11 @@ public:
   /// calls of the @link kernel::setarg @endlink method. It is internally managed by Neutrino.
   bool              ready;                                                                          ///< @brief **Buffer "ready" flag.**
 
+  /// @details List of the data ranges modified on the host PC since the last upload to the client
+  /// GPU. It is filled by the @link at @endlink and @link mark @endlink methods and consumed by
+  /// the @link queue::flush @endlink method. It is internally managed by Neutrino.
+  dirty_range       dirty;                                                                          ///< @brief **Dirty ranges.**
+
   /// @brief **Class constructor.**
   /// @details It resets the @link ready @endlink. The initialization of the class must occur
   /// after the initialization of the @link opencl @endlink and the @link opengl @endlink object,
@@ -647,6 +851,21 @@ public:
              size_t loc_size                                                                        ///< Data size [#].
             );
 
+  /// @brief **Element accessor.**
+  /// @details Returns a reference to the data element at the given index and marks it as
+  /// modified, so that a subsequent @link queue::flush @endlink uploads it to the client GPU.
+  float3_structure& at (
+                        size_t loc_index                                                            ///< Data index [#].
+                       );
+
+  /// @brief **Mark function.**
+  /// @details Marks the [begin, end) range of data elements as modified. To be used after having
+  /// modified the @link data @endlink array directly.
+  void mark (
+             size_t loc_begin,                                                                      ///< Range begin index (included).
+             size_t loc_end                                                                         ///< Range end index (excluded).
+            );
+
   /// @brief **Class destructor.**
   /// @details It deallocates the host PC memory previously allocated by the
   /// @link float3::init @endlink as data storage.
@@ -696,6 +915,11 @@ public:
   /// calls of the @link kernel::setarg @endlink method. It is internally managed by Neutrino.
   bool              ready;                                                                          ///< @brief **Buffer "ready" flag.**
 
+  /// @details List of the data ranges modified on the host PC since the last upload to the client
+  /// GPU. It is filled by the @link at @endlink and @link mark @endlink methods and consumed by
+  /// the @link queue::flush @endlink method. It is internally managed by Neutrino.
+  dirty_range       dirty;                                                                          ///< @brief **Dirty ranges.**
+
   /// @brief **Class constructor.**
   /// @details It resets the @link ready @endlink. The initialization of the class must occur
   /// after the initialization of the @link opencl @endlink and the @link opengl @endlink object,
@@ -709,6 +933,21 @@ public:
              size_t loc_size                                                                        ///< Data size [#].
             );
 
+  /// @brief **Element accessor.**
+  /// @details Returns a reference to the data element at the given index and marks it as
+  /// modified, so that a subsequent @link queue::flush @endlink uploads it to the client GPU.
+  float4_structure& at (
+                        size_t loc_index                                                            ///< Data index [#].
+                       );
+
+  /// @brief **Mark function.**
+  /// @details Marks the [begin, end) range of data elements as modified. To be used after having
+  /// modified the @link data @endlink array directly.
+  void mark (
+             size_t loc_begin,                                                                      ///< Range begin index (included).
+             size_t loc_end                                                                         ///< Range end index (excluded).
+            );
+
   /// @brief **Class destructor.**
   /// @details It deallocates the host PC memory previously allocated by the
   /// @link float4::init @endlink as data storage.
@@ -771,6 +1010,11 @@ public:
   /// calls of the @link kernel::setarg @endlink method. It is internally managed by Neutrino.
   bool               ready;                                                                         ///< @brief **Buffer "ready" flag.**
 
+  /// @details List of the data ranges modified on the host PC since the last upload to the client
+  /// GPU. It is filled by the @link at @endlink and @link mark @endlink methods and consumed by
+  /// the @link queue::flush @endlink method. It is internally managed by Neutrino.
+  dirty_range        dirty;                                                                         ///< @brief **Dirty ranges.**
+
   /// @brief **Class constructor.**
   /// @details It resets the @link ready @endlink. The initialization of the class must occur
   /// after the initialization of the @link opencl @endlink and the @link opengl @endlink object,
@@ -784,6 +1028,21 @@ public:
              GLsizeiptr loc_size                                                                    ///< Data size [#].
             );
 
+  /// @brief **Element accessor.**
+  /// @details Returns a reference to the data element at the given index and marks it as
+  /// modified, so that a subsequent @link queue::flush @endlink uploads it to the client GPU.
+  float4G_structure& at (
+                         size_t loc_index                                                           ///< Data index [#].
+                        );
+
+  /// @brief **Mark function.**
+  /// @details Marks the [begin, end) range of data elements as modified. To be used after having
+  /// modified the @link data @endlink array directly.
+  void mark (
+             size_t loc_begin,                                                                      ///< Range begin index (included).
+             size_t loc_end                                                                         ///< Range end index (excluded).
+            );
+
   /// @brief **Class destructor.**
   /// @details It deallocates the host PC memory previously allocated by the
   /// @link float4G::init @endlink as data storage.
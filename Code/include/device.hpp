@@ -32,6 +32,7 @@ class device
 private:
   neutrino*   baseline;                                                                             ///< @brief **Neutrino baseline.**
   std::string parameter_value;                                                                      ///< @brief **Parameter value.**
+  bool        queried;                                                                              ///< @brief **Detailed properties flag (see @link query @endlink).**
 
   /// @brief **string** getter function.
   /// @details It gets a **string** parameter from the device's information.
@@ -396,19 +397,47 @@ public:
   /// @details OpenCL software driver version string in the form major_number.minor_number.
   std::string         driver_version;                                                               ///< @brief **OpenCL device driver_version [std::string].**
 
+  /// @details Sub-devices created by the @link partition @endlink function (empty = none).
+  std::vector<cl_device_id> sub_device;                                                             ///< @brief **OpenCL sub-device id array [cl_device_id].**
+
   /// @brief **Class constructor.**
-  /// @details It does nothing.
+  /// @details It resets the detailed properties flag and all the device properties, so that the
+  /// detailed ones read as zero until @link query @endlink is called.
   device        ();
 
   /// @brief **Class initializer.**
-  /// @details It gets all information from the OpenCL hardware client GPU device and store it
-  /// in the corresponding public variables.
+  /// @details It gets the identity information of the OpenCL device (id, availability, name,
+  /// vendor, type, platform, profile, version, driver version and extensions) and stores it in
+  /// the corresponding public variables. All the other (detailed) properties are only fetched by
+  /// the @link query @endlink function.
   void init (
+             neutrino*    loc_baseline,                                                             ///< Neutrino baseline.
              cl_device_id loc_device_id                                                             ///< Device ID.
             );
 
+  /// @brief **Detailed property query function.**
+  /// @details It gets all the detailed information of the OpenCL device and stores it in the
+  /// corresponding public variables. It is memoized: only its first call queries the device. The
+  /// properties are also cached on disk, per device name and driver version, in the cache
+  /// directory under @link neutrino::cache_home @endlink, as the device calibration (unless it
+  /// is empty or @link neutrino::cache @endlink is false), so that the following runs skip the
+  /// queries entirely.
+  void query ();
+
+  /// @brief **Partition function.**
+  /// @details It partitions the device into sub-devices (see the OpenCL [clCreateSubDevices]
+  /// (https://www.khronos.org/registry/OpenCL/sdk/1.2/docs/man/xhtml/clCreateSubDevices.html)
+  /// specifications), either one per NUMA affinity domain (e.g. one per CPU socket) or in
+  /// sub-devices of "loc_units" compute units each, and stores them in the @link sub_device
+  /// @endlink array. It returns the number of sub-devices: 0 in case the device does not support
+  /// the requested partition.
+  cl_uint partition (
+                     device_partition loc_partition,                                                ///< Device partition.
+                     cl_uint          loc_units                                                     ///< Compute units per sub-device (NU_PARTITION_EQUALLY) [#].
+                    );
+
   /// @brief **Class destructor.**
-  /// @details It does nothing.
+  /// @details It releases the sub-devices, if any.
   ~device();
 };
 
@@ -0,0 +1,235 @@
+/// @file     ensemble.hpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Declaration of the "ensemble" class.
+///
+/// @details  A Neutrino "ensemble" runs many independent instances of the same simulation (e.g.
+/// a parameter sweep) as a single one: the data of all instances are stacked, instance after
+/// instance, into one allocation of each data object, and each kernel is launched once over the
+/// combined range, the last used kernel dimension (j-index for 1D instances, k-index for 2D
+/// instances) being the instance index. Small problems, which would leave the client GPU nearly
+/// idle if run one by one, are this way executed by a single launch filling the whole device.
+/// The element (i, j) of instance m is stored at index i + size_i*(j + instance_size_j*m), which
+/// is also the linear index of the work-item (i, j, m) of the combined range: the kernels can
+/// compute it from get_global_id and get_global_size as for a single instance.
+
+#ifndef ensemble_hpp
+#define ensemble_hpp
+
+#include "neutrino.hpp"
+#include "data_classes.hpp"
+#include "queue.hpp"
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// "ensemble" class //////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class ensemble
+/// ### Ensemble of independent simulation instances.
+/// Declares an ensemble of independent instances of the same simulation. To be used to batch
+/// many small simulations (e.g. parameter sweeps) into one allocation and one kernel launch.
+class ensemble                                                                                      /// @brief **Ensemble of independent simulation instances.**
+{
+private:
+  neutrino* baseline;                                                                               ///< @brief **Neutrino baseline.**
+
+  /// @brief **Instance read function.**
+  /// @details Reads the elements of one instance from a data buffer into the host data storage.
+  void read_instance (
+                      queue* loc_queue,                                                             ///< OpenCL queue.
+                      cl_mem loc_buffer,                                                            ///< Data buffer.
+                      void*  loc_data,                                                              ///< Data storage.
+                      size_t loc_element_size,                                                      ///< Data element size [bytes].
+                      size_t loc_instance                                                           ///< Instance index.
+                     );
+
+public:
+  size_t instances;                                                                                 ///< @brief **Number of instances [#].**
+  size_t instance_size_i;                                                                           ///< @brief **Instance size (i-index) [#].**
+  size_t instance_size_j;                                                                           ///< @brief **Instance size (j-index) [#].**
+  size_t elements;                                                                                  ///< @brief **Elements per instance [#].**
+  size_t size;                                                                                      ///< @brief **Elements of all instances [#].**
+  size_t size_i;                                                                                    ///< @brief **Kernel size (i-index).**
+  size_t size_j;                                                                                    ///< @brief **Kernel size (j-index).**
+  size_t size_k;                                                                                    ///< @brief **Kernel size (k-index).**
+
+  /// @brief **Class constructor.**
+  /// @details It resets the Neutrino baseline and the sizes.
+  ensemble ();
+
+  /// @brief **Class initializer.**
+  /// @details Sets the number of instances and the size of each one (instance_size_j = 1 for 1D
+  /// instances), and computes the kernel sizes of the combined range: (instance_size_i,
+  /// instances, 1) for 1D instances and (instance_size_i, instance_size_j, instances) for 2D
+  /// instances. They must be used as sizes of the kernels run on the ensemble.
+  void init (
+             neutrino* loc_baseline,                                                                ///< Neutrino baseline.
+             size_t    loc_instances,                                                               ///< Number of instances [#].
+             size_t    loc_instance_size_i,                                                         ///< Instance size (i-index) [#].
+             size_t    loc_instance_size_j                                                          ///< Instance size (j-index) [#].
+            );
+
+  /// @brief **Offset function.**
+  /// @details Returns the index of the first element of an instance in the stacked data.
+  size_t offset (
+                 size_t loc_instance                                                                ///< Instance index.
+                );
+
+
+  /// @brief **Stack function.**
+  /// @details Initializes a data object as the stack of the data of all instances (one
+  /// allocation of @link size @endlink elements). It replaces the data init method.
+  void stack (
+              int1* loc_data                                                                        ///< int1 object.
+             );
+
+  /// @overload stack(int2* loc_data)
+  void stack (
+              int2* loc_data                                                                        ///< int2 object.
+             );
+
+  /// @overload stack(int3* loc_data)
+  void stack (
+              int3* loc_data                                                                        ///< int3 object.
+             );
+
+  /// @overload stack(int4* loc_data)
+  void stack (
+              int4* loc_data                                                                        ///< int4 object.
+             );
+
+  /// @overload stack(float1* loc_data)
+  void stack (
+              float1* loc_data                                                                      ///< float1 object.
+             );
+
+  /// @overload stack(float2* loc_data)
+  void stack (
+              float2* loc_data                                                                      ///< float2 object.
+             );
+
+  /// @overload stack(float3* loc_data)
+  void stack (
+              float3* loc_data                                                                      ///< float3 object.
+             );
+
+  /// @overload stack(float4* loc_data)
+  void stack (
+              float4* loc_data                                                                      ///< float4 object.
+             );
+
+  /// @brief **View function.**
+  /// @details Returns a pointer to the first element of an instance in the host data storage of
+  /// a stacked data object: the instance elements are contiguous, in the same order as a single
+  /// instance would have.
+  cl_long* view (
+                 int1*   loc_data,                                                                  ///< int1 object.
+                 size_t  loc_instance                                                               ///< Instance index.
+                );
+
+  /// @overload view(int2* loc_data, size_t loc_instance)
+  int2_structure* view (
+                        int2*   loc_data,                                                           ///< int2 object.
+                        size_t  loc_instance                                                        ///< Instance index.
+                       );
+
+  /// @overload view(int3* loc_data, size_t loc_instance)
+  int3_structure* view (
+                        int3*   loc_data,                                                           ///< int3 object.
+                        size_t  loc_instance                                                        ///< Instance index.
+                       );
+
+  /// @overload view(int4* loc_data, size_t loc_instance)
+  int4_structure* view (
+                        int4*   loc_data,                                                           ///< int4 object.
+                        size_t  loc_instance                                                        ///< Instance index.
+                       );
+
+  /// @overload view(float1* loc_data, size_t loc_instance)
+  cl_float* view (
+                  float1* loc_data,                                                                 ///< float1 object.
+                  size_t  loc_instance                                                              ///< Instance index.
+                 );
+
+  /// @overload view(float2* loc_data, size_t loc_instance)
+  float2_structure* view (
+                          float2* loc_data,                                                         ///< float2 object.
+                          size_t  loc_instance                                                      ///< Instance index.
+                         );
+
+  /// @overload view(float3* loc_data, size_t loc_instance)
+  float3_structure* view (
+                          float3* loc_data,                                                         ///< float3 object.
+                          size_t  loc_instance                                                      ///< Instance index.
+                         );
+
+  /// @overload view(float4* loc_data, size_t loc_instance)
+  float4_structure* view (
+                          float4* loc_data,                                                         ///< float4 object.
+                          size_t  loc_instance                                                      ///< Instance index.
+                         );
+
+  /// @brief **Instance read function.**
+  /// @details Reads back only the elements of one instance of a stacked data object from the
+  /// client GPU into its host data storage (see @link view @endlink), waiting for the previous
+  /// commands of the queue. The other instances are not transferred.
+  void read (
+             queue*  loc_queue,                                                                     ///< OpenCL queue.
+             int1*   loc_data,                                                                      ///< int1 object.
+             size_t  loc_instance                                                                   ///< Instance index.
+            );
+
+  /// @overload read(queue* loc_queue, int2* loc_data, size_t loc_instance)
+  void read (
+             queue*  loc_queue,                                                                     ///< OpenCL queue.
+             int2*   loc_data,                                                                      ///< int2 object.
+             size_t  loc_instance                                                                   ///< Instance index.
+            );
+
+  /// @overload read(queue* loc_queue, int3* loc_data, size_t loc_instance)
+  void read (
+             queue*  loc_queue,                                                                     ///< OpenCL queue.
+             int3*   loc_data,                                                                      ///< int3 object.
+             size_t  loc_instance                                                                   ///< Instance index.
+            );
+
+  /// @overload read(queue* loc_queue, int4* loc_data, size_t loc_instance)
+  void read (
+             queue*  loc_queue,                                                                     ///< OpenCL queue.
+             int4*   loc_data,                                                                      ///< int4 object.
+             size_t  loc_instance                                                                   ///< Instance index.
+            );
+
+  /// @overload read(queue* loc_queue, float1* loc_data, size_t loc_instance)
+  void read (
+             queue*  loc_queue,                                                                     ///< OpenCL queue.
+             float1* loc_data,                                                                      ///< float1 object.
+             size_t  loc_instance                                                                   ///< Instance index.
+            );
+
+  /// @overload read(queue* loc_queue, float2* loc_data, size_t loc_instance)
+  void read (
+             queue*  loc_queue,                                                                     ///< OpenCL queue.
+             float2* loc_data,                                                                      ///< float2 object.
+             size_t  loc_instance                                                                   ///< Instance index.
+            );
+
+  /// @overload read(queue* loc_queue, float3* loc_data, size_t loc_instance)
+  void read (
+             queue*  loc_queue,                                                                     ///< OpenCL queue.
+             float3* loc_data,                                                                      ///< float3 object.
+             size_t  loc_instance                                                                   ///< Instance index.
+            );
+
+  /// @overload read(queue* loc_queue, float4* loc_data, size_t loc_instance)
+  void read (
+             queue*  loc_queue,                                                                     ///< OpenCL queue.
+             float4* loc_data,                                                                      ///< float4 object.
+             size_t  loc_instance                                                                   ///< Instance index.
+            );
+
+  /// @brief **Class destructor.**
+  /// @details Does nothing: the stacked data objects are owned by the application.
+  ~ensemble ();
+};
+
+#endif
@@ -15,6 +15,28 @@
 
 #include "neutrino.hpp"
 #include "data_classes.hpp"
+#include "library.hpp"
+
+/// @brief    **Data structure. Internally used by Neutrino.**
+/// @details  This structure stores the metadata of a single kernel argument.
+typedef struct _argument_structure
+{
+  std::string                     name;                                                             ///< Argument name.
+  std::string                     type;                                                             ///< Argument type name (e.g. "float4*").
+  cl_kernel_arg_address_qualifier address;                                                          ///< Argument address qualifier.
+  cl_kernel_arg_type_qualifier    qualifier;                                                        ///< Argument type qualifier (CL_KERNEL_ARG_TYPE_NONE if unknown).
+  std::string                     base;                                                             ///< Argument base type (e.g. "float", "" = user defined type).
+  size_t                          width;                                                            ///< Argument vector width [#].
+} argument_structure;
+
+/// @brief    **Data structure. Internally used by Neutrino.**
+/// @details  This structure stores a buffer written by a kernel, as merged by the multi-device
+/// execution.
+typedef struct _output_structure
+{
+  cl_mem buffer;                                                                                    ///< Output buffer.
+  size_t row;                                                                                       ///< Size per index along the last kernel dimension (0 = derived from the buffer size) [bytes].
+} output_structure;
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////////// "kernel" class ///////////////////////////////////////////
@@ -28,19 +50,117 @@ class kernel
 private:
   neutrino*                baseline;                                                                ///< @brief **Neutrino baseline.**
   cl_device_id*            device_id;                                                               ///< @brief **Device ID array.**
+  std::vector<std::vector<char>> argument_value;                                                    ///< @brief **Kernel argument value array (empty = local memory).**
+  std::vector<size_t>      argument_size;                                                           ///< @brief **Kernel argument value size array (0 = not set) [bytes].**
+  std::string              build_options;                                                           ///< @brief **Compiler options, including specialization macros.**
+  std::thread              watcher;                                                                 ///< @brief **Source watcher thread.**
+  std::mutex               watch_lock;                                                              ///< @brief **Source watcher lock.**
+  std::condition_variable  watch_wakeup;                                                            ///< @brief **Source watcher signal.**
+  bool                     watch_stop;                                                              ///< @brief **Source watcher "stop" flag.**
+  cl_program               reload_program;                                                          ///< @brief **Rebuilt program, waiting to be swapped in.**
+  cl_kernel                reload_kernel;                                                           ///< @brief **Rebuilt kernel, waiting to be swapped in.**
+  std::atomic<bool>        reload_ready;                                                            ///< @brief **Rebuilt kernel "ready" flag.**
+  std::vector<std::string> reload_source;                                                           ///< @brief **Sources of the rebuilt kernel.**
+  std::map<std::string, cl_uint> argument_index;                                                    ///< @brief **Kernel argument layout indexes, by name.**
+  std::vector<cl_kernel>   replica_id;                                                              ///< @brief **Kernel copies for the other devices of the context (NULL = none).**
+  cl_program               replica_program;                                                         ///< @brief **Program of the kernel copies.**
+  bool                     il;                                                                      ///< @brief **SPIR-V program flag (no argument metadata).**
+
+  /// @brief **Source watcher thread function.**
+  /// @details Periodically reads the kernel source files and, whenever they change, rebuilds the
+  /// program in the background and hands the new kernel to the @link kernel::reload @endlink
+  /// method. In case of build errors, the compiler log is printed and the old kernel is kept.
+  void watch_loop ();
+
+  /// @brief **Metadata cache file function.**
+  /// @details Returns the argument metadata cache file name of the current sources (including
+  /// their headers), compiler options and entry point, or an empty string in case the program
+  /// cache is disabled.
+  std::string metadata_file ();
+
+  /// @brief **Metadata function.**
+  /// @details Gets the argument metadata of the kernel (see @link introspect @endlink), from the
+  /// argument metadata cache file of its sources, compiler options and entry point, if the
+  /// program cache is enabled. In case the program comes from a SPIR-V module, which carries no
+  /// argument metadata, and none is found in the cache, the program is rebuilt from source, so
+  /// that the named arguments, the argument checks and the multi-device outputs keep working.
+  void describe ();
+
+  /// @brief **Introspection function.**
+  /// @details Gets the metadata (name, type, address and type qualifiers) of all the kernel
+  /// arguments. Since OpenCL only guarantees them for programs built from source, they are saved
+  /// to (or loaded from, when the program comes from the binary cache) the given file, if not
+  /// empty.
+  void introspect (
+                   std::string loc_file_name                                                        ///< Argument metadata cache file name ("" = none).
+                  );
+
+  /// @brief **Argument type function.**
+  /// @details Splits the type name of a kernel argument (e.g. "float4*") into its base type and
+  /// vector width, once at introspection time, so that the argument checks need no parsing. The
+  /// base type is left empty for user defined types.
+  void classify (
+                 argument_structure& loc_argument                                                   ///< Argument metadata.
+                );
+
+  /// @brief **Argument index function.**
+  /// @details Returns the layout index of the kernel argument with the given name (looked up in
+  /// the index built by the introspection).
+  cl_uint index (
+                 std::string loc_argument_name                                                      ///< Argument name.
+                );
+
+  /// @brief **Argument check function.**
+  /// @details Checks a data object against the metadata of a kernel argument (if available): the
+  /// argument must be a global or constant pointer, its base type must match the data type and its
+  /// vector width must be either 1 or that of the data. Pointers to user defined types are
+  /// accepted.
+  void check (
+              cl_uint     loc_layout_index,                                                         ///< Layout index.
+              std::string loc_base,                                                                 ///< Data base type ("long" or "float").
+              size_t      loc_width                                                                 ///< Data vector width [#].
+             );
+
+  /// @brief **Value check function.**
+  /// @details Checks an argument passed by value against the metadata of a kernel argument (if
+  /// available): the argument must not be a pointer and, for built-in types, its size must match
+  /// the size of the value (e.g. a "double" given to a "float" argument is rejected). User defined
+  /// types are accepted.
+  void check_value (
+                    cl_uint loc_layout_index,                                                       ///< Layout index.
+                    size_t  loc_size                                                                ///< Value size [bytes].
+                   );
+
+  /// @brief **Rebind function.**
+  /// @details Binds an already created OpenCL buffer on a kernel argument, without any
+  /// synchronization or terminal message.
+  void rebind (
+               cl_uint loc_layout_index,                                                            ///< Layout index.
+               cl_mem* loc_buffer,                                                                  ///< Data buffer.
+               size_t  loc_bytes                                                                    ///< Data size [bytes].
+              );
 
 public:
   cl_kernel                kernel_id;                                                               ///< @brief **Kernel id.**
+  std::string              kernel_name;                                                             ///< @brief **Kernel entry point name [std::string].**
   std::string              kernel_home;                                                             ///< @brief **Kernel home directory [std::string].**
   std::vector<std::string> kernel_file_name;                                                        ///< @brief **Kernel file name array [std::string].**
   std::vector<std::string> kernel_source;                                                           ///< @brief **Kernel source array [std::string].**
   std::string              compiler_options;                                                        ///< @brief **OpenCL JIT complier options string [std::string].**
+  std::map<std::string, std::string> constant;                                                      ///< @brief **Specialization constant map (macro name, macro value).**
   std::string              compiler_log;                                                            ///< @brief **OpenCL JIT compiler error log [std::string].**
   cl_program               program;                                                                 ///< @brief **Kernel program.**
   size_t                   size_i;                                                                  ///< @brief **Kernel size (i-index) [#].**
   size_t                   size_j;                                                                  ///< @brief **Kernel size (j-index) [#].**
   size_t                   size_k;                                                                  ///< @brief **Kernel size (k-index) [#].**
+  size_t                   local_i;                                                                 ///< @brief **Kernel local size (i-index, 0 = driver choice) [#].**
+  size_t                   local_j;                                                                 ///< @brief **Kernel local size (j-index) [#].**
+  size_t                   local_k;                                                                 ///< @brief **Kernel local size (k-index) [#].**
+  size_t                   chunk_offset;                                                            ///< @brief **Chunked execution offset (along the last dimension) [#].**
   cl_event                 event;                                                                   ///< @brief **Kernel event.**
+  std::vector<size_t>      argument_bytes;                                                          ///< @brief **Kernel argument size array [bytes].**
+  std::vector<argument_structure> argument;                                                         ///< @brief **Kernel argument metadata array.**
+  std::map<cl_uint, size_t> partition;                                                              ///< @brief **Declared multi-device outputs (layout index, size per index along the last dimension) [bytes].**
 
   /// @brief **Class constructor.**
   /// @details It resets the @link source @endlink, @link program @endlink, @link size_i @endlink,
@@ -51,6 +171,37 @@ public:
   /// therefore it must be done by invoking the @link kernel::init @endlink method.
   kernel();
 
+  /// @brief **Compiler option function.**
+  /// @details Appends an option (e.g. "-cl-fast-relaxed-math", "-cl-mad-enable") to the OpenCL
+  /// JIT compiler options. To be called before the @link kernel::init @endlink method.
+  void option (
+               std::string loc_option                                                               ///< Compiler option.
+              );
+
+  /// @brief **Specialization constant function.**
+  /// @details Defines a specialization constant, injected in the kernel program as a "-D" macro,
+  /// so that the OpenCL compiler can fold it (e.g. to unroll loops on known sizes). Defining the
+  /// same name again overwrites its value. Each distinct set of constants is built and cached as
+  /// a distinct program. To be called before the @link kernel::init @endlink method.
+  void define (
+               std::string loc_name,                                                                ///< Macro name.
+               std::string loc_value                                                                ///< Macro value (verbatim).
+              );
+
+  /// @overload define(std::string loc_name, T loc_value)
+  /// @details Defines a numeric specialization constant, of any integral or floating point type
+  /// (e.g. "int", "unsigned int", "long long", "size_t", "cl_float", "double"), printed as an
+  /// OpenCL C literal of the same type (see @link neutrino::literal @endlink). Double constants
+  /// require the "cl_khr_fp64" extension on the client device.
+  template <typename T, typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+  void define (
+               std::string loc_name,                                                                ///< Macro name.
+               T           loc_value                                                                ///< Macro value.
+              )
+  {
+    define (loc_name, neutrino::literal (loc_value));                                               // Setting specialization constant...
+  }
+
   /// @brief **Class initializer.**
   /// @details Loads an OpenCL kernel source from its corresponding source file,
   /// creates an OpenCL program from that kernel source and builds it into an OpenCL program,
@@ -59,6 +210,18 @@ public:
   /// and @link size_k @endlink variables are copied from the corresponding parameters the user
   /// must pass as input arguments to the @link kernel::init @method , according to the
   /// implementation of the algorithms in the kernel source code.
+  /// In case the program cache is enabled (see @link neutrino::cache @endlink), the program is
+  /// loaded from its binary cache file when available, otherwise it is built from source and its
+  /// binary is saved to the cache for the next runs. The header files included by the kernel
+  /// sources with quoted "#include" directives, and found in the kernel home directory, are part
+  /// of the cache key (see @link neutrino::headers @endlink): headers included from elsewhere are
+  /// not, and the cache directory must be cleared when they change.
+  /// In case an up to date SPIR-V module precompiled from the kernel sources exists (see @link
+  /// neutrino::load_il @endlink) and no specialization constant nor preprocessor option is
+  /// defined, the program is created from it instead, provided all devices support SPIR-V. As
+  /// SPIR-V modules carry no argument metadata, these are then taken from the argument metadata
+  /// cache, written by a previous build from source: in case it is not available, the program is
+  /// built from source anyway.
   void init (
              neutrino*                loc_baseline,                                                 ///< Neutrino baseline.
              std::string              loc_kernel_home,                                              ///< Kernel home directory.
@@ -68,6 +231,19 @@ public:
              size_t                   loc_kernel_size_k                                             ///< OpenCL kernel size (k-index).
             );
 
+  /// @overload init(neutrino* loc_baseline, library* loc_library, std::string loc_kernel_name, size_t loc_kernel_size_i, size_t loc_kernel_size_j, size_t loc_kernel_size_k)
+  /// @details Creates the OpenCL kernel object from the named entry point of an already built
+  /// @link library @endlink, without building any program. Several kernels can be created from
+  /// the same library, each one registered in the Neutrino baseline as a distinct kernel.
+  void init (
+             neutrino*                loc_baseline,                                                 ///< Neutrino baseline.
+             library*                 loc_library,                                                  ///< OpenCL library.
+             std::string              loc_kernel_name,                                              ///< OpenCL kernel entry point name.
+             size_t                   loc_kernel_size_i,                                            ///< OpenCL kernel size (i-index).
+             size_t                   loc_kernel_size_j,                                            ///< OpenCL kernel size (j-index).
+             size_t                   loc_kernel_size_k                                             ///< OpenCL kernel size (k-index).
+            );
+
   /// @brief **Kernel argument setter function.**
   /// @details Sets an argument on the Neutrino kernel object. The argument in the kernel object
   /// must correspond to the argument in the OpenCL kernel source file.
@@ -228,6 +404,257 @@ public:
                GLuint   loc_layout_index                                                            ///< Layout index.
               );
 
+  /// @overload setarg(const void* loc_value, size_t loc_size, cl_uint loc_layout_index)
+  /// @details Sets an argument passed by value on the Neutrino kernel object: no OpenCL memory
+  /// buffer is created and the value is copied by OpenCL at the time of the call, therefore it can
+  /// be changed (e.g. a time step) between two kernel executions by calling this function again.
+  /// No message is printed, in order to allow calling it at each step.
+  /// The value can be any trivially copyable structure: its memory layout (including alignment
+  /// and padding) must match the corresponding structure declared in the OpenCL kernel source.
+  void setarg (
+               const void* loc_value,                                                               ///< Argument value.
+               size_t      loc_size,                                                                ///< Argument size [bytes].
+               cl_uint     loc_layout_index                                                         ///< Layout index.
+              );
+
+  /// @overload setarg(cl_int loc_value, cl_uint loc_layout_index)
+  /// @details Sets an "int" argument passed by value.
+  void setarg (
+               cl_int    loc_value,                                                                 ///< Argument value.
+               cl_uint   loc_layout_index                                                           ///< Layout index.
+              );
+
+  /// @overload setarg(cl_uint loc_value, cl_uint loc_layout_index)
+  /// @details Sets a "uint" argument passed by value.
+  void setarg (
+               cl_uint   loc_value,                                                                 ///< Argument value.
+               cl_uint   loc_layout_index                                                           ///< Layout index.
+              );
+
+  /// @overload setarg(cl_long loc_value, cl_uint loc_layout_index)
+  /// @details Sets a "long" argument passed by value.
+  void setarg (
+               cl_long   loc_value,                                                                 ///< Argument value.
+               cl_uint   loc_layout_index                                                           ///< Layout index.
+              );
+
+  /// @overload setarg(cl_ulong loc_value, cl_uint loc_layout_index)
+  /// @details Sets a "ulong" argument passed by value.
+  void setarg (
+               cl_ulong  loc_value,                                                                 ///< Argument value.
+               cl_uint   loc_layout_index                                                           ///< Layout index.
+              );
+
+  /// @overload setarg(cl_float loc_value, cl_uint loc_layout_index)
+  /// @details Sets a "float" argument passed by value.
+  void setarg (
+               cl_float  loc_value,                                                                 ///< Argument value.
+               cl_uint   loc_layout_index                                                           ///< Layout index.
+              );
+
+  /// @overload setarg(cl_double loc_value, cl_uint loc_layout_index)
+  /// @details Sets a "double" argument passed by value. It requires the "cl_khr_fp64"
+  /// extension on the client device.
+  void setarg (
+               cl_double loc_value,                                                                 ///< Argument value.
+               cl_uint   loc_layout_index                                                           ///< Layout index.
+              );
+
+  /// @overload setarg(cl_int2 loc_value, cl_uint loc_layout_index)
+  /// @details Sets an "int2" argument passed by value.
+  void setarg (
+               cl_int2   loc_value,                                                                 ///< Argument value.
+               cl_uint   loc_layout_index                                                           ///< Layout index.
+              );
+
+  /// @overload setarg(cl_int4 loc_value, cl_uint loc_layout_index)
+  /// @details Sets an "int4" (or "int3") argument passed by value.
+  void setarg (
+               cl_int4   loc_value,                                                                 ///< Argument value.
+               cl_uint   loc_layout_index                                                           ///< Layout index.
+              );
+
+  /// @overload setarg(cl_float2 loc_value, cl_uint loc_layout_index)
+  /// @details Sets a "float2" argument passed by value.
+  void setarg (
+               cl_float2 loc_value,                                                                 ///< Argument value.
+               cl_uint   loc_layout_index                                                           ///< Layout index.
+              );
+
+  /// @overload setarg(cl_float4 loc_value, cl_uint loc_layout_index)
+  /// @details Sets a "float4" (or "float3") argument passed by value.
+  void setarg (
+               cl_float4 loc_value,                                                                 ///< Argument value.
+               cl_uint   loc_layout_index                                                           ///< Layout index.
+              );
+
+  /// @overload setarg(T loc_value, cl_uint loc_layout_index)
+  /// @details Sets an argument of any other trivially copyable type passed by value (e.g. a
+  /// "size_t", whose underlying type differs across platforms, or a structure mirroring one
+  /// declared in the OpenCL kernel source). Its size is checked against the argument metadata, if
+  /// available.
+  template <typename T>
+  void setarg (
+               T       loc_value,                                                                   ///< Argument value.
+               cl_uint loc_layout_index                                                             ///< Layout index.
+              )
+  {
+    static_assert (std::is_trivially_copyable<T>::value, "kernel argument must be trivially copyable");
+    static_assert (!std::is_pointer<T>::value, "kernel argument must not be a host pointer");
+    setarg (&loc_value, sizeof(T), loc_layout_index);                                               // Setting argument by value...
+  }
+
+  /// @overload setarg(int1* loc_data, std::string loc_argument_name)
+  /// @details Sets an argument on the Neutrino kernel object by the name it has in the OpenCL
+  /// kernel source. Once the OpenCL buffer of the data object has been created (i.e. from the
+  /// second call on), this is the fast path for rebinding data objects at each step: the data
+  /// object is checked against the argument metadata collected when the kernel was built, without
+  /// any OpenGL synchronization or terminal message.
+  void setarg (
+               int1*       loc_data,                                                                ///< int1 data.
+               std::string loc_argument_name                                                        ///< Argument name.
+              );
+
+  /// @overload setarg(int2* loc_data, std::string loc_argument_name)
+  /// @details Sets an argument by name.
+  void setarg (
+               int2*       loc_data,                                                                ///< int2 data.
+               std::string loc_argument_name                                                        ///< Argument name.
+              );
+
+  /// @overload setarg(int3* loc_data, std::string loc_argument_name)
+  /// @details Sets an argument by name.
+  void setarg (
+               int3*       loc_data,                                                                ///< int3 data.
+               std::string loc_argument_name                                                        ///< Argument name.
+              );
+
+  /// @overload setarg(int4* loc_data, std::string loc_argument_name)
+  /// @details Sets an argument by name.
+  void setarg (
+               int4*       loc_data,                                                                ///< int4 data.
+               std::string loc_argument_name                                                        ///< Argument name.
+              );
+
+  /// @overload setarg(float1* loc_data, std::string loc_argument_name)
+  /// @details Sets an argument by name.
+  void setarg (
+               float1*     loc_data,                                                                ///< float1 data.
+               std::string loc_argument_name                                                        ///< Argument name.
+              );
+
+  /// @overload setarg(float1G* loc_data, std::string loc_argument_name)
+  /// @details Sets an argument by name.
+  void setarg (
+               float1G*    loc_data,                                                                ///< float1G data.
+               std::string loc_argument_name                                                        ///< Argument name.
+              );
+
+  /// @overload setarg(float2* loc_data, std::string loc_argument_name)
+  /// @details Sets an argument by name.
+  void setarg (
+               float2*     loc_data,                                                                ///< float2 data.
+               std::string loc_argument_name                                                        ///< Argument name.
+              );
+
+  /// @overload setarg(float3* loc_data, std::string loc_argument_name)
+  /// @details Sets an argument by name.
+  void setarg (
+               float3*     loc_data,                                                                ///< float3 data.
+               std::string loc_argument_name                                                        ///< Argument name.
+              );
+
+  /// @overload setarg(float4* loc_data, std::string loc_argument_name)
+  /// @details Sets an argument by name.
+  void setarg (
+               float4*     loc_data,                                                                ///< float4 data.
+               std::string loc_argument_name                                                        ///< Argument name.
+              );
+
+  /// @overload setarg(float4G* loc_data, std::string loc_argument_name)
+  /// @details Sets an argument by name.
+  void setarg (
+               float4G*    loc_data,                                                                ///< float4G data.
+               std::string loc_argument_name                                                        ///< Argument name.
+              );
+
+  /// @brief **Kernel local memory argument setter function.**
+  /// @details Allocates work-group local memory (scratch space shared by the work-items of the same
+  /// work-group) for a "__local" pointer argument of the OpenCL kernel. Only the size is given:
+  /// the memory content is undefined at the beginning of each work-group.
+  void setlocal (
+                 size_t  loc_size,                                                                  ///< Local memory size [bytes].
+                 cl_uint loc_layout_index                                                           ///< Layout index.
+                );
+
+  /// @brief **Kernel size function.**
+  /// @details Gets the global (and local, if explicitly set) sizes of the kernel and returns its
+  /// dimension. In case the local size is set, the global size is padded up to a multiple of it:
+  /// the kernel must then discard the work-items beyond its actual size. It exits in case the
+  /// kernel size is invalid. Used by all the functions enqueueing the kernel.
+  cl_uint get_size (
+                    size_t* loc_global,                                                             ///< Global size array (3 elements).
+                    size_t* loc_local                                                               ///< Local size array (3 elements).
+                   );
+
+  /// @brief **Kernel argument binding function.**
+  /// @details Sets the value of a kernel argument on the OpenCL kernel and records it, so that it
+  /// can be rebound after a hot reload (see @link kernel::watch @endlink). A NULL value sets a
+  /// local memory argument of the given size. It returns the OpenCL error code. Internally used by
+  /// Neutrino.
+  cl_int bind (
+               cl_uint     loc_layout_index,                                                        ///< Layout index.
+               size_t      loc_size,                                                                ///< Argument size [bytes].
+               const void* loc_value                                                                ///< Argument value (NULL = local memory).
+              );
+
+  /// @brief **Kernel source watch function.**
+  /// @details Starts watching the kernel source files (see @link kernel::kernel_file_name
+  /// @endlink) for changes: upon each change, the program is rebuilt in the background, with the
+  /// same compiler options and specialization constants, and swapped in by the next execution of
+  /// the kernel, with all its current arguments rebound. In case the new sources do not build,
+  /// or their arguments do not match the current ones, the old kernel is kept. Header files
+  /// included by the kernel sources are not watched. To be used during kernel development.
+  void watch ();
+
+  /// @brief **Kernel reload function.**
+  /// @details Swaps in the kernel rebuilt by the source watcher, if any, rebinding all the current
+  /// arguments on it. It returns true in case the kernel has been swapped. It is invoked by the
+  /// kernel execution functions, on the application thread. The argument metadata are taken from
+  /// the rebuilt kernel or from the metadata cache of its sources; in case none is available
+  /// (e.g. a SPIR-V module built before its sources), the previous metadata are kept.
+  bool reload ();
+
+  /// @brief **Output declaration function.**
+  /// @details Declares a kernel argument as an output of the multi-device execution (see @link
+  /// opencl::init @endlink), laid out along the last kernel dimension with "loc_row" bytes per
+  /// index (0 = buffer size divided by the kernel size along the last dimension). Each device
+  /// only writes, and gets merged back, its own partition of the buffer. Once at least one output
+  /// is declared, the undeclared arguments are treated as inputs; otherwise the outputs are
+  /// deduced from the argument metadata. To be called before the execution.
+  void partition_output (
+                         cl_uint loc_layout_index,                                                  ///< Layout index.
+                         size_t  loc_row                                                            ///< Size per index along the last dimension (0 = derived) [bytes].
+                        );
+
+  /// @brief **Output buffer function.**
+  /// @details Returns the OpenCL buffers the kernel writes: the declared outputs (see @link
+  /// kernel::partition_output @endlink), if any, otherwise the buffers currently set on the global
+  /// pointer arguments which are not "const" qualified, which requires the argument metadata (see
+  /// @link kernel::argument @endlink).
+  std::vector<output_structure> output ();
+
+  /// @brief **Kernel replica function.**
+  /// @details Returns a copy of the kernel for another device of a multi-device context (see
+  /// @link opencl::init @endlink), created from the same program, with all the current arguments
+  /// set on it. The buffers found in the given map (original buffer, device replica buffer) are
+  /// substituted by their replicas. The copy is kept by the kernel, recreated in case the kernel
+  /// is reloaded, and released with it.
+  cl_kernel replica (
+                     size_t                    loc_device_index,                                    ///< Device index in the context device list.
+                     std::map<cl_mem, cl_mem>& loc_buffer                                           ///< Replica buffer map (original buffer, replica buffer).
+                    );
+
   /// @brief **Class destructor.**
   /// @details Releases the OpenCL kernel object, releases the OpenCL kernel event,
   /// releases the OpenCL program, releases the device ID array.
@@ -0,0 +1,91 @@
+/// @file     library.hpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Declaration of an OpenCL "library" class.
+///
+/// @details  A Neutrino "library" is an OpenCL program built once from a set of source files,
+/// from which any number of @link kernel @endlink objects can be created, each one bound to a
+/// distinct named entry point (i.e. a "__kernel" function of the sources), by means of the
+/// corresponding @link kernel::init @endlink method. This avoids building the same shared helper
+/// sources once per kernel and allows multi-stage pipelines to be written in a single source file.
+/// The kernels created from a library keep the OpenCL program alive: the library can be deleted
+/// before them.
+
+#ifndef library_hpp
+#define library_hpp
+
+#include "neutrino.hpp"
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// "library" class ///////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class library
+/// ### OpenCL program library.
+/// Declares an OpenCL program library.
+/// To be used to create several kernels from a single OpenCL program.
+class library                                                                                       /// @brief **OpenCL program library.**
+{
+private:
+  neutrino*                          baseline;                                                      ///< @brief **Neutrino baseline.**
+
+public:
+  std::string                        library_home;                                                  ///< @brief **Library home directory [std::string].**
+  std::vector<std::string>           library_file_name;                                             ///< @brief **Library file name array [std::string].**
+  std::vector<std::string>           library_source;                                                ///< @brief **Library source array [std::string].**
+  std::string                        compiler_options;                                              ///< @brief **OpenCL JIT complier options string [std::string].**
+  std::map<std::string, std::string> constant;                                                      ///< @brief **Specialization constant map (macro name, macro value).**
+  std::string                        compiler_log;                                                  ///< @brief **OpenCL JIT compiler error log [std::string].**
+  cl_program                         program;                                                       ///< @brief **Library program.**
+  bool                               il;                                                            ///< @brief **SPIR-V program flag (no argument metadata).**
+
+  /// @brief **Class constructor.**
+  /// @details It resets the @link program @endlink and the compiler options.
+  library();
+
+  /// @brief **Compiler option function.**
+  /// @details Appends an option to the OpenCL JIT compiler options. To be called before the
+  /// @link library::init @endlink method.
+  void option (
+               std::string loc_option                                                               ///< Compiler option.
+              );
+
+  /// @brief **Specialization constant function.**
+  /// @details Defines a specialization constant, injected in the library program as a "-D"
+  /// macro (see @link kernel::define @endlink). To be called before the @link library::init
+  /// @endlink method.
+  void define (
+               std::string loc_name,                                                                ///< Macro name.
+               std::string loc_value                                                                ///< Macro value (verbatim).
+              );
+
+  /// @overload define(std::string loc_name, T loc_value)
+  /// @details Defines a numeric specialization constant, of any integral or floating point type
+  /// (e.g. "int", "unsigned int", "long long", "size_t", "cl_float", "double"), printed as an
+  /// OpenCL C literal of the same type (see @link neutrino::literal @endlink). Double constants
+  /// require the "cl_khr_fp64" extension on the client device.
+  template <typename T, typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+  void define (
+               std::string loc_name,                                                                ///< Macro name.
+               T           loc_value                                                                ///< Macro value.
+              )
+  {
+    define (loc_name, neutrino::literal (loc_value));                                               // Setting specialization constant...
+  }
+
+  /// @brief **Class initializer.**
+  /// @details Loads the OpenCL sources from their corresponding source files and builds them into
+  /// a single OpenCL program (or loads it from the program binary cache, see @link
+  /// neutrino::cache @endlink). In case an up to date SPIR-V module precompiled from the sources
+  /// exists (see @link neutrino::load_il @endlink), the program is created from it instead.
+  void init (
+             neutrino*                loc_baseline,                                                 ///< Neutrino baseline.
+             std::string              loc_library_home,                                             ///< Library home directory.
+             std::vector<std::string> loc_library_file_name                                         ///< OpenCL library file names.
+            );
+
+  /// @brief **Class destructor.**
+  /// @details Releases the library reference to the OpenCL program.
+  ~library();
+};
+
+#endif
@@ -0,0 +1,145 @@
+/// @file     native.hpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Declaration of the "native" class.
+///
+/// @details  A Neutrino "native" kernel is a host (C++) implementation of a kernel, running on
+/// the host CPU without any OpenCL runtime. It is given as a C++ callable taking the (i, j, k)
+/// indexes of a work-item, over the same index space of a @link kernel @endlink (size_i, size_j,
+/// size_k), and it works directly on the host "data" arrays of the data classes. The index space
+/// is partitioned into blocks of contiguous work-items (sized to fit in the CPU caches), which
+/// are executed by a pool of worker threads: each worker owns a double-ended queue of blocks,
+/// taken in order from its front, and steals blocks from the back of the queues of the other
+/// workers when its own is empty. This allows running a Neutrino application on any host (e.g.
+/// for debugging) and cross-checking the OpenCL results against a host reference.
+/// It is a standalone utility: it depends on the C++ standard library only (neither on OpenCL
+/// nor on the Neutrino baseline), hence it is not part of the "opencl.hpp" umbrella header and
+/// must be included on its own.
+
+#ifndef native_hpp
+#define native_hpp
+
+#include <stddef.h>
+#include <string>
+#include <vector>
+#include <deque>
+#include <fstream>
+#include <algorithm>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+#define NU_NATIVE_CACHE                   262144                                                    ///< Default native block cache budget (per-core L2 cache size, if not detected) [bytes].
+#define NU_NATIVE_ITEM                    64                                                        ///< Default bytes accessed per native work-item [bytes].
+
+// Native kernel modes (distinct from the OpenCL kernel modes):
+typedef enum
+{
+  NU_NATIVE_WAIT,                                                                                   ///< Native kernel set as blocking mode.
+  NU_NATIVE_DONT_WAIT                                                                               ///< Native kernel set as non-blocking mode.
+} native_mode;
+
+/// @brief    **Data structure. Internally used by Neutrino.**
+/// @details  This structure stores a block of work-items of a native kernel.
+typedef struct _block_structure
+{
+  size_t begin[3];                                                                                  ///< Block beginning (i, j, k).
+  size_t end[3];                                                                                    ///< Block end (i, j, k), excluded.
+} block_structure;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////// "native" class ///////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class native
+/// ### Host kernel.
+/// Declares a host kernel. To be used to run a C++ implementation of a kernel on a
+/// multithreaded host thread pool, without OpenCL.
+class native                                                                                        /// @brief **Host kernel.**
+{
+private:
+  std::function<void (size_t, size_t, size_t)> body;                                                ///< @brief **Kernel body (i, j, k).**
+  std::vector<block_structure>                 tile;                                                ///< @brief **Index space blocks.**
+  std::vector<std::deque<block_structure>>     block;                                               ///< @brief **Worker block queues.**
+  std::vector<std::mutex>                      block_lock;                                          ///< @brief **Worker block queue locks.**
+  std::vector<std::thread>                     worker;                                              ///< @brief **Worker threads.**
+  std::mutex                                   lock;                                                ///< @brief **Thread pool lock.**
+  std::condition_variable                      wakeup;                                              ///< @brief **Worker signal.**
+  std::condition_variable                      finished;                                            ///< @brief **Completion signal.**
+  std::atomic<size_t>                          remaining;                                           ///< @brief **Blocks to be executed [#].**
+  size_t                                       generation;                                          ///< @brief **Execution counter [#].**
+  bool                                         stop;                                                ///< @brief **Worker threads "stop" flag.**
+
+  /// @brief **Block fetch function.**
+  /// @details Takes the next block from the front of the queue of a worker or, in case it is
+  /// empty, steals one from the back of the queue of another worker. It returns false in case no
+  /// block is left.
+  bool next (
+             size_t           loc_worker,                                                           ///< Worker index.
+             block_structure& loc_block                                                             ///< Fetched block.
+            );
+
+  /// @brief **Thread pool halt function.**
+  /// @details Waits for the current execution, if any, then stops and joins the worker threads.
+  void halt ();
+
+  /// @brief **Worker thread function.**
+  /// @details Waits for an execution to be started, then executes blocks until none is left.
+  void work_loop (
+                  size_t loc_worker                                                                 ///< Worker index.
+                 );
+
+public:
+  size_t size_i;                                                                                    ///< @brief **Kernel size (i-index).**
+  size_t size_j;                                                                                    ///< @brief **Kernel size (j-index).**
+  size_t size_k;                                                                                    ///< @brief **Kernel size (k-index).**
+  size_t block_size;                                                                                ///< @brief **Number of work-items per block (0 = from cache_size and item_bytes) [#].**
+  size_t cache_size;                                                                                ///< @brief **Cache budget per block (0 = detected per-core L2 cache size) [bytes].**
+  size_t item_bytes;                                                                                ///< @brief **Bytes accessed per work-item [bytes].**
+  size_t threads;                                                                                   ///< @brief **Number of worker threads (0 = one per hardware thread) [#].**
+
+  /// @brief **Class constructor.**
+  /// @details It resets the kernel sizes, the block size (to be derived from the cache budget),
+  /// the bytes per work-item (to NU_NATIVE_ITEM) and the number of worker threads (to one per
+  /// hardware thread).
+  native ();
+
+  /// @brief **Class initializer.**
+  /// @details Sets the kernel body and sizes, partitions the index space into blocks of
+  /// @link block_size @endlink work-items and starts the worker threads. In case the block size is
+  /// 0, it is derived from a cache budget, so that the data of a block fit in the cache of a core:
+  /// @link cache_size @endlink (or, if 0, the per-core L2 cache size, as reported by Linux, else
+  /// NU_NATIVE_CACHE) divided by @link item_bytes @endlink. The block size, the cache budget, the
+  /// bytes per work-item and the number of threads must be set before calling this method. In
+  /// case the kernel is already initialized, its worker threads are stopped and joined first. The
+  /// blocks are laid out along the
+  /// i-index first, then j and k, so that each block covers contiguous elements of the data
+  /// arrays indexed as i + size_i*(j + size_j*k). A single thread executes the work-items in
+  /// order, which can help debugging.
+  void init (
+             size_t                                       loc_size_i,                               ///< Kernel size (i-index).
+             size_t                                       loc_size_j,                               ///< Kernel size (j-index).
+             size_t                                       loc_size_k,                               ///< Kernel size (k-index).
+             std::function<void (size_t, size_t, size_t)> loc_body                                  ///< Kernel body (i, j, k).
+            );
+
+  /// @brief **Kernel execution function.**
+  /// @details Executes the kernel body on all the work-items of the index space. In
+  /// NU_NATIVE_WAIT mode the calling thread waits for all of them to complete; in
+  /// NU_NATIVE_DONT_WAIT mode it returns at once and the @link wait @endlink method must be called
+  /// before using the results. A new execution always waits for the previous one to complete.
+  void execute (
+                native_mode loc_native_mode                                                         ///< Native kernel mode.
+               );
+
+  /// @brief **Wait function.**
+  /// @details Waits for the current execution, if any, to complete.
+  void wait ();
+
+  /// @brief **Class destructor.**
+  /// @details Waits for the current execution and stops the worker threads.
+  ~native ();
+};
+
+#endif
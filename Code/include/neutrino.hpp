@@ -74,6 +74,36 @@
 #define NU_GAMEPAD_MIN_PAN_RATE           0.01f                                                     ///< Minimum orbit angular rate [rev/s].
 #define NU_GAMEPAD_MAX_PAN_RATE           10.0f                                                     ///< Maximum orbit angular rate [rev/s].
 
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////// DATA PARAMETERS /////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+#define NU_DIRTY_GAP                      64                                                        ///< Maximum gap between merged dirty ranges [#].
+#define NU_DIRTY_MAX_RANGES               4096                                                      ///< Maximum number of dirty ranges before collapsing [#].
+#define NU_STREAM_SLOTS                   4                                                         ///< Default number of snapshot staging buffers [#].
+#define NU_STREAM_MAGIC                   "NUSTREAM"                                                ///< Snapshot stream file signature.
+#define NU_STREAM_VERSION                 1                                                         ///< Snapshot stream file format version.
+#define NU_PROFILER_PENDING               256                                                       ///< Number of pending profiling events before resolving [#].
+#define NU_PROFILER_RESERVOIR             1024                                                      ///< Device time samples kept per profiling entry, for the percentiles [#].
+#define NU_TRACER_PENDING                 256                                                       ///< Number of pending tracing events before resolving [#].
+#define NU_TRACE_HOST                     0                                                         ///< Host track index (trace "tid").
+#define NU_TRACE_DEVICE                   1                                                         ///< Device track index (trace "tid").
+#define NU_CACHE_DIRECTORY                ".nu_cache"                                               ///< OpenCL program binary cache directory (under the kernel home directory).
+#define NU_CACHE_EXTENSION                ".bin"                                                    ///< OpenCL program binary cache file extension.
+#define NU_TUNE_EXTENSION                 ".tune"                                                   ///< Kernel local size autotuner cache file extension.
+#define NU_ARGS_EXTENSION                 ".args"                                                   ///< Kernel argument metadata cache file extension.
+#define NU_TUNE_RUNS                      10                                                        ///< Number of timed runs per autotuner candidate [#].
+#define NU_WATCH_PERIOD                   500                                                       ///< Kernel source watch period [ms].
+#define NU_SPREAD_WEIGHT                  0.5                                                       ///< Weight of the last throughput measurement in multi-device balancing.
+#define NU_PAGE_SIZE                      4096                                                      ///< Host memory page size, NUMA placement granularity [bytes].
+#define NU_DEVICE_POLICY                  "NU_DEVICE"                                               ///< Device selection policy environment variable.
+#define NU_POLICY_FASTEST                 "fastest"                                                 ///< Device selection policy: fastest calibrated device.
+#define NU_CALIBRATION_EXTENSION          ".score"                                                  ///< Device calibration cache file extension.
+#define NU_CALIBRATION_SIZE               1048576                                                   ///< Device calibration micro-kernel size [#].
+#define NU_CALIBRATION_RUNS               5                                                         ///< Number of timed runs per calibration micro-kernel [#].
+#define NU_DEVICE_EXTENSION               ".device"                                                 ///< Device capability cache file extension.
+#define NU_CLUSTER_ROUNDS                 8                                                         ///< Batches per device share in heterogeneous cluster balancing [#].
+#define NU_IL_EXTENSION                   ".spv"                                                    ///< Precompiled SPIR-V (IL) program file extension.
+
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////// ENUMS /////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -99,6 +129,22 @@ typedef enum
   NU_DONT_WAIT                                                                                      ///< OpenCL kernel set as non-blocking mode.
 } kernel_mode;
 
+// Pipeline step types:
+typedef enum
+{
+  NU_STEP_KERNEL,                                                                                   ///< Kernel execution step.
+  NU_STEP_ACQUIRE,                                                                                  ///< OpenCL/GL shared object acquisition step.
+  NU_STEP_RELEASE                                                                                   ///< OpenCL/GL shared object release step.
+} step_type;
+
+// Device partitions:
+typedef enum
+{
+  NU_PARTITION_NONE,                                                                                ///< OpenCL device not partitioned.
+  NU_PARTITION_NUMA,                                                                                ///< OpenCL device partitioned by NUMA affinity domain.
+  NU_PARTITION_EQUALLY                                                                              ///< OpenCL device partitioned in sub-devices of equal compute units.
+} device_partition;
+
 // Compute device types:
 typedef enum
 {
@@ -109,6 +155,21 @@ typedef enum
   NU_ALL                                                                                            ///< OpenCL NU_ALL devices.
 } compute_device_type;
 
+// Data types:
+typedef enum
+{
+  NU_INT1,                                                                                          ///< "int1" data class.
+  NU_INT2,                                                                                          ///< "int2" data class.
+  NU_INT3,                                                                                          ///< "int3" data class.
+  NU_INT4,                                                                                          ///< "int4" data class.
+  NU_FLOAT1,                                                                                        ///< "float1" data class.
+  NU_FLOAT1G,                                                                                       ///< "float1G" data class.
+  NU_FLOAT2,                                                                                        ///< "float2" data class.
+  NU_FLOAT3,                                                                                        ///< "float3" data class.
+  NU_FLOAT4,                                                                                        ///< "float4" data class.
+  NU_FLOAT4G                                                                                        ///< "float4G" data class.
+} data_type;
+
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////// OpenCL/GL interoperability ///////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -136,17 +197,36 @@ typedef enum
 #include <fstream>
 #include <cerrno>
 #include <algorithm>
+#include <thread>
+#include <sstream>
+#include <numeric>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <map>
+#include <cstdio>
+#include <chrono>
+#include <type_traits>
+#include <limits>
+#include <cmath>
 
 #ifdef __APPLE__                                                                                    // Detecting Mac OS...
   #include <math.h>
+  #include <sys/stat.h>
 #endif
 
 #ifdef __linux__                                                                                    // Detecting Linux...
   #include <math.h>
+  #include <sys/stat.h>
+  #include <sched.h>
 #endif
 
 #ifdef WIN32                                                                                        // Detecting Windows...
   #include <windows.h>
+  #include <direct.h>
+  #include <sys/stat.h>
   #define ENABLE_VIRTUAL_TERMINAL_PROCESSING 0x0004                                                 ///< Enabling ANSI terminal in Windows...
   #define DISABLE_NEWLINE_AUTO_RETURN        0x0008                                                 ///< Disabling new line auto return in Windows terminal...
 
@@ -228,6 +308,9 @@ typedef enum
 #include "linear_algebra.hpp"
 #include "projective_geometry.hpp"
 
+class profiler;                                                                                     // Forward declaration (see "profiler.hpp").
+class tracer;                                                                                       // Forward declaration (see "tracer.hpp").
+
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////// "neutrino" class ///////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -243,6 +326,7 @@ private:
 
 public:
   bool           interop;                                                                           ///< @brief **Use OpenCL-OpenGL interop.**
+  bool           headless;                                                                          ///< @brief **Compute-only mode (no OpenGL context).**
   double         tic;                                                                               ///< @brief **Tic time [s].**
   double         toc;                                                                               ///< @brief **Toc time [s].**
   double         loop_time;                                                                         ///< @brief **Loop time [s].**
@@ -251,10 +335,16 @@ public:
   cl_context     context_id;                                                                        ///< @brief **OpenCL context id.**
   cl_platform_id platform_id;                                                                       ///< @brief **OpenCL platform ID.**
   cl_device_id   device_id;                                                                         ///< @brief **OpenCL device id.**
+  std::vector<cl_device_id> device_list;                                                            ///< @brief **OpenCL context device ID array (device_id first).**
+  std::vector<double> placement;                                                                    ///< @brief **NUMA placement shares, one per NUMA sub-device, summing to 1 (empty = none).**
   cl_kernel*     kernel_id;                                                                         ///< @brief **OpenCL kernel ID array.**
+  profiler*      profiling;                                                                         ///< @brief **OpenCL event profiler (NULL = profiling disabled).**
+  tracer*        tracing;                                                                           ///< @brief **Host/device trace recorder (NULL = tracing disabled).**
+  bool           cache;                                                                             ///< @brief **Use OpenCL program binary cache.**
+  std::string    cache_home;                                                                        ///< @brief **Device cache home directory, e.g. the kernel home ("" = no device cache).**
 
   /// @brief **Class constructor.**
-  /// @details Resets interop, tic, toc, loop_time, context_id, platform_id and device_id to their
+  /// @details Resets interop, headless, tic, toc, loop_time, context_id, platform_id and device_id to their
   /// default values.
   neutrino();
 
@@ -283,6 +373,41 @@ public:
   /// It does not measure the execution time of the kernel on the client GPU.
   void        get_toc ();
 
+  /// @brief **OpenGL synchronization function.**
+  /// @details Waits for OpenGL to finish, in case an OpenGL context exists. It does nothing in
+  /// headless (compute-only) mode, see @link opencl::init @endlink.
+  void        gl_finish ();
+
+  /// @brief **Buffer creation function.**
+  /// @details Creates an OpenCL read/write buffer initialized with the given host data. In case
+  /// the device has been partitioned by NUMA affinity domain (see @link opencl::init @endlink),
+  /// the buffer storage is a page aligned host allocation, used in place by the device
+  /// (CL_MEM_USE_HOST_PTR): it is split in slices, proportional to the @link placement @endlink
+  /// shares (i.e. to the multi-device partition of the kernel range, up to the page size), each
+  /// slice being initialized by a host thread pinned to the CPUs of its NUMA node. The memory
+  /// pages are then first touched, hence placed, on the node of the sub-device which works on
+  /// them. The host allocation is freed when the buffer is released.
+  cl_mem      create_buffer (
+                             size_t  loc_size,                                                      ///< Data buffer size [bytes].
+                             void*   loc_data,                                                      ///< Data buffer.
+                             cl_int* loc_error                                                      ///< Error code.
+                            );
+
+  /// @brief **NUMA pinning function.**
+  /// @details Binds the calling thread to the CPUs of a NUMA node, as listed by the operating
+  /// system (Linux only). It does nothing in case the node is not found.
+  void        pin (
+                   size_t loc_node                                                                  ///< NUMA node index.
+                  );
+
+  /// @brief **Host memory release callback.**
+  /// @details It is called by the OpenCL runtime when a buffer created on a host allocation by
+  /// @link create_buffer @endlink is released, and frees the allocation.
+  static void CL_CALLBACK release_host (
+                                        cl_mem loc_buffer,                                          ///< Released buffer.
+                                        void*  loc_data                                             ///< Host allocation.
+                                       );
+
   /// @brief **Loader file function.**
   /// @details Loads a file.
   std::string read_file (
@@ -369,6 +494,183 @@ public:
                          cl_int loc_error                                                           ///< OpenCL Error code.
                         );
 
+  /// @brief **Hash function.**
+  /// @details Returns the 64-bit FNV-1a hash of a text, as a 16-digit hexadecimal string.
+  std::string hash (
+                    std::string loc_text                                                            ///< Text.
+                   );
+
+  /// @brief **Literal function.**
+  /// @details Returns the OpenCL C literal of a number, to be used as a "-D" macro value: integers
+  /// get the "U" suffix when unsigned and the "L" suffix when 64-bit, "float" numbers the "f"
+  /// suffix; floating point numbers are printed exact to the last bit, NaN and infinities as the
+  /// OpenCL C "NAN" and "INFINITY" macros. Long double numbers are printed as double.
+  template <typename T>
+  static std::string literal (
+                              T loc_value                                                           ///< Number.
+                             )
+  {
+    static_assert (std::is_arithmetic<T>::value, "a literal must be a number");
+
+    std::string loc_suffix;                                                                         // Literal suffix.
+    char        loc_text[NU_MAX_TEXT_SIZE];                                                         // Text buffer.
+
+    if constexpr(std::is_integral<T>::value)
+    {
+      loc_suffix = std::string (std::is_unsigned<T>::value ? "U" : "") + ((sizeof(T) > 4) ? "L" : "");
+
+      if(std::is_signed<T>::value && (loc_value == std::numeric_limits<T>::min ()) && (sizeof(T) >= 4))
+      {
+        // The most negative value is not a valid literal (its magnitude does not fit the type):
+        return "(" + std::to_string (loc_value + 1) + loc_suffix + "-1" + loc_suffix + ")";
+      }
+
+      return std::to_string (loc_value) + loc_suffix;
+    }
+    else
+    {
+      if(std::isnan (loc_value))                                                                    // Checking for NaN...
+      {
+        return "NAN";
+      }
+
+      if(std::isinf (loc_value))                                                                    // Checking for infinity...
+      {
+        return (loc_value > 0) ? "INFINITY" : "(-INFINITY)";
+      }
+
+      if(std::is_same<T, float>::value)                                                             // Checking for single precision...
+      {
+        snprintf (loc_text, sizeof(loc_text), "%.9ef", (double)loc_value);                          // Printing exact float literal...
+      }
+      else
+      {
+        snprintf (loc_text, sizeof(loc_text), "%.17e", (double)loc_value);                          // Printing exact double literal...
+      }
+
+      return std::string (loc_text);
+    }
+  }
+
+  /// @brief **Program cache file function.**
+  /// @details Returns the full name of a cache file related to an OpenCL program, computed from
+  /// the hash of the given key (program sources and compiler options), of the device name and of
+  /// the driver version. It creates the cache directory (@link NU_CACHE_DIRECTORY @endlink, under
+  /// the given kernel home directory) in case it does not exist.
+  std::string cache_file (
+                          std::string loc_kernel_home,                                              ///< Kernel home directory.
+                          std::string loc_key,                                                      ///< Cache key (program sources and compiler options).
+                          std::string loc_extension                                                 ///< Cache file extension.
+                         );
+
+  /// @brief **Included headers function.**
+  /// @details Returns the names and the contents of the header files included, by means of
+  /// quoted "#include" directives, by the given source, recursively: to be appended to a cache
+  /// key, so that a change of a header invalidates the cached programs built from it. Headers are
+  /// looked up in the kernel home directory; those not found there (e.g. in "-I" directories
+  /// or system headers, included with angle brackets) are left out of the key.
+  std::string headers (
+                       std::string loc_kernel_home,                                                 ///< Kernel home directory.
+                       std::string loc_source                                                       ///< Program source.
+                      );
+
+  /// @overload cache_file(std::string loc_kernel_home, std::string loc_key, std::string loc_extension, cl_device_id loc_device_id)
+  /// @details Returns the full name of a cache file related to a given device, which might not
+  /// be the current one (e.g. during the device enumeration).
+  std::string cache_file (
+                          std::string  loc_kernel_home,                                             ///< Kernel home directory.
+                          std::string  loc_key,                                                     ///< Cache key.
+                          std::string  loc_extension,                                               ///< Cache file extension.
+                          cl_device_id loc_device_id                                                ///< OpenCL device ID.
+                         );
+
+  /// @brief **Program cache load function.**
+  /// @details Creates an OpenCL program for a single device from a binary cache file and builds
+  /// it. Returns NULL in case the file does not exist or the binary is stale (i.e. it is rejected
+  /// by the driver).
+  cl_program  load_program (
+                            std::string  loc_file_name,                                             ///< Cache file name.
+                            std::string  loc_options,                                               ///< Compiler options.
+                            cl_context   loc_context,                                               ///< OpenCL context.
+                            cl_device_id loc_device_id                                              ///< OpenCL device ID.
+                           );
+
+  /// @brief **Build options function.**
+  /// @details Returns the OpenCL compiler options of a program: the given compiler options, the
+  /// argument metadata option and the specialization constants injected as "-D" macros.
+  std::string build_options (
+                             std::string                        loc_compiler_options,               ///< Compiler options.
+                             std::map<std::string, std::string> loc_constant                        ///< Specialization constants.
+                            );
+
+  /// @brief **Program build function.**
+  /// @details Creates an OpenCL program from the given sources and builds it for the given
+  /// devices of a context. In case the program cache is enabled, a kernel home directory is given
+  /// and the program targets a single device, the program is loaded from the binary cache, or
+  /// saved to it after the build. In case of a build error, it prints the error and the compiler
+  /// log (also returned in "loc_log") and returns NULL: the caller decides whether to exit.
+  cl_program  build_program (
+                             cl_context                loc_context,                                 ///< OpenCL context.
+                             std::vector<cl_device_id> loc_device,                                  ///< OpenCL device IDs.
+                             std::string               loc_kernel_home,                             ///< Kernel home directory ("" = no cache).
+                             std::vector<std::string>  loc_source,                                  ///< Program sources.
+                             std::string               loc_options,                                 ///< Compiler options.
+                             std::string&              loc_log                                      ///< OpenCL JIT compiler log.
+                            );
+
+  /// @brief **IL program load function.**
+  /// @details Creates an OpenCL program from the SPIR-V module precompiled from the kernel
+  /// sources (same name of the last source file, NU_IL_EXTENSION extension, see the
+  /// "nu_add_spirv" CMake function) and builds it, skipping the OpenCL C front-end. Returns NULL
+  /// in case the module does not exist, is older than any of the source files (stale module),
+  /// the compiler options contain preprocessor options ("-D", "-U", "-I": the module has already
+  /// been preprocessed), any device of the context does not support SPIR-V (OpenCL 2.1 or newer)
+  /// or the module is rejected by the driver: the program must then be built from source. SPIR-V
+  /// modules carry no kernel argument metadata (see @link kernel::init @endlink).
+  cl_program  load_il (
+                       std::vector<std::string> loc_source_file_name,                               ///< Kernel source file names.
+                       std::string              loc_options                                         ///< Compiler options.
+                      );
+
+  /// @brief **Program cache save function.**
+  /// @details Saves the binary of a built OpenCL program to a binary cache file.
+  void        save_program (
+                            cl_program  loc_program,                                                ///< OpenCL program.
+                            std::string loc_file_name                                               ///< Cache file name.
+                           );
+
+  /// @brief **Profiling event function.**
+  /// @details Returns the given event pointer in case event profiling or tracing is enabled, NULL
+  /// otherwise. To be passed as the event argument of the OpenCL enqueue functions, so that no
+  /// OpenCL event is created when both are disabled.
+  cl_event*   profile (
+                       cl_event* loc_event                                                          ///< OpenCL event.
+                      );
+
+  /// @brief **Profiling record function.**
+  /// @details Hands an OpenCL event obtained by means of the @link profile @endlink function to
+  /// the profiler and to the tracer, which take its ownership. It does nothing in case the event
+  /// is NULL.
+  void        record (
+                      cl_event    loc_event,                                                        ///< OpenCL event.
+                      std::string loc_name,                                                         ///< Profiling entry name.
+                      size_t      loc_bytes                                                         ///< Transferred data [bytes].
+                     );
+
+  /// @brief **Trace span beginning function.**
+  /// @details Returns the current host time [ns] in case tracing is enabled, 0 otherwise. To be
+  /// called at the beginning of a host API call, in combination with the @link trace_end @endlink
+  /// function at its end.
+  cl_ulong    trace_begin ();
+
+  /// @brief **Trace span end function.**
+  /// @details Appends a host span, from the given beginning time up to now, to the trace. It does
+  /// nothing in case tracing is disabled.
+  void        trace_end (
+                         const char* loc_name,                                                      ///< Span name.
+                         cl_ulong    loc_begin                                                      ///< Beginning time, host clock [ns].
+                        );
+
   /// @brief **OpenCL error check function.**
   /// @details Checks for an OpenCL error code and print it to stdout.
   void        check_error (
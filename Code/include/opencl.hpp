@@ -18,7 +18,25 @@
 #include "platform.hpp"
 #include "device.hpp"
 #include "queue.hpp"
+#include "library.hpp"
 #include "kernel.hpp"
+#include "stream.hpp"
+#include "profiler.hpp"
+#include "tracer.hpp"
+#include "pingpong.hpp"
+#include "pipeline.hpp"
+#include "cluster.hpp"
+#include "ensemble.hpp"
+
+/// @brief    **Data structure. Internally used by Neutrino.**
+/// @details  This structure stores a kernel partition executed on a device of a multi-device
+/// context, whose timing has not been read yet.
+typedef struct _partition_structure
+{
+  cl_event event;                                                                                   ///< Partition event.
+  size_t   device;                                                                                  ///< Device index.
+  size_t   count;                                                                                   ///< Partition size along the last dimension [#].
+} partition_structure;
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////// "opencl" class /////////////////////////////////////////////
@@ -33,6 +51,13 @@ private:
   neutrino*      baseline;                                                                          ///< @brief **Neutrino baseline.**
   cl_device_type device_type;                                                                       ///< @brief **OpenCL device type.**
   std::string    device_type_text;                                                                  ///< @brief **OpenCL device text description.**
+  std::vector<queue*>                   device_queue;                                               ///< @brief **Device queue array (multi-device mode, NULL = application queue).**
+  bool                                  shared_memory;                                              ///< @brief **Shared memory flag (context devices are sub-devices of the same device).**
+  std::vector<double>                   device_weight;                                              ///< @brief **Device nominal throughput array (compute units times clock).**
+  std::vector<double>                   device_rate;                                                ///< @brief **Device measured throughput array (0 = not measured) [work-items/ns].**
+  std::map<cl_mem, std::vector<cl_mem>> replica;                                                    ///< @brief **Device replica buffer map (original buffer, replica array).**
+  std::vector<kernel*>                  unpartitioned;                                              ///< @brief **Kernels whose outputs cannot be partitioned (already warned).**
+  std::vector<partition_structure>      pending;                                                    ///< @brief **Partitions whose timing has not been read yet.**
 
   /// @brief **get_platforms_number** function.
   /// @details It gets the number of OpenCL platforms found on the host PC.
@@ -59,6 +84,112 @@ private:
                                 cl_uint loc_platform_index                                          ///< Platform ID.
                                );
 
+  /// @brief **calibrate** function.
+  /// @details It runs a memory bandwidth (float4 copy) and an arithmetic throughput (multiply-add
+  /// chain) micro-kernel on a device, in a temporary context, and returns the geometric mean of
+  /// the two measurements (GB/s times GFLOP/s), 0 in case the device cannot run them. The
+  /// measurements are cached per platform, device and driver version, in the cache directory
+  /// under @link neutrino::cache_home @endlink (unless it is empty or @link neutrino::cache
+  /// @endlink is false).
+  double         calibrate (
+                            cl_uint      loc_platform_index,                                        ///< Platform index.
+                            cl_device_id loc_device_id                                              ///< Device ID.
+                           );
+
+  /// @brief **choose** function.
+  /// @details It scans the devices of the requested type on all platforms and chooses one
+  /// according to a selection policy: either NU_POLICY_FASTEST (the device with the best
+  /// calibration score, see @link calibrate @endlink) or a text pattern, matched (case
+  /// insensitive) against the device name, vendor and type ("cpu", "gpu" or "accelerator"): the
+  /// first matching device is chosen. It sets the @link selected_platform @endlink and returns
+  /// the index of the chosen device on it. It exits in case no device fulfils the policy.
+  cl_uint        choose (
+                         std::string loc_policy                                                     ///< Device selection policy.
+                        );
+
+  /// @brief **launch** function.
+  /// @details It enqueues a kernel on a queue, according to its global and local sizes, without
+  /// any synchronization. It returns the OpenCL error code.
+  cl_int         launch (
+                         kernel*   loc_kernel,                                                      ///< OpenCL kernel.
+                         queue*    loc_queue,                                                       ///< OpenCL queue.
+                         cl_event* loc_event                                                        ///< Kernel event (NULL = none).
+                        );
+
+  /// @overload launch(kernel* loc_kernel, queue* loc_queue, cl_event* loc_event, size_t loc_offset, size_t loc_count)
+  /// @details It enqueues a chunk of a kernel range: "loc_count" work-items (0 = whole range)
+  /// along the last dimension of the kernel, starting from the global offset "loc_offset".
+  cl_int         launch (
+                         kernel*   loc_kernel,                                                      ///< OpenCL kernel.
+                         queue*    loc_queue,                                                       ///< OpenCL queue.
+                         cl_event* loc_event,                                                       ///< Kernel event (NULL = none).
+                         size_t    loc_offset,                                                      ///< Global offset along the last dimension [#].
+                         size_t    loc_count                                                        ///< Global size along the last dimension (0 = whole range) [#].
+                        );
+
+  /// @brief **collect** function.
+  /// @details It reads the timing of the completed partitions of the previous @link spread
+  /// @endlink calls, updates the measured throughput of their devices and releases their events.
+  /// In case "loc_wait" is false, the partitions not completed yet are left for the next call.
+  void           collect (
+                          bool loc_wait                                                             ///< Wait flag.
+                         );
+
+  /// @brief **spread** function.
+  /// @details It executes a kernel across all the devices of a multi-device context: its range is
+  /// split along the last dimension proportionally to the measured throughput of each device
+  /// (or to its compute units times clock frequency, until all devices have been measured). The
+  /// input buffers are shared; the output buffers (see @link kernel::output @endlink) are
+  /// replicated on the secondary devices: only the partition of each device is refreshed before,
+  /// and merged back into the original buffers after, the execution, on the primary queue. The
+  /// kernel must therefore write (and read back) its outputs only within the partition of its own
+  /// work-items. All the dependencies are expressed by events: the secondary devices wait for a
+  /// marker of the previous commands of the primary queue, the merge waits for their partitions,
+  /// and the host is never blocked. The throughputs of a call are read by the following ones (see
+  /// @link collect @endlink), so that the balancing lags one execution behind. In case an output
+  /// buffer is not laid out per index along the last dimension, the whole range runs on the
+  /// primary device. In case the devices are sub-devices of the same device, they share its
+  /// memory: the output buffers are written in place, without any replica nor merge, and each
+  /// partition waits for the previous one, as OpenCL does not define concurrent writes to the same
+  /// buffer from different queues. In NU_PARTITION_NUMA mode the partitions follow the NUMA
+  /// placement shares of the buffers, instead of the measured throughputs. Only the primary device
+  /// partition is traced, as the secondary device timestamps are on different clocks. It returns
+  /// the OpenCL error code of the completion event, a marker on the primary queue, after the merge.
+  cl_int         spread (
+                         kernel*   loc_kernel,                                                      ///< OpenCL kernel.
+                         queue*    loc_queue,                                                       ///< OpenCL queue (primary device).
+                         cl_event* loc_event                                                        ///< Completion event.
+                        );
+
+  /// @brief **completion** callback.
+  /// @details It is called by the OpenCL runtime, on one of its own threads, when the event of a
+  /// kernel execution registered by the callback @link execute @endlink overload is complete. It
+  /// invokes the host function given to @link execute @endlink and then deletes it.
+  static void CL_CALLBACK completion (
+                                     cl_event loc_event,                                            ///< Kernel event.
+                                     cl_int   loc_status,                                           ///< Kernel event execution status.
+                                     void*    loc_data                                              ///< Host function.
+                                    );
+
+  /// @brief **benchmark** function.
+  /// @details It measures the execution time of NU_TUNE_RUNS launches of a kernel, after a
+  /// warm-up launch. It returns -1 in case the launch is rejected by the driver.
+  double         benchmark (
+                            kernel* loc_kernel,                                                     ///< OpenCL kernel.
+                            queue*  loc_queue                                                       ///< OpenCL queue.
+                           );
+
+  /// @brief **setup** function.
+  /// @details It initializes the OpenCL context, see the @link init @endlink overloads.
+  void           setup (
+                        neutrino*           loc_baseline,                                           ///< Neutrino baseline.
+                        opengl*             loc_gui,                                                ///< Neutrino graphics user interface (NULL = headless).
+                        compute_device_type loc_device_type,                                        ///< Compute device type.
+                        bool                loc_multi_device,                                       ///< Multi-device flag.
+                        device_partition    loc_partition,                                          ///< Device partition.
+                        cl_uint             loc_units                                               ///< Compute units per sub-device (NU_PARTITION_EQUALLY) [#].
+                       );
+
 public:
   cl_uint                platforms_number;                                                          ///< @brief **Existing OpenCL platforms number.**
   cl_uint                selected_platform;                                                         ///< @brief **Selected platform index.**
@@ -69,6 +200,8 @@ public:
   device**               opencl_device;                                                             ///< @brief **OpenCL device array.**
 
   cl_context_properties* properties;                                                                ///< @brief ** OpenCL context properties.**
+  bool                   quiet;                                                                     ///< @brief **Quiet startup flag (no platform and device property listing).**
+  std::string            policy;                                                                    ///< @brief **Device selection policy (empty = ask, see @link choose @endlink and NU_DEVICE_POLICY).**
   cl_context             context_id;                                                                ///< @brief **OpenCL context ID.**
 
   /// @brief **Class constructor.**
@@ -82,12 +215,63 @@ public:
   /// platform and lists its extensions, it sets the OpenCL device and lists its extensions,
   /// it identifies the operating system of hte host PC and it creates the OpenCL context.
   /// The OpenCL context must be created after the OpenGL context.
+  /// In case the gui is NULL, Neutrino runs in headless (compute-only) mode: no OpenGL context is
+  /// required, the OpenCL context is created without OpenGL properties, all OpenGL
+  /// synchronizations are skipped and the float1G/float4G objects fall back to plain OpenCL
+  /// buffers (see @link queue::acquire @endlink).
+  /// In case several platforms or devices exist, the user is asked to select one, unless a device
+  /// selection @link policy @endlink is set (before calling this method) or given by the
+  /// NU_DEVICE_POLICY environment variable, which takes precedence: e.g. "NU_DEVICE=fastest"
+  /// chooses the fastest calibrated device, "NU_DEVICE=nvidia" the first NVIDIA device. This
+  /// allows unattended (batch) runs.
+  /// Only the identity properties of the devices are queried, unless their detailed properties
+  /// are listed (i.e. @link quiet @endlink is false) or needed (the selected device): see @link
+  /// device::query @endlink.
   void init (
              neutrino*           loc_baseline,                                                      ///< Neutrino baseline.
-             opengl*             loc_gui,                                                           ///< Neutrino graphics user interface.
+             opengl*             loc_gui,                                                           ///< Neutrino graphics user interface (NULL = headless).
              compute_device_type loc_device_type                                                    ///< Compute device type.
             );
 
+  /// @overload init(neutrino* loc_baseline, opengl* loc_gui, compute_device_type loc_device_type, bool loc_multi_device)
+  /// @details In case the multi-device flag is set, the OpenCL context is created over all the
+  /// available devices of the given type on the selected platform, without asking to select one:
+  /// the first device is the primary one (the one of the application queues), the others get
+  /// their own queues and the @link execute @endlink method splits each kernel execution across
+  /// all of them (see @link spread @endlink). In this mode the OpenCL/GL interoperability and the
+  /// program binary cache are disabled. The kernel argument metadata are needed in order to find
+  /// the output buffers of the kernels; each output buffer must be laid out along the last
+  /// dimension of the kernel (e.g. one element per work-item). The multi-step @link execute
+  /// @endlink also splits each execution; the @link tune @endlink function only uses the primary
+  /// device, while the @link advance @endlink function and the kernel steps of the @link pipeline
+  /// @endlink are not available (the application exits with an error).
+  void init (
+             neutrino*           loc_baseline,                                                      ///< Neutrino baseline.
+             opengl*             loc_gui,                                                           ///< Neutrino graphics user interface (NULL = headless).
+             compute_device_type loc_device_type,                                                   ///< Compute device type.
+             bool                loc_multi_device                                                   ///< Multi-device flag.
+            );
+
+  /// @overload init(neutrino* loc_baseline, opengl* loc_gui, compute_device_type loc_device_type, device_partition loc_partition, cl_uint loc_units)
+  /// @details The selected device is partitioned into sub-devices (see @link device::partition
+  /// @endlink): one per NUMA node (NU_PARTITION_NUMA, e.g. one per CPU socket) or of "loc_units"
+  /// compute units each (NU_PARTITION_EQUALLY). The OpenCL context is created over the
+  /// sub-devices, each one getting its own queue, and the @link execute @endlink method splits
+  /// each kernel execution across all of them as in the multi-device mode. As the sub-devices
+  /// share the memory of their device, the output buffers are written in place (the partitions
+  /// being executed one after the other) and no argument metadata are needed. In
+  /// NU_PARTITION_NUMA mode, the storage of each data object is also placed across the NUMA nodes,
+  /// proportionally to the nominal weight of each sub-device, by host threads pinned to each node
+  /// (see @link neutrino::create_buffer @endlink): each sub-device then works on memory local to
+  /// its own socket. In case the device cannot be partitioned, the whole device is used.
+  void init (
+             neutrino*           loc_baseline,                                                      ///< Neutrino baseline.
+             opengl*             loc_gui,                                                           ///< Neutrino graphics user interface (NULL = headless).
+             compute_device_type loc_device_type,                                                   ///< Compute device type.
+             device_partition    loc_partition,                                                     ///< Device partition.
+             cl_uint             loc_units                                                          ///< Compute units per sub-device (NU_PARTITION_EQUALLY) [#].
+            );
+
   /// @brief Kernel execution function.
   /// @details This function invokes the execution of an [OpenCL kernel]
   /// (https://en.wikipedia.org/wiki/OpenCL#OpenCL_C_language) on an OpenCL @link queue @endlink .
@@ -104,12 +288,86 @@ public:
   /// Inside a kernel instead, notice there are memory [barriers]
   /// (https://www.khronos.org/registry/OpenCL/sdk/1.0/docs/man/xhtml/barrier.html) in order to
   /// synchronize different OpenCL work-items within a given OpenCL work-group.
+  /// Both modes keep the order of the executions on the same queue, without any host
+  /// synchronization: in NU_DONT_WAIT mode the execution is only flushed to the device and the
+  /// host returns at once.
   void execute (
                 kernel*     loc_kernel,                                                             ///< OpenCL kernel.
                 queue*      loc_queue,                                                              ///< OpenCL queue.
                 kernel_mode loc_kernel_mode                                                         ///< OpenCL kernel mode.
                );
 
+  /// @overload execute(kernel* loc_kernel, queue* loc_queue, std::function<void (cl_int)> loc_callback)
+  /// @details This function enqueues a kernel execution and returns at once, without waiting for
+  /// it: the execution is only flushed to the device. When it is complete, the host function
+  /// "loc_callback" is called with its execution status (CL_COMPLETE or a negative error code).
+  /// Meanwhile, the calling thread can prepare the next step or poll the UI events. Notice the
+  /// function is called on a thread of the OpenCL runtime: it must not call blocking OpenCL
+  /// functions and it must synchronize its accesses to the host data (e.g. by setting an
+  /// std::atomic flag). The @link wait @endlink function blocks until the execution is complete.
+  void execute (
+                kernel*                      loc_kernel,                                            ///< OpenCL kernel.
+                queue*                       loc_queue,                                             ///< OpenCL queue.
+                std::function<void (cl_int)> loc_callback                                           ///< Completion host function.
+               );
+
+  /// @overload execute(kernel* loc_kernel, queue* loc_queue, kernel_mode loc_kernel_mode, size_t loc_steps, pingpong* loc_pingpong)
+  /// @details This function enqueues "loc_steps" consecutive executions of a kernel back-to-back,
+  /// synchronizing OpenGL and OpenCL only once before the first one and, according to the kernel
+  /// mode, once after the last one. It is meant for small kernels, whose execution time would
+  /// otherwise be dominated by the host launch overhead (e.g. substep loops). In case a @link
+  /// pingpong @endlink is given (otherwise NULL), it is swapped after each execution, as calling
+  /// @link execute @endlink and @link pingpong::swap @endlink "loc_steps" times would do.
+  /// In NU_DONT_WAIT mode the executions are only flushed to the device. In multi-device mode,
+  /// each execution is split across the devices (see @link spread @endlink) and only the device
+  /// partitions are profiled.
+  void execute (
+                kernel*     loc_kernel,                                                             ///< OpenCL kernel.
+                queue*      loc_queue,                                                              ///< OpenCL queue.
+                kernel_mode loc_kernel_mode,                                                        ///< OpenCL kernel mode.
+                size_t      loc_steps,                                                              ///< Number of executions [#].
+                pingpong*   loc_pingpong                                                            ///< Pingpong swapped after each execution (NULL = none).
+               );
+
+  /// @brief Kernel wait function.
+  /// @details This function blocks the host until the last execution of a kernel, enqueued by any
+  /// of the @link execute @endlink overloads, is complete.
+  void wait (
+             kernel* loc_kernel                                                                     ///< OpenCL kernel.
+            );
+
+  /// @brief Chunked kernel execution function.
+  /// @details This function executes the next chunk of the range of a kernel, by means of a
+  /// global work offset: the chunk covers "loc_chunk" work-items along the last dimension of the
+  /// kernel (e.g. rows, for a 2D kernel), rounded up to a multiple of the local size if set
+  /// explicitly. The host waits for the chunk to complete. It returns true when the last chunk of
+  /// the range has been executed: the next call starts again from the beginning of the range.
+  /// Calling it once per frame of the render loop keeps the display interactive during long
+  /// computations and keeps each launch below the driver watchdog limits; calling it in a loop
+  /// until it returns true executes the whole range without yielding. The kernel must use
+  /// get_global_id (not get_group_id*get_local_size) in order to see the global offset. It is
+  /// not available in multi-device mode: the chunk offsets would collide with the device
+  /// partitions, hence the application exits with an error.
+  bool advance (
+                kernel* loc_kernel,                                                                 ///< OpenCL kernel.
+                queue*  loc_queue,                                                                  ///< OpenCL queue.
+                size_t  loc_chunk                                                                   ///< Chunk size along the last dimension [#].
+               );
+
+  /// @brief Kernel local size autotuner function.
+  /// @details This function benchmarks the candidate local sizes of a kernel (divisors of the
+  /// global size along each dimension, so that the global size is never padded, within the device
+  /// maximum work-item sizes, the kernel CL_KERNEL_WORK_GROUP_SIZE and above its
+  /// CL_KERNEL_PREFERRED_WORK_GROUP_SIZE_MULTIPLE), together with the driver choice, and sets the
+  /// fastest one in the @link kernel::local_i @endlink, @link kernel::local_j @endlink and @link
+  /// kernel::local_k @endlink kernel variables. The choice is saved in the cache directory, per
+  /// device, kernel source and global size, and reloaded by the subsequent runs without any
+  /// benchmark. Notice the kernel is executed several times with its current arguments.
+  void tune (
+             kernel* loc_kernel,                                                                    ///< OpenCL kernel.
+             queue*  loc_queue                                                                      ///< OpenCL queue.
+            );
+
   /// @brief **Class destructor.**
   /// @details It deletes the OpenCL device, platform and context.
   ~opencl();
@@ -0,0 +1,147 @@
+/// @file     pingpong.hpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Declaration of the "pingpong" class.
+///
+/// @details  A Neutrino "pingpong" groups two (or more) data objects of the same type holding
+/// consecutive states of an iterative computation: e.g. the first one holds state N, read by a
+/// kernel, while the second one receives state N+1, written by the same kernel. Instead of
+/// re-setting the kernel arguments at each step, the "swap" method rotates the OpenCL buffers
+/// (and the OpenGL VAO/VBO, for float1G and float4G objects) among the data objects in O(1) and
+/// rebinds them on all the kernels bound to the pingpong, without any host synchronization or
+/// terminal message. After a swap, the first data object holds the most recent state.
+/// With three data objects (triple buffering), the last one holds the previous state: it can be
+/// rendered while the other two are being computed.
+
+#ifndef pingpong_hpp
+#define pingpong_hpp
+
+#include "neutrino.hpp"
+#include "data_classes.hpp"
+#include "kernel.hpp"
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// "pingpong" class //////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class pingpong
+/// ### Multiple-buffered data object.
+/// Declares a multiple-buffered data object. To be used to swap the states of an iterative
+/// computation between kernel executions.
+class pingpong                                                                                      /// @brief **Multiple-buffered data object.**
+{
+private:
+  neutrino*             baseline;                                                                   ///< @brief **Neutrino baseline.**
+  std::vector<cl_mem*>  buffer;                                                                     ///< @brief **Data buffer pointer array.**
+  std::vector<GLuint*>  vao;                                                                        ///< @brief **OpenGL VAO pointer array (NULL = none).**
+  std::vector<GLuint*>  vbo;                                                                        ///< @brief **OpenGL VBO pointer array (NULL = none).**
+  std::vector<cl_uint>  layout;                                                                     ///< @brief **Layout index array.**
+  std::vector<kernel*>  bound;                                                                      ///< @brief **Bound kernel array.**
+
+  /// @brief **Add function.**
+  /// @details Adds a data object to the pingpong, checking that its OpenCL buffer has already
+  /// been created by the @link kernel::setarg @endlink method.
+  void add (
+            bool     loc_ready,                                                                     ///< Data object "ready" flag.
+            cl_mem*  loc_buffer,                                                                    ///< Data buffer.
+            GLuint*  loc_vao,                                                                       ///< OpenGL VAO (NULL = none).
+            GLuint*  loc_vbo,                                                                       ///< OpenGL VBO (NULL = none).
+            cl_uint  loc_layout_index                                                               ///< Layout index.
+           );
+
+public:
+  /// @brief **Class constructor.**
+  /// @details It resets the Neutrino baseline.
+  pingpong ();
+
+  /// @brief **Class initializer.**
+  /// @details Groups the given data objects, which must have already been set as arguments of a
+  /// kernel by means of the @link kernel::setarg @endlink method (each one with its own layout
+  /// index). At least two data objects of the same type and size are required.
+  void init (
+             neutrino*          loc_baseline,                                                       ///< Neutrino baseline.
+             std::vector<int1*> loc_data                                                            ///< int1 objects.
+            );
+
+  /// @overload init(neutrino* loc_baseline, std::vector<int2*> loc_data)
+  /// @details Groups the given data objects.
+  void init (
+             neutrino*          loc_baseline,                                                       ///< Neutrino baseline.
+             std::vector<int2*> loc_data                                                            ///< int2 objects.
+            );
+
+  /// @overload init(neutrino* loc_baseline, std::vector<int3*> loc_data)
+  /// @details Groups the given data objects.
+  void init (
+             neutrino*          loc_baseline,                                                       ///< Neutrino baseline.
+             std::vector<int3*> loc_data                                                            ///< int3 objects.
+            );
+
+  /// @overload init(neutrino* loc_baseline, std::vector<int4*> loc_data)
+  /// @details Groups the given data objects.
+  void init (
+             neutrino*          loc_baseline,                                                       ///< Neutrino baseline.
+             std::vector<int4*> loc_data                                                            ///< int4 objects.
+            );
+
+  /// @overload init(neutrino* loc_baseline, std::vector<float1*> loc_data)
+  /// @details Groups the given data objects.
+  void init (
+             neutrino*            loc_baseline,                                                     ///< Neutrino baseline.
+             std::vector<float1*> loc_data                                                          ///< float1 objects.
+            );
+
+  /// @overload init(neutrino* loc_baseline, std::vector<float1G*> loc_data)
+  /// @details Groups the given data objects.
+  void init (
+             neutrino*             loc_baseline,                                                    ///< Neutrino baseline.
+             std::vector<float1G*> loc_data                                                         ///< float1G objects.
+            );
+
+  /// @overload init(neutrino* loc_baseline, std::vector<float2*> loc_data)
+  /// @details Groups the given data objects.
+  void init (
+             neutrino*            loc_baseline,                                                     ///< Neutrino baseline.
+             std::vector<float2*> loc_data                                                          ///< float2 objects.
+            );
+
+  /// @overload init(neutrino* loc_baseline, std::vector<float3*> loc_data)
+  /// @details Groups the given data objects.
+  void init (
+             neutrino*            loc_baseline,                                                     ///< Neutrino baseline.
+             std::vector<float3*> loc_data                                                          ///< float3 objects.
+            );
+
+  /// @overload init(neutrino* loc_baseline, std::vector<float4*> loc_data)
+  /// @details Groups the given data objects.
+  void init (
+             neutrino*            loc_baseline,                                                     ///< Neutrino baseline.
+             std::vector<float4*> loc_data                                                          ///< float4 objects.
+            );
+
+  /// @overload init(neutrino* loc_baseline, std::vector<float4G*> loc_data)
+  /// @details Groups the given data objects.
+  void init (
+             neutrino*             loc_baseline,                                                    ///< Neutrino baseline.
+             std::vector<float4G*> loc_data                                                         ///< float4G objects.
+            );
+
+  /// @brief **Bind function.**
+  /// @details Registers a kernel whose arguments must follow the swaps of the pingpong. The data
+  /// objects are rebound at their layout indexes.
+  void bind (
+             kernel* loc_kernel                                                                     ///< OpenCL kernel.
+            );
+
+  /// @brief **Swap function.**
+  /// @details Rotates the OpenCL buffers (and OpenGL VAO/VBO, if any) among the data objects, so
+  /// that each one takes the buffer of the next one, and rebinds them on all the bound kernels.
+  /// It does not synchronize the host, neither print messages. The host data storages are not
+  /// rotated.
+  void swap ();
+
+  /// @brief **Class destructor.**
+  /// @details Does not release the buffers, which still belong to the data objects.
+  ~pingpong();
+};
+
+#endif
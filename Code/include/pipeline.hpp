@@ -0,0 +1,151 @@
+/// @file     pipeline.hpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Declaration of the "pipeline" class.
+///
+/// @details  A Neutrino "pipeline" records once an ordered sequence of steps of an application
+/// frame (e.g. acquire, execute kernel A, B and C, release) on a single OpenCL queue, and replays
+/// the whole sequence by means of one call of its "run" method. All the launch parameters (kernel
+/// dimension, global and local sizes, profiling names) are computed at recording time, so that the
+/// replay only enqueues the OpenCL commands: no memory allocation, no terminal message and no
+/// host synchronization take place between the steps. The dependencies between the steps are
+/// those implied by the in-order OpenCL queue; OpenGL is only synchronized once before the first
+/// acquire and once after the last release of the sequence.
+/// The kernel sizes (and local sizes, see @link opencl::tune @endlink) must be final at recording
+/// time. The kernel arguments are not recorded: they keep being those currently set on the kernels
+/// (e.g. by a @link pingpong @endlink swap or a by-value @link kernel::setarg @endlink).
+
+#ifndef pipeline_hpp
+#define pipeline_hpp
+
+#include "neutrino.hpp"
+#include "data_classes.hpp"
+#include "queue.hpp"
+#include "kernel.hpp"
+#include "pingpong.hpp"
+
+/// @brief    **Data structure. Internally used by Neutrino.**
+/// @details  This structure stores a single recorded step of a pipeline.
+typedef struct _step_structure
+{
+  step_type   type;                                                                                 ///< Step type.
+  kernel*     step_kernel;                                                                          ///< Kernel (NU_STEP_KERNEL).
+  cl_uint     dimension;                                                                            ///< Kernel dimension (NU_STEP_KERNEL).
+  size_t      global[3];                                                                            ///< Global size array (NU_STEP_KERNEL).
+  size_t      local[3];                                                                             ///< Local size array (NU_STEP_KERNEL).
+  bool        explicit_local;                                                                       ///< Explicit local size flag (NU_STEP_KERNEL).
+  float1G*    data1G;                                                                               ///< float1G object (NULL = none).
+  float4G*    data4G;                                                                               ///< float4G object (NULL = none).
+  cl_mem*     buffer;                                                                               ///< Shared buffer (acquire/release).
+  GLuint*     vbo;                                                                                  ///< Shared OpenGL VBO (acquire/release).
+  GLint       components;                                                                           ///< Number of components of the shared data (acquire/release).
+  GLuint      layout;                                                                               ///< OpenGL shader layout index (acquire/release).
+  std::string name;                                                                                 ///< Profiling entry name.
+  size_t      bytes;                                                                                ///< Profiling transferred data [bytes].
+} step_structure;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// "pipeline" class //////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class pipeline
+/// ### Recorded sequence of OpenCL steps.
+/// Declares a recorded sequence of OpenCL steps. To be used to replay the fixed sequence of
+/// kernel executions and OpenCL/GL transfers of each application frame with one call.
+class pipeline                                                                                      /// @brief **Recorded sequence of OpenCL steps.**
+{
+private:
+  neutrino*                   baseline;                                                             ///< @brief **Neutrino baseline.**
+  queue*                      pipeline_queue;                                                       ///< @brief **Pipeline OpenCL queue.**
+  std::vector<step_structure> step;                                                                 ///< @brief **Recorded steps.**
+  bool                        shared;                                                               ///< @brief **OpenCL/GL shared objects flag.**
+
+  /// @brief **Shared step function.**
+  /// @details Records an acquire or release step of an OpenCL/GL shared data object.
+  void add_shared (
+                   step_type loc_type,                                                              ///< Step type.
+                   float1G*  loc_data1G,                                                            ///< float1G object (NULL = none).
+                   float4G*  loc_data4G,                                                            ///< float4G object (NULL = none).
+                   GLuint    loc_layout_index                                                       ///< OpenGL shader layout index.
+                  );
+
+  /// @brief **Enqueue function.**
+  /// @details Enqueues a single recorded step, without any synchronization.
+  void enqueue (
+                step_structure& loc_step                                                            ///< Recorded step.
+               );
+
+public:
+  /// @brief **Class constructor.**
+  /// @details It resets the Neutrino baseline and the pipeline queue.
+  pipeline ();
+
+  /// @brief **Class initializer.**
+  /// @details Sets the OpenCL queue on which the pipeline is recorded and replayed.
+  void init (
+             neutrino* loc_baseline,                                                                ///< Neutrino baseline.
+             queue*    loc_queue                                                                    ///< OpenCL queue.
+            );
+
+  /// @brief **Kernel step recording function.**
+  /// @details Appends a kernel execution to the pipeline, precomputing its launch parameters.
+  /// The steps are replayed on the pipeline queue only, hence kernel steps are not available
+  /// over a multi-device context: in that case the application exits with an error.
+  void execute (
+                kernel* loc_kernel                                                                  ///< OpenCL kernel.
+               );
+
+  /// @brief **Acquire step recording function.**
+  /// @details Appends the acquisition of an OpenCL/GL shared data object to the pipeline (see
+  /// @link queue::acquire @endlink).
+  void acquire (
+                float1G* loc_data,                                                                  ///< Data object.
+                GLuint   loc_layout_index                                                           ///< OpenGL shader layout index.
+               );
+
+  /// @overload acquire(float4G* loc_data, GLuint loc_layout_index)
+  /// @details Appends the acquisition of an OpenCL/GL shared data object to the pipeline.
+  void acquire (
+                float4G* loc_data,                                                                  ///< Data object.
+                GLuint   loc_layout_index                                                           ///< OpenGL shader layout index.
+               );
+
+  /// @brief **Release step recording function.**
+  /// @details Appends the release of an OpenCL/GL shared data object to the pipeline (see @link
+  /// queue::release @endlink).
+  void release (
+                float1G* loc_data,                                                                  ///< Data object.
+                GLuint   loc_layout_index                                                           ///< OpenGL shader layout index.
+               );
+
+  /// @overload release(float4G* loc_data, GLuint loc_layout_index)
+  /// @details Appends the release of an OpenCL/GL shared data object to the pipeline.
+  void release (
+                float4G* loc_data,                                                                  ///< Data object.
+                GLuint   loc_layout_index                                                           ///< OpenGL shader layout index.
+               );
+
+  /// @brief **Replay function.**
+  /// @details Enqueues all the recorded steps, in order, without any synchronization between
+  /// them. In NU_WAIT mode, the host waits for the whole sequence to complete. In NU_DONT_WAIT
+  /// mode the commands are only flushed to the device, unless the pipeline releases OpenCL/GL
+  /// shared objects: in that case OpenCL must complete before OpenGL can use them.
+  void run (
+            kernel_mode loc_kernel_mode                                                             ///< OpenCL kernel mode.
+           );
+
+  /// @overload run(kernel_mode loc_kernel_mode, size_t loc_steps, pingpong* loc_pingpong)
+  /// @details Replays the recorded steps "loc_steps" times back-to-back, synchronizing OpenGL and
+  /// OpenCL only once for the whole replay. In case a @link pingpong @endlink is given (otherwise
+  /// NULL), it is swapped after each replay of the sequence.
+  void run (
+            kernel_mode loc_kernel_mode,                                                            ///< OpenCL kernel mode.
+            size_t      loc_steps,                                                                  ///< Number of replays [#].
+            pingpong*   loc_pingpong                                                                ///< Pingpong swapped after each replay (NULL = none).
+           );
+
+  /// @brief **Class destructor.**
+  /// @details Clears the recorded steps.
+  ~pipeline();
+};
+
+#endif
@@ -58,6 +58,7 @@ public:
   /// @details It gets all information about the selected OpenCL platform and store it in the
   /// corresponding public variables.
   void init (
+             neutrino*      loc_baseline,                                                           ///< Neutrino baseline.
              cl_platform_id loc_platform_id                                                         ///< Platform ID.
             );
 
@@ -0,0 +1,139 @@
+/// @file     profiler.hpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Declaration of the "profiler" class.
+///
+/// @details  A Neutrino "profiler" collects the OpenCL event profiling information (QUEUED,
+/// SUBMIT, START and END timestamps) of every kernel execution and data transfer enqueued on the
+/// OpenCL queues. The measurements are aggregated by name (kernel name, or transfer type and
+/// layout index) into statistics: number of executions, mean, median (p50) and 99th percentile
+/// (p99) device time, mean host latency (QUEUED to SUBMIT: the command waits in the host queue
+/// until flushed to the device), mean device latency (SUBMIT to START: the command waits on the
+/// device for the previous ones) and achieved bandwidth, computed from the sizes of the
+/// data objects involved. The statistics are printed on the terminal when the profiler is deleted
+/// and can be saved to a CSV file. The profiler must be initialized before the @link queue
+/// @endlink objects, since the profiling must be enabled on the OpenCL queues at their creation.
+/// When no profiler is initialized, no OpenCL events are created for profiling purposes.
+
+#ifndef profiler_hpp
+#define profiler_hpp
+
+#include "neutrino.hpp"
+
+/// @brief    **Data structure. Internally used by Neutrino.**
+/// @details  This structure stores the running aggregates of a statistics entry, together with a
+/// bounded reservoir of its device times for the percentiles.
+typedef struct _entry_structure
+{
+  size_t              count;                                                                        ///< Number of samples [#].
+  double              total;                                                                        ///< Total device time [ns].
+  double              queued;                                                                       ///< Total host latency (QUEUED to SUBMIT) [ns].
+  double              submitted;                                                                    ///< Total device latency (SUBMIT to START) [ns].
+  double              bytes;                                                                        ///< Total transferred data [bytes].
+  std::vector<double> reservoir;                                                                    ///< Device time samples (at most NU_PROFILER_RESERVOIR) [ns].
+} entry_structure;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// "profiler" class //////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class profiler
+/// ### OpenCL event profiler.
+/// Declares an OpenCL event profiler. To be used to measure the time spent by the client GPU in
+/// each kernel and data transfer.
+class profiler                                                                                      /// @brief **OpenCL event profiler.**
+{
+private:
+  neutrino*                     baseline;                                                           ///< @brief **Neutrino baseline.**
+  std::map<std::string, size_t> entry_index;                                                        ///< @brief **Statistics entry index map.**
+  std::vector<std::string>      entry_name;                                                         ///< @brief **Statistics entry names.**
+  std::vector<cl_event>         pending_event;                                                      ///< @brief **Events waiting for completion.**
+  std::vector<size_t>           pending_entry;                                                      ///< @brief **Entries of the events waiting for completion.**
+  std::vector<size_t>           pending_bytes;                                                      ///< @brief **Sizes of the events waiting for completion [bytes].**
+  cl_ulong                      seed;                                                               ///< @brief **Reservoir sampling random state.**
+
+  /// @brief **Resolve function.**
+  /// @details Reads the profiling timestamps of the completed pending events, stores them as
+  /// samples and releases the events. In case "loc_wait" is true, it first waits for all pending
+  /// events to complete.
+  void resolve (
+                bool loc_wait                                                                       ///< Wait for completion flag.
+               );
+
+  /// @brief **Percentile function.**
+  /// @details Returns the given percentile (nearest rank) of a sorted array of durations.
+  double percentile (
+                     std::vector<double>& loc_sorted,                                               ///< Sorted durations [ns].
+                     double               loc_percentile                                            ///< Percentile [0...1].
+                    );
+
+  /// @brief **Add function.**
+  /// @details Adds a sample to the running aggregates of an entry. The device time is kept in the
+  /// entry reservoir by reservoir sampling: the first NU_PROFILER_RESERVOIR samples are all kept,
+  /// then each new one replaces a random kept sample with probability NU_PROFILER_RESERVOIR/count,
+  /// so that the reservoir stays a uniform sample of the whole run in bounded memory. The SUBMIT
+  /// timestamp is clamped between QUEUED and START, as some drivers do not report it.
+  void add (
+            size_t   loc_entry,                                                                     ///< Statistics entry index [#].
+            cl_ulong loc_queued,                                                                    ///< QUEUED timestamp [ns].
+            cl_ulong loc_submit,                                                                    ///< SUBMIT timestamp [ns].
+            cl_ulong loc_start,                                                                     ///< START timestamp [ns].
+            cl_ulong loc_end,                                                                       ///< END timestamp [ns].
+            size_t   loc_bytes                                                                      ///< Transferred data [bytes].
+           );
+
+  /// @brief **Statistics function.**
+  /// @details Computes the statistics of a given entry from its running aggregates; the
+  /// percentiles are computed on its reservoir, hence they are exact up to NU_PROFILER_RESERVOIR
+  /// samples and estimated beyond.
+  void statistics (
+                   size_t  loc_entry,                                                               ///< Statistics entry index [#].
+                   size_t& loc_count,                                                               ///< Number of samples [#].
+                   double& loc_mean,                                                                ///< Mean device time [ns].
+                   double& loc_p50,                                                                 ///< Median device time [ns].
+                   double& loc_p99,                                                                 ///< 99th percentile device time [ns].
+                   double& loc_queued,                                                              ///< Mean host latency (QUEUED to SUBMIT) [ns].
+                   double& loc_submitted,                                                           ///< Mean device latency (SUBMIT to START) [ns].
+                   double& loc_bandwidth                                                            ///< Achieved bandwidth [GB/s].
+                  );
+
+public:
+  std::vector<entry_structure>  entry;                                                              ///< @brief **Statistics entries.**
+
+  /// @brief **Class constructor.**
+  /// @details It resets the Neutrino baseline.
+  profiler ();
+
+  /// @brief **Class initializer.**
+  /// @details Registers the profiler in the Neutrino baseline, enabling event profiling on all
+  /// the OpenCL queues created afterwards.
+  void init (
+             neutrino* loc_baseline                                                                 ///< Neutrino baseline.
+            );
+
+  /// @brief **Record function.**
+  /// @details Takes ownership of an OpenCL event to be profiled under the given name. The event
+  /// is resolved (and released) once completed, without blocking the host.
+  void record (
+               cl_event    loc_event,                                                               ///< OpenCL event.
+               std::string loc_name,                                                                ///< Statistics entry name.
+               size_t      loc_bytes                                                                ///< Transferred data [bytes].
+              );
+
+  /// @brief **Report function.**
+  /// @details Waits for all pending events and prints the statistics on the terminal console.
+  void report ();
+
+  /// @brief **Save function.**
+  /// @details Waits for all pending events and saves the statistics to a CSV file.
+  void save (
+             std::string loc_file_directory,                                                        ///< File directory.
+             std::string loc_file_name                                                              ///< File name.
+            );
+
+  /// @brief **Class destructor.**
+  /// @details Prints the statistics, releases all pending events and unregisters the profiler
+  /// from the Neutrino baseline.
+  ~profiler();
+};
+
+#endif
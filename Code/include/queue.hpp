@@ -13,7 +13,8 @@
 /// Before the invocation of the @link opencl::execute @endlink method, the @link acquire @endlink
 /// method must be used on all data objects of interest. Similarly, the @link release @endlink
 /// methods must be used afterwards. They do some operations which are necessary to the Neutrino
-/// framework.
+/// framework. The @link flush @endlink method uploads only the data ranges modified on the host
+/// since the last upload, instead of the whole data.
 
 #ifndef queue_hpp
 #define queue_hpp
@@ -34,6 +35,17 @@ class queue
 private:
   neutrino*        baseline;                                                                        ///< @brief **Neutrino baseline.**
 
+  /// @brief **Partial write function.**
+  /// @details Coalesces the dirty ranges of a data object and enqueues one non-blocking partial
+  /// write per resulting range, then waits for all of them to complete and clears the ranges.
+  void write_ranges
+  (
+   cl_mem       loc_buffer,                                                                         ///< Data buffer.
+   void*        loc_data,                                                                           ///< Data storage.
+   size_t       loc_element_size,                                                                   ///< Data element size [bytes].
+   dirty_range* loc_dirty                                                                           ///< Dirty ranges.
+  );
+
 public:
   cl_command_queue queue_id;                                                                        ///< @brief **OpenCL queue.**
   cl_context       context_id;                                                                      ///< @brief **OpenCL context.**
@@ -49,6 +61,14 @@ public:
              neutrino* loc_baseline                                                                 ///< Neutrino object.
             );
 
+  /// @overload init(neutrino* loc_baseline, cl_device_id loc_device_id)
+  /// @details It creates the OpenCL queue on a given device of the OpenCL context (e.g. one of the
+  /// devices of a multi-device context, see @link opencl::init @endlink).
+  void init (
+             neutrino*    loc_baseline,                                                             ///< Neutrino object.
+             cl_device_id loc_device_id                                                             ///< Device ID.
+            );
+
   /////////////////////////////////////////////////////////////////////////////////////////////////////
   //////////////////////////////////////// "read" functions ///////////////////////////////////////////
   /////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -215,11 +235,98 @@ public:
    GLuint   loc_layout_index                                                                        ///< Layout index.
   );
 
+  /////////////////////////////////////////////////////////////////////////////////////////////////////
+  ///////////////////////////////////////// "flush" functions /////////////////////////////////////////
+  /////////////////////////////////////////////////////////////////////////////////////////////////////
+  /// @brief **OpenCL queue flush function.**
+  /// @details Writes to the OpenCL queue only the data ranges marked as modified since the last
+  /// upload (see @link int1::at @endlink and @link int1::mark @endlink). The ranges are coalesced
+  /// into the minimum set of partial writes, which are enqueued without blocking and waited for
+  /// once at the end. Nothing is transferred if no range has been marked.
+  void flush
+  (
+   int1*   loc_data,                                                                                ///< int1 object.
+   cl_uint loc_layout_index                                                                         ///< Layout index.
+  );
+
+  /// @overload flush(int2* loc_data, cl_uint loc_layout_index)
+  /// @details Writes to the OpenCL queue only the data ranges marked as modified.
+  void flush
+  (
+   int2*   loc_data,                                                                                ///< int2 object.
+   cl_uint loc_layout_index                                                                         ///< Layout index.
+  );
+
+  /// @overload flush(int3* loc_data, cl_uint loc_layout_index)
+  /// @details Writes to the OpenCL queue only the data ranges marked as modified.
+  void flush
+  (
+   int3*   loc_data,                                                                                ///< int3 object.
+   cl_uint loc_layout_index                                                                         ///< Layout index.
+  );
+
+  /// @overload flush(int4* loc_data, cl_uint loc_layout_index)
+  /// @details Writes to the OpenCL queue only the data ranges marked as modified.
+  void flush
+  (
+   int4*   loc_data,                                                                                ///< int4 object.
+   cl_uint loc_layout_index                                                                         ///< Layout index.
+  );
+
+  /// @overload flush(float1* loc_data, cl_uint loc_layout_index)
+  /// @details Writes to the OpenCL queue only the data ranges marked as modified.
+  void flush
+  (
+   float1* loc_data,                                                                                ///< float1 object.
+   cl_uint loc_layout_index                                                                         ///< Layout index.
+  );
+
+  /// @overload flush(float1G* loc_data, GLuint loc_layout_index)
+  /// @details Writes to the OpenCL queue only the data ranges marked as modified.
+  void flush
+  (
+   float1G* loc_data,                                                                               ///< float1G object.
+   GLuint   loc_layout_index                                                                        ///< Layout index.
+  );
+
+  /// @overload flush(float2* loc_data, cl_uint loc_layout_index)
+  /// @details Writes to the OpenCL queue only the data ranges marked as modified.
+  void flush
+  (
+   float2* loc_data,                                                                                ///< float2 object.
+   cl_uint loc_layout_index                                                                         ///< Layout index.
+  );
+
+  /// @overload flush(float3* loc_data, cl_uint loc_layout_index)
+  /// @details Writes to the OpenCL queue only the data ranges marked as modified.
+  void flush
+  (
+   float3* loc_data,                                                                                ///< float3 object.
+   cl_uint loc_layout_index                                                                         ///< Layout index.
+  );
+
+  /// @overload flush(float4* loc_data, cl_uint loc_layout_index)
+  /// @details Writes to the OpenCL queue only the data ranges marked as modified.
+  void flush
+  (
+   float4* loc_data,                                                                                ///< float4 object.
+   cl_uint loc_layout_index                                                                         ///< Layout index.
+  );
+
+  /// @overload flush(float4G* loc_data, GLuint loc_layout_index)
+  /// @details Writes to the OpenCL queue only the data ranges marked as modified.
+  void flush
+  (
+   float4G* loc_data,                                                                               ///< float4G object.
+   GLuint   loc_layout_index                                                                        ///< Layout index.
+  );
+
   /////////////////////////////////////////////////////////////////////////////////////////////////////
   ///////////////////////////////////////// acquire "functions" ///////////////////////////////////////
   /////////////////////////////////////////////////////////////////////////////////////////////////////
   /// @brief **OpenCL queue acquire function.**
-  /// @details Enables OpenCL exclusive data access. It locks data access to OpenGL.
+  /// @details Enables OpenCL exclusive data access. It locks data access to OpenGL. In headless
+  /// mode the data object is a plain OpenCL buffer and this function does nothing.
   void acquire
   (
    float1G* loc_data,                                                                               ///< Data object.
@@ -238,7 +345,9 @@ public:
   ///////////////////////////////////////// release "functions" ///////////////////////////////////////
   /////////////////////////////////////////////////////////////////////////////////////////////////////
   /// @brief **OpenCL queue release function.**
-  /// @details Disables OpenCL exclusive data access. It opens data access to OpenGL.
+  /// @details Disables OpenCL exclusive data access. It opens data access to OpenGL. In headless
+  /// mode the data object is a plain OpenCL buffer and this function does nothing: use the @link
+  /// read @endlink method to get its data back on the host.
   void release
   (
    float1G* loc_data,                                                                               ///< Data object.
@@ -0,0 +1,238 @@
+/// @file     stream.hpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Declaration of the "stream" class.
+///
+/// @details  A Neutrino "stream" saves snapshots of data objects to disk while the computation
+/// is running, without stalling the application loop. It keeps a ring of pinned staging buffers:
+/// every "period" steps the content of a data object is copied from the client GPU into the next
+/// free staging buffer by means of a non-blocking OpenCL read. The staging buffers are then handed
+/// to a background writer thread, which waits for the read to complete and appends the snapshot to
+/// a chunked binary file. The application loop only blocks in case all staging buffers are still
+/// waiting to be written (i.e. when the disk is slower than the snapshot rate).
+///
+/// The data file starts with a @link stream_header_structure @endlink followed by one chunk per
+/// snapshot: each chunk is a @link snapshot_structure @endlink immediately followed by the raw
+/// snapshot data. For each chunk, a @link snapshot_index_structure @endlink entry is appended to
+/// a companion index file (same name + ".idx"), in order to allow random access to the snapshots.
+
+#ifndef stream_hpp
+#define stream_hpp
+
+#include "neutrino.hpp"
+#include "data_classes.hpp"
+#include "queue.hpp"
+
+#pragma pack(push, 1)                                                                               // Packing data in 1 column...
+/// @brief    **Data structure. Internally used by Neutrino.**
+/// @details  This structure is written at the beginning of a snapshot stream data file.
+typedef struct _stream_header_structure
+{
+  char    magic[8];                                                                                 ///< File signature (NU_STREAM_MAGIC).
+  cl_uint version;                                                                                  ///< File format version (NU_STREAM_VERSION).
+  cl_uint reserved;                                                                                 ///< Reserved (0).
+} stream_header_structure;
+#pragma pack(pop)                                                                                   // End of packing.
+
+#pragma pack(push, 1)                                                                               // Packing data in 1 column...
+/// @brief    **Data structure. Internally used by Neutrino.**
+/// @details  This structure is written at the beginning of each snapshot chunk in a snapshot
+/// stream data file. It is immediately followed by "bytes" bytes of raw snapshot data.
+typedef struct _snapshot_structure
+{
+  cl_ulong step;                                                                                    ///< Application step number [#].
+  cl_uint  layout;                                                                                  ///< Data layout index [#].
+  cl_uint  type;                                                                                    ///< Data type (@link data_type @endlink).
+  cl_ulong size;                                                                                    ///< Data size [#].
+  cl_ulong bytes;                                                                                   ///< Data size [bytes].
+} snapshot_structure;
+#pragma pack(pop)                                                                                   // End of packing.
+
+#pragma pack(push, 1)                                                                               // Packing data in 1 column...
+/// @brief    **Data structure. Internally used by Neutrino.**
+/// @details  This structure is written in the snapshot stream index file, one per snapshot.
+typedef struct _snapshot_index_structure
+{
+  cl_ulong step;                                                                                    ///< Application step number [#].
+  cl_uint  layout;                                                                                  ///< Data layout index [#].
+  cl_uint  type;                                                                                    ///< Data type (@link data_type @endlink).
+  cl_ulong offset;                                                                                  ///< Chunk offset in the data file [bytes].
+  cl_ulong bytes;                                                                                   ///< Data size [bytes].
+} snapshot_index_structure;
+#pragma pack(pop)                                                                                   // End of packing.
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////// "stream" class ///////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class stream
+/// ### Snapshot stream.
+/// Declares a snapshot stream. To be used to save data objects to disk while the computation is
+/// running. The stream must be deleted before the @link queue @endlink objects used to write it.
+class stream                                                                                        /// @brief **Snapshot stream.**
+{
+private:
+  neutrino*                baseline;                                                                ///< @brief **Neutrino baseline.**
+  size_t                   slots;                                                                   ///< @brief **Number of staging buffers [#].**
+  size_t                   head;                                                                    ///< @brief **Next staging buffer index [#].**
+  cl_mem*                  staging;                                                                 ///< @brief **Pinned staging buffer array.**
+  void**                   pointer;                                                                 ///< @brief **Mapped staging buffer array.**
+  size_t*                  capacity;                                                                ///< @brief **Staging buffer capacity array [bytes].**
+  cl_command_queue*        owner;                                                                   ///< @brief **Staging buffer mapping queue array.**
+  cl_event*                event;                                                                   ///< @brief **Staging buffer read event array.**
+  snapshot_structure*      snapshot;                                                                ///< @brief **Staging buffer snapshot header array.**
+  bool*                    busy;                                                                    ///< @brief **Staging buffer "busy" flag array.**
+  std::deque<size_t>       pending;                                                                 ///< @brief **Staging buffers waiting to be written.**
+  std::mutex               lock;                                                                    ///< @brief **Staging buffer lock.**
+  std::condition_variable  wakeup;                                                                  ///< @brief **Staging buffer signal.**
+  std::thread              writer;                                                                  ///< @brief **Writer thread.**
+  bool                     stop;                                                                    ///< @brief **Writer thread "stop" flag.**
+  std::ofstream            data_file;                                                               ///< @brief **Data file.**
+  std::ofstream            index_file;                                                              ///< @brief **Index file.**
+  cl_ulong                 offset;                                                                  ///< @brief **Data file write offset [bytes].**
+
+  /// @brief **Snapshot function.**
+  /// @details Waits for the next staging buffer to be free, (re)allocates it if too small,
+  /// enqueues a non-blocking read of the OpenCL buffer into it and hands it to the writer thread.
+  void snap (
+             queue*   loc_queue,                                                                    ///< OpenCL queue.
+             cl_mem   loc_buffer,                                                                   ///< Data buffer.
+             cl_ulong loc_step,                                                                     ///< Application step number [#].
+             cl_uint  loc_layout_index,                                                             ///< Layout index.
+             cl_uint  loc_type,                                                                     ///< Data type.
+             size_t   loc_size,                                                                     ///< Data size [#].
+             size_t   loc_bytes                                                                     ///< Data size [bytes].
+            );
+
+  /// @brief **Writer thread function.**
+  /// @details Waits for staging buffers to be handed over, waits for their OpenCL read to
+  /// complete, appends the snapshot chunk to the data file and its entry to the index file and
+  /// then frees the staging buffer.
+  void write_loop ();
+
+public:
+  size_t                   period;                                                                  ///< @brief **Snapshot period [steps].**
+
+  /// @brief **Class constructor.**
+  /// @details It resets the staging buffer arrays and the snapshot period.
+  stream ();
+
+  /// @brief **Class initializer.**
+  /// @details Opens the data and index files, allocates the staging buffer ring and starts the
+  /// background writer thread. The staging buffers are allocated lazily, upon the first snapshot
+  /// which needs them, according to the size of the data.
+  void init (
+             neutrino*   loc_baseline,                                                              ///< Neutrino baseline.
+             std::string loc_file_directory,                                                        ///< File directory.
+             std::string loc_file_name,                                                             ///< File name.
+             size_t      loc_period,                                                                ///< Snapshot period [steps].
+             size_t      loc_slots                                                                  ///< Number of staging buffers [#].
+            );
+
+  /// @brief **Stream write function.**
+  /// @details Saves a snapshot of the data object in case the step number is a multiple of the
+  /// snapshot @link period @endlink, otherwise it does nothing. The snapshot reflects the content
+  /// of the data object after all the commands previously enqueued on the queue.
+  /// It does not wait for the data to be read from the client GPU, neither for it to be written.
+  void write (
+              queue*   loc_queue,                                                                   ///< OpenCL queue.
+              int1*    loc_data,                                                                    ///< int1 object.
+              cl_uint  loc_layout_index,                                                            ///< Layout index.
+              size_t   loc_step                                                                     ///< Application step number [#].
+             );
+
+  /// @overload write(queue* loc_queue, int2* loc_data, cl_uint loc_layout_index, size_t loc_step)
+  /// @details Saves a snapshot of the data object every "period" steps.
+  void write (
+              queue*   loc_queue,                                                                   ///< OpenCL queue.
+              int2*    loc_data,                                                                    ///< int2 object.
+              cl_uint  loc_layout_index,                                                            ///< Layout index.
+              size_t   loc_step                                                                     ///< Application step number [#].
+             );
+
+  /// @overload write(queue* loc_queue, int3* loc_data, cl_uint loc_layout_index, size_t loc_step)
+  /// @details Saves a snapshot of the data object every "period" steps.
+  void write (
+              queue*   loc_queue,                                                                   ///< OpenCL queue.
+              int3*    loc_data,                                                                    ///< int3 object.
+              cl_uint  loc_layout_index,                                                            ///< Layout index.
+              size_t   loc_step                                                                     ///< Application step number [#].
+             );
+
+  /// @overload write(queue* loc_queue, int4* loc_data, cl_uint loc_layout_index, size_t loc_step)
+  /// @details Saves a snapshot of the data object every "period" steps.
+  void write (
+              queue*   loc_queue,                                                                   ///< OpenCL queue.
+              int4*    loc_data,                                                                    ///< int4 object.
+              cl_uint  loc_layout_index,                                                            ///< Layout index.
+              size_t   loc_step                                                                     ///< Application step number [#].
+             );
+
+  /// @overload write(queue* loc_queue, float1* loc_data, cl_uint loc_layout_index, size_t loc_step)
+  /// @details Saves a snapshot of the data object every "period" steps.
+  void write (
+              queue*   loc_queue,                                                                   ///< OpenCL queue.
+              float1*  loc_data,                                                                    ///< float1 object.
+              cl_uint  loc_layout_index,                                                            ///< Layout index.
+              size_t   loc_step                                                                     ///< Application step number [#].
+             );
+
+  /// @overload write(queue* loc_queue, float1G* loc_data, GLuint loc_layout_index, size_t loc_step)
+  /// @details Saves a snapshot of the data object every "period" steps. In case of OpenCL/GL
+  /// interoperability, the data object must have been acquired by the queue (see
+  /// @link queue::acquire @endlink).
+  void write (
+              queue*   loc_queue,                                                                   ///< OpenCL queue.
+              float1G* loc_data,                                                                    ///< float1G object.
+              GLuint   loc_layout_index,                                                            ///< Layout index.
+              size_t   loc_step                                                                     ///< Application step number [#].
+             );
+
+  /// @overload write(queue* loc_queue, float2* loc_data, cl_uint loc_layout_index, size_t loc_step)
+  /// @details Saves a snapshot of the data object every "period" steps.
+  void write (
+              queue*   loc_queue,                                                                   ///< OpenCL queue.
+              float2*  loc_data,                                                                    ///< float2 object.
+              cl_uint  loc_layout_index,                                                            ///< Layout index.
+              size_t   loc_step                                                                     ///< Application step number [#].
+             );
+
+  /// @overload write(queue* loc_queue, float3* loc_data, cl_uint loc_layout_index, size_t loc_step)
+  /// @details Saves a snapshot of the data object every "period" steps.
+  void write (
+              queue*   loc_queue,                                                                   ///< OpenCL queue.
+              float3*  loc_data,                                                                    ///< float3 object.
+              cl_uint  loc_layout_index,                                                            ///< Layout index.
+              size_t   loc_step                                                                     ///< Application step number [#].
+             );
+
+  /// @overload write(queue* loc_queue, float4* loc_data, cl_uint loc_layout_index, size_t loc_step)
+  /// @details Saves a snapshot of the data object every "period" steps.
+  void write (
+              queue*   loc_queue,                                                                   ///< OpenCL queue.
+              float4*  loc_data,                                                                    ///< float4 object.
+              cl_uint  loc_layout_index,                                                            ///< Layout index.
+              size_t   loc_step                                                                     ///< Application step number [#].
+             );
+
+  /// @overload write(queue* loc_queue, float4G* loc_data, GLuint loc_layout_index, size_t loc_step)
+  /// @details Saves a snapshot of the data object every "period" steps. In case of OpenCL/GL
+  /// interoperability, the data object must have been acquired by the queue (see
+  /// @link queue::acquire @endlink).
+  void write (
+              queue*   loc_queue,                                                                   ///< OpenCL queue.
+              float4G* loc_data,                                                                    ///< float4G object.
+              GLuint   loc_layout_index,                                                            ///< Layout index.
+              size_t   loc_step                                                                     ///< Application step number [#].
+             );
+
+  /// @brief **Stream flush function.**
+  /// @details Waits until all pending snapshots have been written to disk.
+  void flush ();
+
+  /// @brief **Class destructor.**
+  /// @details Writes all pending snapshots, stops the writer thread, closes the files and
+  /// releases the staging buffers. It does nothing in case the stream was never initialized.
+  ~stream();
+};
+
+#endif
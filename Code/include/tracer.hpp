@@ -0,0 +1,113 @@
+/// @file     tracer.hpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Declaration of the "tracer" class.
+///
+/// @details  A Neutrino "tracer" records a timeline of the host API calls (setarg, execute, read,
+/// write, flush, acquire, release and plot) together with the execution intervals of the
+/// corresponding OpenCL commands on the client GPU. The device timestamps are converted to the
+/// host clock by means of an offset, measured once by enqueueing an OpenCL marker between two host
+/// timestamps. The timeline is saved in the Chrome trace event JSON format, which can be opened
+/// offline in Perfetto (https://ui.perfetto.dev) or in chrome://tracing, in order to inspect the
+/// overlaps, gaps and synchronization stalls between host and device.
+/// When no tracer is initialized, the host spans reduce to a pointer check and no OpenCL events
+/// are created for tracing purposes. The tracer must be initialized before the @link queue
+/// @endlink objects, since the profiling must be enabled on the OpenCL queues at their creation.
+
+#ifndef tracer_hpp
+#define tracer_hpp
+
+#include "neutrino.hpp"
+
+/// @brief    **Data structure. Internally used by Neutrino.**
+/// @details  This structure stores a single span of the timeline.
+typedef struct _span_structure
+{
+  std::string name;                                                                                 ///< Span name.
+  size_t      track;                                                                                ///< Span track (NU_TRACE_HOST or NU_TRACE_DEVICE).
+  cl_ulong    queued;                                                                               ///< Queueing time, host clock [ns].
+  cl_ulong    begin;                                                                                ///< Beginning time, host clock [ns].
+  cl_ulong    end;                                                                                  ///< End time, host clock [ns].
+} span_structure;
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////// "tracer" class ///////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class tracer
+/// ### Host/device trace recorder.
+/// Declares a host/device trace recorder. To be used to see where the time of each application
+/// step goes, both on the host PC and on the client GPU.
+class tracer                                                                                        /// @brief **Host/device trace recorder.**
+{
+private:
+  neutrino*                   baseline;                                                             ///< @brief **Neutrino baseline.**
+  std::string                 file_name;                                                            ///< @brief **Trace full file name.**
+  cl_ulong                    origin;                                                               ///< @brief **Trace origin, host clock [ns].**
+  cl_long                     offset;                                                               ///< @brief **Device to host clock offset [ns].**
+  bool                        calibrated;                                                           ///< @brief **Clock offset "calibrated" flag.**
+  std::vector<cl_event>       pending_event;                                                        ///< @brief **Events waiting for completion.**
+  std::vector<std::string>    pending_name;                                                         ///< @brief **Names of the events waiting for completion.**
+
+  /// @brief **Calibrate function.**
+  /// @details Measures the offset between the device and the host clocks by enqueueing an OpenCL
+  /// marker on the given queue between two host timestamps.
+  void calibrate (
+                  cl_command_queue loc_queue                                                        ///< OpenCL queue ID.
+                 );
+
+  /// @brief **Resolve function.**
+  /// @details Reads the profiling timestamps of the completed pending events, stores them as
+  /// device spans and releases the events. In case "loc_wait" is true, it first waits for all
+  /// pending events to complete.
+  void resolve (
+                bool loc_wait                                                                       ///< Wait for completion flag.
+               );
+
+public:
+  std::vector<span_structure> span;                                                                 ///< @brief **Timeline spans.**
+
+  /// @brief **Class constructor.**
+  /// @details It resets the Neutrino baseline.
+  tracer ();
+
+  /// @brief **Class initializer.**
+  /// @details Registers the tracer in the Neutrino baseline, enabling event profiling on all the
+  /// OpenCL queues created afterwards, and sets the trace origin. The trace is saved to the given
+  /// file when the tracer is deleted.
+  void init (
+             neutrino*   loc_baseline,                                                              ///< Neutrino baseline.
+             std::string loc_file_directory,                                                        ///< File directory.
+             std::string loc_file_name                                                              ///< File name.
+            );
+
+  /// @brief **Host clock function.**
+  /// @details Returns the current time of the host monotonic clock [ns].
+  cl_ulong now ();
+
+  /// @brief **Host span function.**
+  /// @details Appends a host span, from the given beginning time up to now, to the timeline.
+  void host (
+             const char* loc_name,                                                                  ///< Span name.
+             cl_ulong    loc_begin                                                                  ///< Beginning time, host clock [ns].
+            );
+
+  /// @brief **Record function.**
+  /// @details Takes ownership of an OpenCL event to be traced under the given name. The event is
+  /// resolved (and released) once completed, without blocking the host.
+  void record (
+               cl_event    loc_event,                                                               ///< OpenCL event.
+               std::string loc_name                                                                 ///< Span name.
+              );
+
+  /// @brief **Save function.**
+  /// @details Waits for all pending events and writes the timeline to the trace file, in the
+  /// Chrome trace event JSON format.
+  void save ();
+
+  /// @brief **Class destructor.**
+  /// @details Saves the trace, releases all pending events and unregisters the tracer from the
+  /// Neutrino baseline.
+  ~tracer();
+};
+
+#endif
@@ -0,0 +1,541 @@
+/// @file     cluster.cpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Definition of the "cluster" class.
+
+#include "cluster.hpp"
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// "cluster" class ///////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+cluster::cluster()
+{
+  baseline  = NULL;                                                                                 // Initializing Neutrino baseline...
+  next_unit = 0;                                                                                    // Initializing next work unit...
+}
+
+void cluster::option
+(
+ std::string loc_option                                                                             // Compiler option.
+)
+{
+  compiler_options += " " + loc_option;                                                             // Appending compiler option...
+}
+
+void cluster::define
+(
+ std::string loc_name,                                                                              // Macro name.
+ std::string loc_value                                                                              // Macro value.
+)
+{
+  constant[loc_name] = loc_value;                                                                   // Setting specialization constant...
+}
+
+cl_int cluster::reserve
+(
+ node_structure& loc_node,                                                                          // Node.
+ cl_uint         loc_index,                                                                         // Argument index.
+ size_t          loc_bytes                                                                          // Buffer size [bytes].
+)
+{
+  cl_int loc_error = CL_SUCCESS;                                                                    // Error code.
+
+  if(loc_node.capacity[loc_index] < loc_bytes)                                                      // Checking buffer size...
+  {
+    if(loc_node.buffer[loc_index] != NULL)                                                          // Checking for previous buffer...
+    {
+      clReleaseMemObject (loc_node.buffer[loc_index]);                                              // Releasing previous buffer...
+      loc_node.buffer[loc_index]   = NULL;                                                          // Resetting buffer...
+      loc_node.capacity[loc_index] = 0;                                                             // Resetting buffer size...
+    }
+
+    loc_node.buffer[loc_index] = clCreateBuffer (loc_node.context, CL_MEM_READ_WRITE, loc_bytes, NULL, &loc_error);
+
+    if(loc_error != CL_SUCCESS)                                                                     // Checking error...
+    {
+      loc_node.buffer[loc_index] = NULL;                                                            // Resetting buffer...
+      return loc_error;
+    }
+
+    loc_node.capacity[loc_index] = loc_bytes;                                                       // Setting buffer size...
+  }
+
+  return clSetKernelArg (loc_node.kernel_id, loc_index, sizeof(cl_mem), &loc_node.buffer[loc_index]);
+}
+
+void cluster::run
+(
+ size_t loc_node,                                                                                   // Node index.
+ size_t loc_units,                                                                                  // Number of work units [#].
+ size_t loc_unit_size,                                                                              // Work-items per work unit [#].
+ size_t loc_batch                                                                                   // Work units per batch [#].
+)
+{
+  node_structure&                                loc_device = node[loc_node];                       // Node.
+  cl_int                                         loc_error  = CL_SUCCESS;                           // Error code.
+  size_t                                         loc_first;                                         // First unit of batch [#].
+  size_t                                         loc_count;                                         // Units of batch [#].
+  size_t                                         loc_size;                                          // Batch global size [#].
+  std::chrono::high_resolution_clock::time_point loc_start;                                         // Batch start time.
+  cl_uint                                        i;                                                 // Argument index.
+
+  loc_device.units = 0;                                                                             // Resetting executed units...
+  loc_device.time  = 0.0;                                                                           // Resetting execution time...
+  loc_device.error = CL_SUCCESS;                                                                    // Resetting error code...
+  loc_start        = std::chrono::high_resolution_clock::now ();                                    // Getting start time...
+
+  // Setting value arguments and writing whole arrays:
+  for(i = 0; (i < shard.size ()) && (loc_error == CL_SUCCESS); i++)                                 // Scanning kernel arguments...
+  {
+    if(!shard[i].value.empty ())                                                                    // Checking for value argument...
+    {
+      loc_error = clSetKernelArg (loc_device.kernel_id, i, shard[i].value.size (), shard[i].value.data ());
+    }
+
+    else if((shard[i].data != NULL) && (shard[i].unit_bytes == 0))                                  // Checking for whole array...
+    {
+      loc_error = reserve (loc_device, i, shard[i].bytes);                                          // Reserving buffer...
+
+      if(loc_error == CL_SUCCESS)
+      {
+        loc_error = clEnqueueWriteBuffer (loc_device.queue, loc_device.buffer[i], CL_FALSE, 0, shard[i].bytes, shard[i].data, 0, NULL, NULL);
+      }
+    }
+  }
+
+  while(loc_error == CL_SUCCESS)
+  {
+    loc_first = next_unit.fetch_add (loc_batch);                                                    // Taking next batch...
+
+    if(loc_first >= loc_units)                                                                      // Checking for units left...
+    {
+      break;
+    }
+
+    loc_count = std::min (loc_batch, loc_units - loc_first);                                        // Getting batch units...
+    loc_size  = loc_count*loc_unit_size;                                                            // Getting batch global size...
+
+    // Staging batch input:
+    for(i = 0; (i < shard.size ()) && (loc_error == CL_SUCCESS); i++)                               // Scanning kernel arguments...
+    {
+      if((shard[i].data != NULL) && (shard[i].unit_bytes > 0))                                      // Checking for sharded array...
+      {
+        loc_error = reserve (loc_device, i, loc_count*shard[i].unit_bytes);                         // Reserving buffer...
+
+        if(loc_error != CL_SUCCESS)                                                                 // Checking error...
+        {
+          break;
+        }
+
+        loc_error = clEnqueueWriteBuffer
+                    (
+                     loc_device.queue,                                                              // Device queue.
+                     loc_device.buffer[i],                                                          // Device buffer.
+                     CL_FALSE,                                                                      // Non-blocking write.
+                     0,                                                                             // Buffer offset.
+                     loc_count*shard[i].unit_bytes,                                                 // Size [bytes].
+                     shard[i].data + loc_first*shard[i].unit_bytes,                                 // Host data.
+                     0,                                                                             // Number of events.
+                     NULL,                                                                          // Event list.
+                     NULL                                                                           // Event.
+                    );
+      }
+    }
+
+    if(loc_error == CL_SUCCESS)                                                                     // Checking error...
+    {
+      // Enqueueing batch:
+      loc_error = clEnqueueNDRangeKernel (loc_device.queue, loc_device.kernel_id, 1, NULL, &loc_size, NULL, 0, NULL, NULL);
+    }
+
+    // Staging batch output:
+    for(i = 0; (i < shard.size ()) && (loc_error == CL_SUCCESS); i++)                               // Scanning kernel arguments...
+    {
+      if((shard[i].data != NULL) && (shard[i].unit_bytes > 0) && shard[i].output)                   // Checking for output array...
+      {
+        loc_error = clEnqueueReadBuffer
+                    (
+                     loc_device.queue,                                                              // Device queue.
+                     loc_device.buffer[i],                                                          // Device buffer.
+                     CL_FALSE,                                                                      // Non-blocking read.
+                     0,                                                                             // Buffer offset.
+                     loc_count*shard[i].unit_bytes,                                                 // Size [bytes].
+                     shard[i].data + loc_first*shard[i].unit_bytes,                                 // Host data.
+                     0,                                                                             // Number of events.
+                     NULL,                                                                          // Event list.
+                     NULL                                                                           // Event.
+                    );
+      }
+    }
+
+    if(loc_error == CL_SUCCESS)                                                                     // Checking error...
+    {
+      loc_error = clFinish (loc_device.queue);                                                      // Waiting for batch to be completed...
+    }
+
+    if(loc_error == CL_SUCCESS)                                                                     // Checking error...
+    {
+      loc_device.units += loc_count;                                                                // Accumulating executed units...
+    }
+  }
+
+  loc_device.error = loc_error;                                                                     // Storing error code (reported by the calling thread)...
+  loc_device.time  = std::chrono::duration<double>(std::chrono::high_resolution_clock::now () - loc_start).count ();
+}
+
+void cluster::init
+(
+ neutrino*                loc_baseline,                                                             // Neutrino baseline.
+ compute_device_type      loc_device_type,                                                          // Compute device type.
+ std::string              loc_kernel_home,                                                          // Kernel home directory.
+ std::vector<std::string> loc_kernel_file_name,                                                     // OpenCL kernel file names.
+ std::string              loc_kernel_name                                                           // OpenCL kernel name.
+)
+{
+  cl_int                      loc_error;                                                            // Error code.
+  cl_device_type              loc_type;                                                             // OpenCL device type.
+  cl_uint                     loc_platforms = 0;                                                    // Number of platforms [#].
+  cl_uint                     loc_devices;                                                          // Number of devices on platform [#].
+  std::vector<cl_platform_id> loc_platform_id;                                                      // Platform IDs.
+  std::vector<cl_device_id>   loc_device_id;                                                        // Device IDs on platform.
+  cl_context_properties       loc_property[3];                                                      // Context properties.
+  cl_uint                     loc_compute_units;                                                    // Device compute units [#].
+  cl_uint                     loc_clock;                                                            // Device clock frequency [MHz].
+  char                        loc_text[NU_MAX_TEXT_SIZE];                                           // Device name text.
+  std::string                 loc_slash;                                                            // Slash character, according to the operating system.
+  std::vector<std::string>    loc_source;                                                           // Kernel sources.
+  std::string                 loc_options;                                                          // Build options.
+  std::string                 loc_log;                                                              // OpenCL JIT compiler log.
+  node_structure              loc_node;                                                             // Node.
+  cl_uint                     p;                                                                    // Platform index.
+  cl_uint                     d;                                                                    // Device index.
+  size_t                      i;                                                                    // Index.
+
+  baseline = loc_baseline;                                                                          // Getting Neutrino baseline...
+
+  #ifdef __linux__
+    loc_slash = "/";                                                                                // Setting slash according to Linux...
+  #endif
+
+  #ifdef __APPLE__
+    loc_slash = "/";                                                                                // Setting slash according to Apple...
+  #endif
+
+  #ifdef WIN32
+    loc_slash = "\\";                                                                               // Setting slash according to Windows...
+  #endif
+
+  switch(loc_device_type)                                                                           // Selecting device type...
+  {
+    case NU_CPU:
+      loc_type = CL_DEVICE_TYPE_CPU;                                                                // Setting device type = NU_CPU...
+      break;
+
+    case NU_GPU:
+      loc_type = CL_DEVICE_TYPE_GPU;                                                                // Setting device type = NU_GPU...
+      break;
+
+    case NU_ACCELERATOR:
+      loc_type = CL_DEVICE_TYPE_ACCELERATOR;                                                        // Setting device type = NU_ACCELERATOR...
+      break;
+
+    case NU_ALL:
+      loc_type = CL_DEVICE_TYPE_ALL;                                                                // Setting device type = NU_ALL...
+      break;
+
+    default:
+      loc_type = CL_DEVICE_TYPE_DEFAULT;                                                            // Setting device type = NU_DEFAULT...
+      break;
+  }
+
+  baseline->action ("loading OpenCL cluster kernel source from files...");                          // Printing message...
+
+  for(i = 0; i < loc_kernel_file_name.size (); i++)                                                 // Scanning kernel files...
+  {
+    loc_source.push_back (baseline->read_file (loc_kernel_home + loc_slash + loc_kernel_file_name[i]));
+  }
+
+  baseline->done ();                                                                                // Printing message...
+
+  // Getting compiler options (kernel home include path, specialization macros):
+  loc_options = baseline->build_options (compiler_options + " -I" + loc_kernel_home, constant);
+
+  baseline->action ("initializing OpenCL cluster...");                                              // Printing message...
+
+  clGetPlatformIDs (0, NULL, &loc_platforms);                                                       // Getting number of platforms...
+  loc_platform_id.resize (loc_platforms);                                                           // Allocating platform IDs...
+
+  if(loc_platforms > 0)
+  {
+    clGetPlatformIDs (loc_platforms, loc_platform_id.data (), NULL);                                // Getting platform IDs...
+  }
+
+  for(p = 0; p < loc_platforms; p++)                                                                // Scanning platforms...
+  {
+    loc_devices = 0;                                                                                // Resetting number of devices...
+    loc_error   = clGetDeviceIDs (loc_platform_id[p], loc_type, 0, NULL, &loc_devices);
+
+    if((loc_error != CL_SUCCESS) || (loc_devices == 0))                                             // Checking for devices of the requested type...
+    {
+      continue;
+    }
+
+    loc_device_id.resize (loc_devices);                                                             // Allocating device IDs...
+    clGetDeviceIDs (loc_platform_id[p], loc_type, loc_devices, loc_device_id.data (), NULL);
+
+    for(d = 0; d < loc_devices; d++)                                                                // Scanning devices...
+    {
+      loc_property[0]  = CL_CONTEXT_PLATFORM;                                                       // Setting context platform...
+      loc_property[1]  = (cl_context_properties)loc_platform_id[p];
+      loc_property[2]  = 0;
+
+      loc_node.platform = loc_platform_id[p];                                                       // Setting platform ID...
+      loc_node.device   = loc_device_id[d];                                                         // Setting device ID...
+      loc_node.context  = clCreateContext (loc_property, 1, &loc_node.device, NULL, NULL, &loc_error);
+
+      if(loc_error != CL_SUCCESS)                                                                   // Checking for unusable device...
+      {
+        continue;
+      }
+
+      loc_node.queue = clCreateCommandQueue (loc_node.context, loc_node.device, 0, &loc_error);
+      baseline->check_error (loc_error);                                                            // Checking error...
+
+      // Building OpenCL program (from the binary cache, if any):
+      loc_node.program = baseline->build_program
+                         (
+                          loc_node.context,                                                         // Device context.
+                          {loc_node.device},                                                        // Device ID.
+                          loc_kernel_home,                                                          // Kernel home directory.
+                          loc_source,                                                               // Kernel sources.
+                          loc_options,                                                              // Compiler options.
+                          loc_log                                                                   // Compiler log.
+                         );
+
+      if(loc_node.program != NULL)                                                                  // Checking compiled program...
+      {
+        loc_node.kernel_id = clCreateKernel (loc_node.program, loc_kernel_name.c_str (), &loc_error);
+      }
+
+      if((loc_node.program == NULL) || (loc_error != CL_SUCCESS))                                   // Checking for usable device...
+      {
+        baseline->warning ("could not build cluster kernel on platform #" + std::to_string (p) + ", device #" + std::to_string (d) + ", skipping it!");
+
+        if(loc_node.program != NULL)
+        {
+          clReleaseProgram (loc_node.program);                                                      // Releasing device program...
+        }
+
+        clReleaseCommandQueue (loc_node.queue);                                                     // Releasing device queue...
+        clReleaseContext (loc_node.context);                                                        // Releasing device context...
+        continue;
+      }
+
+      loc_text[0]       = '\0';
+      loc_compute_units = 1;
+      loc_clock         = 1;
+      clGetDeviceInfo (loc_node.device, CL_DEVICE_NAME, sizeof(loc_text), loc_text, NULL);
+      clGetDeviceInfo (loc_node.device, CL_DEVICE_MAX_COMPUTE_UNITS, sizeof(cl_uint), &loc_compute_units, NULL);
+      clGetDeviceInfo (loc_node.device, CL_DEVICE_MAX_CLOCK_FREQUENCY, sizeof(cl_uint), &loc_clock, NULL);
+
+      loc_node.name  = std::string (loc_text);                                                      // Setting device name...
+      loc_node.estimate = (double)std::max (loc_compute_units*loc_clock, 1u);                       // Estimating device throughput...
+      loc_node.rate     = 0.0;                                                                      // Resetting measured throughput...
+      loc_node.units    = 0;                                                                        // Resetting executed units...
+      loc_node.time     = 0.0;                                                                      // Resetting execution time...
+      loc_node.error    = CL_SUCCESS;                                                               // Resetting error code...
+      loc_node.buffer.assign (shard.size (), NULL);                                                 // Resetting device buffers...
+      loc_node.capacity.assign (shard.size (), 0);                                                  // Resetting device buffer sizes...
+      node.push_back (loc_node);                                                                    // Adding node...
+    }
+  }
+
+  if(node.empty ())                                                                                 // Checking for devices...
+  {
+    baseline->error ("no OpenCL devices of the requested type found for the cluster!");             // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  baseline->done ();                                                                                // Printing message...
+
+  for(i = 0; i < node.size (); i++)                                                                 // Scanning nodes...
+  {
+    std::cout << "        CLUSTER DEVICE " << i << ": " << node[i].name << std::endl;               // Printing message...
+  }
+}
+
+void cluster::set_shard
+(
+ cl_uint loc_index,                                                                                 // Argument index.
+ void*   loc_data,                                                                                  // Host array.
+ size_t  loc_unit_bytes,                                                                            // Size per work unit [bytes].
+ bool    loc_output                                                                                 // Output flag.
+)
+{
+  size_t i;                                                                                         // Index.
+
+  if(shard.size () <= loc_index)                                                                    // Checking number of arguments...
+  {
+    shard.resize (loc_index + 1, {NULL, 0, 0, false, std::vector<char> ()});                        // Adding arguments...
+
+    for(i = 0; i < node.size (); i++)                                                               // Scanning nodes...
+    {
+      node[i].buffer.resize (loc_index + 1, NULL);                                                  // Adding device buffers...
+      node[i].capacity.resize (loc_index + 1, 0);                                                   // Adding device buffer sizes...
+    }
+  }
+
+  shard[loc_index].data       = (char*)loc_data;                                                    // Setting host array...
+  shard[loc_index].unit_bytes = loc_unit_bytes;                                                     // Setting size per work unit...
+  shard[loc_index].bytes      = 0;                                                                  // Resetting whole array size...
+  shard[loc_index].output     = loc_output;                                                         // Setting output flag...
+  shard[loc_index].value.clear ();                                                                  // Resetting value argument...
+}
+
+void cluster::set_shared
+(
+ cl_uint loc_index,                                                                                 // Argument index.
+ void*   loc_data,                                                                                  // Host array.
+ size_t  loc_bytes                                                                                  // Host array size [bytes].
+)
+{
+  set_shard (loc_index, loc_data, 0, false);                                                        // Setting argument...
+  shard[loc_index].bytes = loc_bytes;                                                               // Setting whole array size...
+}
+
+void cluster::set_value
+(
+ cl_uint loc_index,                                                                                 // Argument index.
+ void*   loc_data,                                                                                  // Argument value.
+ size_t  loc_bytes                                                                                  // Argument size [bytes].
+)
+{
+  set_shard (loc_index, NULL, 0, false);                                                            // Setting argument...
+  shard[loc_index].value.assign ((char*)loc_data, (char*)loc_data + loc_bytes);                     // Copying argument value...
+}
+
+void cluster::execute
+(
+ size_t loc_units,                                                                                  // Number of work units [#].
+ size_t loc_unit_size                                                                               // Work-items per work unit [#].
+)
+{
+  std::vector<std::thread> loc_worker;                                                              // Node threads.
+  std::vector<double>      loc_weight;                                                              // Node weights.
+  bool                     loc_measured = true;                                                     // Measured throughputs flag.
+  double                   loc_total    = 0.0;                                                      // Total weight.
+  double                   loc_rate;                                                                // Observed throughput [units/s].
+  double                   loc_rate_sum     = 0.0;                                                  // Measured throughput sum [units/s].
+  double                   loc_estimate_sum = 0.0;                                                  // Estimated throughput sum of the measured nodes.
+  size_t                   loc_batch;                                                               // Work units per batch [#].
+  size_t                   i;                                                                       // Node index.
+  cl_ulong                 loc_span     = baseline->trace_begin ();                                 // Trace span beginning [ns].
+
+  if((loc_units == 0) || (loc_unit_size == 0))                                                      // Checking for work...
+  {
+    return;
+  }
+
+  for(i = 0; i < node.size (); i++)                                                                 // Checking for measured throughputs...
+  {
+    loc_measured = loc_measured && (node[i].rate > 0.0);
+  }
+
+  for(i = 0; i < node.size (); i++)                                                                 // Scanning nodes...
+  {
+    loc_weight.push_back (loc_measured ? node[i].rate : node[i].estimate);                          // Getting node weight...
+    loc_total += loc_weight[i];                                                                     // Accumulating weight...
+  }
+
+  next_unit = 0;                                                                                    // Resetting next work unit...
+
+  for(i = 0; i < node.size (); i++)                                                                 // Starting one host thread per node...
+  {
+    loc_batch = (size_t)ceil (loc_units*loc_weight[i]/(loc_total*NU_CLUSTER_ROUNDS));               // Getting batch size...
+    loc_worker.push_back (std::thread (&cluster::run, this, i, loc_units, loc_unit_size, std::max (loc_batch, (size_t)1)));
+  }
+
+  for(i = 0; i < loc_worker.size (); i++)                                                           // Scanning node threads...
+  {
+    loc_worker[i].join ();                                                                          // Waiting for node to complete...
+  }
+
+  for(i = 0; i < node.size (); i++)                                                                 // Reporting node errors...
+  {
+    if(node[i].error != CL_SUCCESS)                                                                 // Checking for failed node...
+    {
+      baseline->error ("cluster device " + std::to_string (i) + " (" + node[i].name + ") failed: " + baseline->get_error (node[i].error));
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
+  }
+
+  for(i = 0; i < node.size (); i++)                                                                 // Updating throughputs...
+  {
+    if((node[i].units > 0) && (node[i].time > 0.0))                                                 // Checking for valid time...
+    {
+      loc_rate     = (double)node[i].units/node[i].time;                                            // Getting observed throughput...
+      node[i].rate = (node[i].rate > 0.0) ?
+                     (NU_SPREAD_WEIGHT*loc_rate + (1.0 - NU_SPREAD_WEIGHT)*node[i].rate) :
+                     loc_rate;                                                                      // Smoothing throughput...
+    }
+
+    if(node[i].rate > 0.0)                                                                          // Checking for measured throughput...
+    {
+      loc_rate_sum     += node[i].rate;                                                             // Accumulating measured throughput...
+      loc_estimate_sum += node[i].estimate;                                                         // Accumulating estimated throughput...
+    }
+  }
+
+  for(i = 0; (i < node.size ()) && (loc_estimate_sum > 0.0); i++)                                   // Scanning nodes...
+  {
+    if(node[i].rate == 0.0)                                                                         // Checking for node never measured (no units taken)...
+    {
+      node[i].rate = node[i].estimate*loc_rate_sum/loc_estimate_sum;                                // Scaling estimate as the measured nodes...
+    }
+  }
+
+  baseline->trace_end ("cluster", loc_span);                                                        // Appending trace span...
+}
+
+double cluster::get_share
+(
+ size_t loc_node                                                                                    // Node index.
+)
+{
+  size_t loc_total = 0;                                                                             // Total executed units [#].
+  size_t i;                                                                                         // Node index.
+
+  for(i = 0; i < node.size (); i++)                                                                 // Scanning nodes...
+  {
+    loc_total += node[i].units;                                                                     // Accumulating executed units...
+  }
+
+  return (loc_total > 0) ? (double)node[loc_node].units/(double)loc_total : 0.0;
+}
+
+size_t cluster::size ()
+{
+  return node.size ();                                                                              // Returning number of nodes...
+}
+
+cluster::~cluster()
+{
+  size_t i;                                                                                         // Node index.
+  size_t j;                                                                                         // Argument index.
+
+  for(i = 0; i < node.size (); i++)                                                                 // Scanning nodes...
+  {
+    for(j = 0; j < node[i].buffer.size (); j++)                                                     // Scanning device buffers...
+    {
+      if(node[i].buffer[j] != NULL)
+      {
+        clReleaseMemObject (node[i].buffer[j]);                                                     // Releasing device buffer...
+      }
+    }
+
+    clReleaseKernel (node[i].kernel_id);                                                            // Releasing device kernel...
+    clReleaseProgram (node[i].program);                                                             // Releasing device program...
+    clReleaseCommandQueue (node[i].queue);                                                          // Releasing device queue...
+    clReleaseContext (node[i].context);                                                             // Releasing device context...
+  }
+}
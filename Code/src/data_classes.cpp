@@ -5,6 +5,106 @@
 
 #include "data_classes.hpp"
 
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// "dirty_range" class /////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+dirty_range::dirty_range()
+{
+  range.clear ();                                                                                   // Resetting range list...
+}
+
+void dirty_range::mark (
+                        size_t loc_begin,                                                           // Range begin index (included).
+                        size_t loc_end                                                              // Range end index (excluded).
+                       )
+{
+  range_structure loc_range;                                                                        // Range.
+
+  if(loc_end <= loc_begin)                                                                          // Checking for empty range...
+  {
+    return;                                                                                         // Nothing to mark...
+  }
+
+  // Merging with the last marked range, if overlapping or adjacent:
+  if(!range.empty () && (loc_begin <= range.back ().end) && (loc_end >= range.back ().begin))
+  {
+    range.back ().begin = std::min (range.back ().begin, loc_begin);                                // Extending range begin...
+    range.back ().end   = std::max (range.back ().end, loc_end);                                    // Extending range end...
+  }
+
+  else
+  {
+    loc_range.begin = loc_begin;                                                                    // Setting range begin...
+    loc_range.end   = loc_end;                                                                      // Setting range end...
+    range.push_back (loc_range);                                                                    // Appending range...
+
+    if(range.size () > NU_DIRTY_MAX_RANGES)                                                         // Checking range list length...
+    {
+      coalesce (NU_DIRTY_GAP);                                                                      // Coalescing ranges...
+
+      if(range.size () > NU_DIRTY_MAX_RANGES)                                                       // Checking range list length again...
+      {
+        range.front ().end = range.back ().end;                                                     // Collapsing into a single enclosing range...
+        range.resize (1);                                                                           // Dropping all other ranges...
+      }
+    }
+  }
+}
+
+void dirty_range::coalesce (
+                            size_t loc_gap                                                          // Maximum merge gap [#].
+                           )
+{
+  size_t i;                                                                                         // Index.
+  size_t j;                                                                                         // Index.
+
+  if(range.size () < 2)                                                                             // Checking for something to coalesce...
+  {
+    return;                                                                                         // Nothing to coalesce...
+  }
+
+  // Sorting ranges by begin index:
+  std::sort
+  (
+   range.begin (),                                                                                  // First range.
+   range.end (),                                                                                    // Last range.
+   [](const range_structure& a, const range_structure& b) {return a.begin < b.begin;}               // Ordering criterion.
+  );
+
+  j = 0;                                                                                            // Resetting merged range index...
+
+  for(i = 1; i < range.size (); i++)                                                                // Scanning ranges...
+  {
+    if(range[i].begin <= (range[j].end + loc_gap))                                                  // Checking distance from merged range...
+    {
+      range[j].end = std::max (range[j].end, range[i].end);                                         // Merging range...
+    }
+
+    else
+    {
+      j++;                                                                                          // Starting a new merged range...
+      range[j] = range[i];                                                                          // Copying range...
+    }
+  }
+
+  range.resize (j + 1);                                                                             // Dropping merged ranges...
+}
+
+bool dirty_range::empty ()
+{
+  return range.empty ();                                                                            // Checking range list...
+}
+
+void dirty_range::clear ()
+{
+  range.clear ();                                                                                   // Clearing range list...
+}
+
+dirty_range::~dirty_range()
+{
+  // Doing nothing.
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////// "int1" class ////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -82,6 +182,23 @@ void int1::read
   }
 }
 
+cl_long& int1::at (
+                   size_t loc_index                                                                 // Data index [#].
+                  )
+{
+  dirty.mark (loc_index, loc_index + 1);                                                            // Marking data element as modified...
+
+  return data[loc_index];                                                                           // Returning data element...
+}
+
+void int1::mark (
+                 size_t loc_begin,                                                                  // Range begin index (included).
+                 size_t loc_end                                                                     // Range end index (excluded).
+                )
+{
+  dirty.mark (loc_begin, loc_end);                                                                  // Marking data range as modified...
+}
+
 int1::~int1()
 {
   delete[] data;                                                                                    // Deleting data storage...
@@ -111,6 +228,23 @@ void int2::init (
   }
 }
 
+int2_structure& int2::at (
+                          size_t loc_index                                                          // Data index [#].
+                         )
+{
+  dirty.mark (loc_index, loc_index + 1);                                                            // Marking data element as modified...
+
+  return data[loc_index];                                                                           // Returning data element...
+}
+
+void int2::mark (
+                 size_t loc_begin,                                                                  // Range begin index (included).
+                 size_t loc_end                                                                     // Range end index (excluded).
+                )
+{
+  dirty.mark (loc_begin, loc_end);                                                                  // Marking data range as modified...
+}
+
 int2::~int2()
 {
   delete[] data;                                                                                    // Deleting data storage...
@@ -141,6 +275,23 @@ void int3::init (
   }
 }
 
+int3_structure& int3::at (
+                          size_t loc_index                                                          // Data index [#].
+                         )
+{
+  dirty.mark (loc_index, loc_index + 1);                                                            // Marking data element as modified...
+
+  return data[loc_index];                                                                           // Returning data element...
+}
+
+void int3::mark (
+                 size_t loc_begin,                                                                  // Range begin index (included).
+                 size_t loc_end                                                                     // Range end index (excluded).
+                )
+{
+  dirty.mark (loc_begin, loc_end);                                                                  // Marking data range as modified...
+}
+
 int3::~int3()
 {
   delete[] data;                                                                                    // Deleting data storage...
@@ -173,6 +324,23 @@ void int4::init
   }
 }
 
+int4_structure& int4::at (
+                          size_t loc_index                                                          // Data index [#].
+                         )
+{
+  dirty.mark (loc_index, loc_index + 1);                                                            // Marking data element as modified...
+
+  return data[loc_index];                                                                           // Returning data element...
+}
+
+void int4::mark (
+                 size_t loc_begin,                                                                  // Range begin index (included).
+                 size_t loc_end                                                                     // Range end index (excluded).
+                )
+{
+  dirty.mark (loc_begin, loc_end);                                                                  // Marking data range as modified...
+}
+
 int4::~int4()
 {
   delete[] data;                                                                                    // Deleting data storage...
@@ -202,6 +370,23 @@ void float1::init
   }
 }
 
+cl_float& float1::at (
+                      size_t loc_index                                                              // Data index [#].
+                     )
+{
+  dirty.mark (loc_index, loc_index + 1);                                                            // Marking data element as modified...
+
+  return data[loc_index];                                                                           // Returning data element...
+}
+
+void float1::mark (
+                   size_t loc_begin,                                                                // Range begin index (included).
+                   size_t loc_end                                                                   // Range end index (excluded).
+                  )
+{
+  dirty.mark (loc_begin, loc_end);                                                                  // Marking data range as modified...
+}
+
 float1::~float1()
 {
   delete[] data;                                                                                    // Deleting data storage...
@@ -231,6 +416,23 @@ void float1G::init
   }
 }
 
+GLfloat& float1G::at (
+                      size_t loc_index                                                              // Data index [#].
+                     )
+{
+  dirty.mark (loc_index, loc_index + 1);                                                            // Marking data element as modified...
+
+  return data[loc_index];                                                                           // Returning data element...
+}
+
+void float1G::mark (
+                    size_t loc_begin,                                                               // Range begin index (included).
+                    size_t loc_end                                                                  // Range end index (excluded).
+                   )
+{
+  dirty.mark (loc_begin, loc_end);                                                                  // Marking data range as modified...
+}
+
 float1G::~float1G()
 {
   delete[] data;                                                                                    // Deleting data storage...
@@ -261,6 +463,23 @@ void float2::init
   }
 }
 
+float2_structure& float2::at (
+                              size_t loc_index                                                      // Data index [#].
+                             )
+{
+  dirty.mark (loc_index, loc_index + 1);                                                            // Marking data element as modified...
+
+  return data[loc_index];                                                                           // Returning data element...
+}
+
+void float2::mark (
+                   size_t loc_begin,                                                                // Range begin index (included).
+                   size_t loc_end                                                                   // Range end index (excluded).
+                  )
+{
+  dirty.mark (loc_begin, loc_end);                                                                  // Marking data range as modified...
+}
+
 float2::~float2()
 {
   delete[] data;                                                                                    // Deleting data storage...
@@ -292,6 +511,23 @@ void float3::init
   }
 }
 
+float3_structure& float3::at (
+                              size_t loc_index                                                      // Data index [#].
+                             )
+{
+  dirty.mark (loc_index, loc_index + 1);                                                            // Marking data element as modified...
+
+  return data[loc_index];                                                                           // Returning data element...
+}
+
+void float3::mark (
+                   size_t loc_begin,                                                                // Range begin index (included).
+                   size_t loc_end                                                                   // Range end index (excluded).
+                  )
+{
+  dirty.mark (loc_begin, loc_end);                                                                  // Marking data range as modified...
+}
+
 float3::~float3()
 {
   delete[] data;                                                                                    // Deleting data storage...
@@ -324,6 +560,23 @@ void float4::init
   }
 }
 
+float4_structure& float4::at (
+                              size_t loc_index                                                      // Data index [#].
+                             )
+{
+  dirty.mark (loc_index, loc_index + 1);                                                            // Marking data element as modified...
+
+  return data[loc_index];                                                                           // Returning data element...
+}
+
+void float4::mark (
+                   size_t loc_begin,                                                                // Range begin index (included).
+                   size_t loc_end                                                                   // Range end index (excluded).
+                  )
+{
+  dirty.mark (loc_begin, loc_end);                                                                  // Marking data range as modified...
+}
+
 float4::~float4()
 {
   delete[] data;                                                                                    // Deleting data storage...
@@ -356,6 +609,23 @@ void float4G::init
   }
 }
 
+float4G_structure& float4G::at (
+                                size_t loc_index                                                    // Data index [#].
+                               )
+{
+  dirty.mark (loc_index, loc_index + 1);                                                            // Marking data element as modified...
+
+  return data[loc_index];                                                                           // Returning data element...
+}
+
+void float4G::mark (
+                    size_t loc_begin,                                                               // Range begin index (included).
+                    size_t loc_end                                                                  // Range end index (excluded).
+                   )
+{
+  dirty.mark (loc_begin, loc_end);                                                                  // Marking data range as modified...
+}
+
 float4G::~float4G()
 {
   delete[] data;                                                                                    // Deleting data storage...
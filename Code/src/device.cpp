@@ -10,7 +10,56 @@
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 device::device()
 {
-
+  baseline = NULL;                                                                                  // Resetting Neutrino baseline...
+  queried  = false;                                                                                 // Resetting detailed properties flag...
+
+  // Resetting device properties (set by init and query):
+  id                            = NULL;
+  address_bits                  = 0;
+  available                     = CL_FALSE;
+  compiler_available            = CL_FALSE;
+  double_fp_config              = 0;
+  endian_little                 = CL_FALSE;
+  error_correction_support      = CL_FALSE;
+  execution_capabilities        = 0;
+  global_mem_cache_size         = 0;
+  global_mem_cache_type         = 0;
+  global_mem_cacheline_size     = 0;
+  global_mem_size               = 0;
+  half_fp_config                = 0;
+  image_support                 = CL_FALSE;
+  image2D_max_height            = 0;
+  image2D_max_width             = 0;
+  image3D_max_depth             = 0;
+  image3D_max_height            = 0;
+  image3D_max_width             = 0;
+  local_mem_size                = 0;
+  local_mem_type                = 0;
+  max_clock_frequency           = 0;
+  max_compute_units             = 0;
+  max_constant_args             = 0;
+  max_constant_buffer_size      = 0;
+  max_mem_alloc_size            = 0;
+  max_parameter_size            = 0;
+  max_read_image_args           = 0;
+  max_samplers                  = 0;
+  max_work_group_size           = 0;
+  max_work_item_dimensions      = 0;
+  max_write_image_args          = 0;
+  mem_base_addr_align           = 0;
+  min_data_type_align_size      = 0;
+  platform                      = NULL;
+  preferred_vector_width_char   = 0;
+  preferred_vector_width_short  = 0;
+  preferred_vector_width_int    = 0;
+  preferred_vector_width_long   = 0;
+  preferred_vector_width_float  = 0;
+  preferred_vector_width_double = 0;
+  profiling_timer_resolution    = 0;
+  queue_properties              = 0;
+  single_fp_config              = 0;
+  type                          = 0;
+  vendor_id                     = 0;
 }
 
 std::string device::get_string
@@ -24,8 +73,6 @@ std::string device::get_string
   size_t      loc_parameter_size;                                                                   // Parameter size.
   std::string loc_parameter_value;                                                                  // Parameter value.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-
   // Getting parameter size:
   loc_error = clGetDeviceInfo
               (
@@ -67,8 +114,6 @@ cl_uint device::get_cl_uint
   size_t  loc_parameter_size;                                                                       // Parameter size.
   cl_uint loc_parameter_value;                                                                      // Parameter value.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-
   // Getting parameter size:
   loc_error = clGetDeviceInfo
               (
@@ -106,8 +151,6 @@ cl_uint device::get_cl_bool
   size_t  loc_parameter_size;                                                                       // Parameter size.
   cl_bool loc_parameter_value;                                                                      // Parameter value.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-
   // Getting parameter size:
   loc_error = clGetDeviceInfo
               (
@@ -145,8 +188,6 @@ cl_device_fp_config device::get_cl_device_fp_config
   size_t              loc_parameter_size;                                                           // Parameter size.
   cl_device_fp_config loc_parameter_value;                                                          // Parameter value.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-
   // Getting parameter size:
   loc_error = clGetDeviceInfo
               (
@@ -184,8 +225,6 @@ cl_device_exec_capabilities device::get_cl_device_exec_capabilities
   size_t                      loc_parameter_size;                                                   // Parameter size.
   cl_device_exec_capabilities loc_parameter_value;                                                  // Parameter value.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-
   // Getting parameter size:
   loc_error = clGetDeviceInfo
               (
@@ -223,8 +262,6 @@ cl_ulong device::get_cl_ulong
   size_t   loc_parameter_size;                                                                      // Parameter size.
   cl_ulong loc_parameter_value;                                                                     // Parameter value.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-
   // Getting parameter size:
   loc_error = clGetDeviceInfo
               (
@@ -262,8 +299,6 @@ cl_device_mem_cache_type device::get_cl_device_mem_cache_type
   size_t                   loc_parameter_size;                                                      // Parameter size.
   cl_device_mem_cache_type loc_parameter_value;                                                     // Parameter value.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-
   // Getting parameter size:
   loc_error = clGetDeviceInfo
               (
@@ -301,8 +336,6 @@ size_t device::get_size_t
   size_t loc_parameter_size;                                                                        // Parameter size.
   size_t loc_parameter_value;                                                                       // Parameter value.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-
   // Getting parameter size:
   loc_error = clGetDeviceInfo
               (
@@ -340,8 +373,6 @@ cl_device_local_mem_type device::get_cl_device_local_mem_type
   size_t                   loc_parameter_size;                                                      // Parameter size.
   cl_device_local_mem_type loc_parameter_value;                                                     // Parameter value.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-
   // Getting parameter size:
   loc_error = clGetDeviceInfo
               (
@@ -379,8 +410,6 @@ cl_platform_id device::get_cl_platform_id
   size_t         loc_parameter_size;                                                                // Parameter size.
   cl_platform_id loc_parameter_value;                                                               // Parameter value.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-
   // Getting parameter size:
   loc_error = clGetDeviceInfo
               (
@@ -418,8 +447,6 @@ cl_device_type device::get_cl_device_type
   size_t         loc_parameter_size;                                                                // Parameter size.
   cl_device_type loc_parameter_value;                                                               // Parameter value.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-
   // Getting parameter size:
   loc_error = clGetDeviceInfo
               (
@@ -457,8 +484,6 @@ cl_command_queue_properties device::get_cl_command_queue_properties
   size_t                      loc_parameter_size;                                                   // Parameter size.
   cl_command_queue_properties loc_parameter_value;                                                  // Parameter value.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-
   // Getting parameter size:
   loc_error = clGetDeviceInfo
               (
@@ -488,165 +513,276 @@ cl_command_queue_properties device::get_cl_command_queue_properties
 
 void device::init
 (
+ neutrino*    loc_baseline,                                                                         // Neutrino baseline.
  cl_device_id loc_device_id                                                                         // OpenCL deivce ID.
 )
 {
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline = loc_baseline;                                                                          // Getting Neutrino baseline...
+  queried  = false;                                                                                 // Resetting detailed properties flag...
 
-  address_bits                  = get_cl_uint                                                       // Getting device information...
-                                  (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
-                                   CL_DEVICE_ADDRESS_BITS                                           // Parameter of interest [cl_device_info].
-                                  );
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
 
   available                     = get_cl_bool                                                       // Getting device information...
                                   (
                                    loc_device_id,                                                   // OpenCL device id [cl_device_id].
                                    CL_DEVICE_AVAILABLE                                              // Parameter of interest [cl_device_info].
                                   );
-  compiler_available            = get_cl_bool                                                       // Getting device information...
+  extensions                    = get_string                                                        // Getting device information...
+                                  (
+                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   CL_DEVICE_EXTENSIONS                                             // Parameter of interest [cl_device_info].
+                                  );
+  name                          = get_string                                                        // Getting device information...
+                                  (
+                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   CL_DEVICE_NAME                                                   // Parameter of interest [cl_device_info].
+                                  );
+  platform                      = get_cl_platform_id                                                // Getting device information...
+                                  (
+                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   CL_DEVICE_PLATFORM                                               // Parameter of interest [cl_device_info].
+                                  );
+  profile                       = get_string                                                        // Getting device information...
+                                  (
+                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   CL_DEVICE_PROFILE                                                // Parameter of interest [cl_device_info].
+                                  );
+  type                          = get_cl_device_type                                                // Getting device information...
+                                  (
+                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   CL_DEVICE_TYPE                                                   // Parameter of interest [cl_device_info].
+                                  );
+  vendor                        = get_string                                                        // Getting device information...
                                   (
                                    loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   CL_DEVICE_VENDOR                                                 // Parameter of interest [cl_device_info].
+                                  );
+  version                       = get_string                                                        // Getting device information...
+                                  (
+                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   CL_DEVICE_VERSION                                                // Parameter of interest [cl_device_info].
+                                  );
+  driver_version                = get_string                                                        // Getting device information...
+                                  (
+                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   CL_DRIVER_VERSION                                                // Parameter of interest [cl_device_info].
+                                  );
+
+  id                            = loc_device_id;                                                    // Initializing device_id...
+}
+
+void device::query ()
+{
+  std::string   loc_file_name;                                                                      // Capability cache file name.
+  std::ifstream loc_input;                                                                          // Capability cache input file.
+  std::ofstream loc_output;                                                                         // Capability cache output file.
+
+  if(queried)                                                                                       // Checking for already queried properties...
+  {
+    return;
+  }
+
+  queried = true;                                                                                   // Setting detailed properties flag...
+
+  if(baseline->cache && !baseline->cache_home.empty ())                                             // Checking for capability cache...
+  {
+    loc_file_name = baseline->cache_file (baseline->cache_home, "capabilities" + name + '\0' + version, NU_DEVICE_EXTENSION, id);
+    loc_input.open (loc_file_name);                                                                 // Opening cache file...
+
+    // Reading cached properties:
+    if(loc_input >> address_bits
+                 >> compiler_available
+                 >> double_fp_config
+                 >> endian_little
+                 >> error_correction_support
+                 >> execution_capabilities
+                 >> global_mem_cache_size
+                 >> global_mem_cache_type
+                 >> global_mem_cacheline_size
+                 >> global_mem_size
+                 >> half_fp_config
+                 >> image_support
+                 >> image2D_max_height
+                 >> image2D_max_width
+                 >> image3D_max_depth
+                 >> image3D_max_height
+                 >> image3D_max_width
+                 >> local_mem_size
+                 >> local_mem_type
+                 >> max_clock_frequency
+                 >> max_compute_units
+                 >> max_constant_args
+                 >> max_constant_buffer_size
+                 >> max_mem_alloc_size
+                 >> max_parameter_size
+                 >> max_read_image_args
+                 >> max_samplers
+                 >> max_work_group_size
+                 >> max_work_item_dimensions
+                 >> max_write_image_args
+                 >> mem_base_addr_align
+                 >> min_data_type_align_size
+                 >> preferred_vector_width_char
+                 >> preferred_vector_width_short
+                 >> preferred_vector_width_int
+                 >> preferred_vector_width_long
+                 >> preferred_vector_width_float
+                 >> preferred_vector_width_double
+                 >> profiling_timer_resolution
+                 >> queue_properties
+                 >> single_fp_config
+                 >> vendor_id)
+    {
+      loc_input.close ();                                                                           // Closing cache file...
+      return;
+    }
+  }
+
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
+
+  address_bits                  = get_cl_uint                                                       // Getting device information...
+                                  (
+                                   id,                                                              // OpenCL device id [cl_device_id].
+                                   CL_DEVICE_ADDRESS_BITS                                           // Parameter of interest [cl_device_info].
+                                  );
+  compiler_available            = get_cl_bool                                                       // Getting device information...
+                                  (
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_COMPILER_AVAILABLE                                     // Parameter of interest [cl_device_info].
                                   );
   double_fp_config              = get_cl_device_fp_config                                           // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_COMPILER_AVAILABLE                                     // Parameter of interest [cl_device_info].
                                   );
   endian_little                 = get_cl_bool                                                       // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_ENDIAN_LITTLE                                          // Parameter of interest [cl_device_info].
                                   );
   error_correction_support      = get_cl_bool                                                       // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_ERROR_CORRECTION_SUPPORT                               // Parameter of interest [cl_device_info].
                                   );
   execution_capabilities        = get_cl_device_exec_capabilities                                   // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_EXECUTION_CAPABILITIES                                 // Parameter of interest [cl_device_info].
                                   );
-  extensions                    = get_string                                                        // Getting device information...
-                                  (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
-                                   CL_DEVICE_EXTENSIONS                                             // Parameter of interest [cl_device_info].
-                                  );
   global_mem_cache_size         = get_cl_ulong                                                      // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_GLOBAL_MEM_CACHE_SIZE                                  // Parameter of interest [cl_device_info].
                                   );
   global_mem_cache_type         = get_cl_device_mem_cache_type                                      // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_GLOBAL_MEM_CACHE_TYPE                                  // Parameter of interest [cl_device_info].
                                   );
   global_mem_cacheline_size     = get_cl_uint                                                       // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_GLOBAL_MEM_CACHELINE_SIZE                              // Parameter of interest [cl_device_info].
                                   );
   global_mem_size               = get_cl_ulong                                                      // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_GLOBAL_MEM_SIZE                                        // Parameter of interest [cl_device_info].
                                   );
   half_fp_config                = get_cl_device_fp_config                                           // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_GLOBAL_MEM_SIZE                                        // Parameter of interest [cl_device_info].
                                   );
   image_support                 = get_cl_bool                                                       // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_IMAGE_SUPPORT                                          // Parameter of interest [cl_device_info].
                                   );
   image2D_max_height            = get_size_t                                                        // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_IMAGE2D_MAX_HEIGHT                                     // Parameter of interest [cl_device_info].
                                   );
   image2D_max_width             = get_size_t                                                        // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_IMAGE2D_MAX_WIDTH                                      // Parameter of interest [cl_device_info].
                                   );
   image3D_max_depth             = get_size_t                                                        // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_IMAGE3D_MAX_DEPTH                                      // Parameter of interest [cl_device_info].
                                   );
   image3D_max_height            = get_size_t                                                        // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_IMAGE3D_MAX_HEIGHT                                     // Parameter of interest [cl_device_info].
                                   );
   image3D_max_width             = get_size_t                                                        // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_IMAGE3D_MAX_WIDTH                                      // Parameter of interest [cl_device_info].
                                   );
   local_mem_size                = get_cl_ulong                                                      // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_LOCAL_MEM_SIZE                                         // Parameter of interest [cl_device_info].
                                   );
   local_mem_type                = get_cl_device_local_mem_type                                      // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_LOCAL_MEM_TYPE                                         // Parameter of interest [cl_device_info].
                                   );
   max_clock_frequency           = get_cl_uint                                                       // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_MAX_CLOCK_FREQUENCY                                    // Parameter of interest [cl_device_info].
                                   );
   max_compute_units             = get_cl_uint                                                       // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_MAX_COMPUTE_UNITS                                      // Parameter of interest [cl_device_info].
                                   );
   max_constant_args             = get_cl_uint                                                       // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_MAX_CONSTANT_ARGS                                      // Parameter of interest [cl_device_info].
                                   );
   max_constant_buffer_size      = get_cl_ulong                                                      // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_MAX_CONSTANT_BUFFER_SIZE                               // Parameter of interest [cl_device_info].
                                   );
   max_mem_alloc_size            = get_cl_ulong                                                      // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_MAX_MEM_ALLOC_SIZE                                     // Parameter of interest [cl_device_info].
                                   );
   max_parameter_size            = get_size_t                                                        // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_MAX_PARAMETER_SIZE                                     // Parameter of interest [cl_device_info].
                                   );
   max_read_image_args           = get_cl_uint                                                       // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_MAX_READ_IMAGE_ARGS                                    // Parameter of interest [cl_device_info].
                                   );
   max_samplers                  = get_cl_uint                                                       // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_MAX_SAMPLERS                                           // Parameter of interest [cl_device_info].
                                   );
   max_work_group_size           = get_size_t                                                        // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_MAX_WORK_GROUP_SIZE                                    // Parameter of interest [cl_device_info].
                                   );
   max_work_item_dimensions      = get_cl_uint                                                       // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_MAX_WORK_ITEM_DIMENSIONS                               // Parameter of interest [cl_device_info].
                                   );
 /*
@@ -657,110 +793,201 @@ void device::init
  */
   max_write_image_args          = get_cl_uint                                                       // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_MAX_WRITE_IMAGE_ARGS                                   // Parameter of interest [cl_device_info].
                                   );
   mem_base_addr_align           = get_cl_uint                                                       // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_MEM_BASE_ADDR_ALIGN                                    // Parameter of interest [cl_device_info].
                                   );
   min_data_type_align_size      = get_cl_uint                                                       // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_MIN_DATA_TYPE_ALIGN_SIZE                               // Parameter of interest [cl_device_info].
                                   );
-  name                          = get_string                                                        // Getting device information...
-                                  (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
-                                   CL_DEVICE_NAME                                                   // Parameter of interest [cl_device_info].
-                                  );
-  platform                      = get_cl_platform_id                                                // Getting device information...
-                                  (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
-                                   CL_DEVICE_PLATFORM                                               // Parameter of interest [cl_device_info].
-                                  );
   preferred_vector_width_char   = get_cl_uint                                                       // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_PREFERRED_VECTOR_WIDTH_CHAR                            // Parameter of interest [cl_device_info].
                                   );
   preferred_vector_width_short  = get_cl_uint                                                       // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_PREFERRED_VECTOR_WIDTH_SHORT                           // Parameter of interest [cl_device_info].
                                   );
   preferred_vector_width_int    = get_cl_uint                                                       // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_PREFERRED_VECTOR_WIDTH_INT                             // Parameter of interest [cl_device_info].
                                   );
   preferred_vector_width_long   = get_cl_uint                                                       // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_PREFERRED_VECTOR_WIDTH_LONG                            // Parameter of interest [cl_device_info].
                                   );
   preferred_vector_width_float  = get_cl_uint                                                       // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_PREFERRED_VECTOR_WIDTH_FLOAT                           // Parameter of interest [cl_device_info].
                                   );
   preferred_vector_width_double = get_cl_uint                                                       // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_PREFERRED_VECTOR_WIDTH_DOUBLE                          // Parameter of interest [cl_device_info].
                                   );
-
-  profile                       = get_string                                                        // Getting device information...
-                                  (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
-                                   CL_DEVICE_PROFILE                                                // Parameter of interest [cl_device_info].
-                                  );
   profiling_timer_resolution    = get_size_t                                                        // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_PROFILING_TIMER_RESOLUTION                             // Parameter of interest [cl_device_info].
                                   );
   queue_properties              = get_cl_command_queue_properties                                   // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_QUEUE_PROPERTIES                                       // Parameter of interest [cl_device_info].
                                   );
   single_fp_config              = get_cl_device_fp_config                                           // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_SINGLE_FP_CONFIG                                       // Parameter of interest [cl_device_info].
                                   );
-  type                          = get_cl_device_type                                                // Getting device information...
-                                  (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
-                                   CL_DEVICE_TYPE                                                   // Parameter of interest [cl_device_info].
-                                  );
-  vendor                        = get_string                                                        // Getting device information...
-                                  (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
-                                   CL_DEVICE_VENDOR                                                 // Parameter of interest [cl_device_info].
-                                  );
   vendor_id                     = get_cl_uint                                                       // Getting device information...
                                   (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
+                                   id,                                                              // OpenCL device id [cl_device_id].
                                    CL_DEVICE_VENDOR_ID                                              // Parameter of interest [cl_device_info].
                                   );
-  version                       = get_string                                                        // Getting device information...
-                                  (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
-                                   CL_DEVICE_VERSION                                                // Parameter of interest [cl_device_info].
-                                  );
-  driver_version                = get_string                                                        // Getting device information...
-                                  (
-                                   loc_device_id,                                                   // OpenCL device id [cl_device_id].
-                                   CL_DRIVER_VERSION                                                // Parameter of interest [cl_device_info].
-                                  );
 
-  id                            = loc_device_id;                                                    // Initializing device_id...
+  if(!loc_file_name.empty ())                                                                       // Checking for capability cache...
+  {
+    loc_output.open (loc_file_name);                                                                // Opening cache file...
+
+    // Writing properties:
+    loc_output << address_bits << std::endl
+               << compiler_available << std::endl
+               << double_fp_config << std::endl
+               << endian_little << std::endl
+               << error_correction_support << std::endl
+               << execution_capabilities << std::endl
+               << global_mem_cache_size << std::endl
+               << global_mem_cache_type << std::endl
+               << global_mem_cacheline_size << std::endl
+               << global_mem_size << std::endl
+               << half_fp_config << std::endl
+               << image_support << std::endl
+               << image2D_max_height << std::endl
+               << image2D_max_width << std::endl
+               << image3D_max_depth << std::endl
+               << image3D_max_height << std::endl
+               << image3D_max_width << std::endl
+               << local_mem_size << std::endl
+               << local_mem_type << std::endl
+               << max_clock_frequency << std::endl
+               << max_compute_units << std::endl
+               << max_constant_args << std::endl
+               << max_constant_buffer_size << std::endl
+               << max_mem_alloc_size << std::endl
+               << max_parameter_size << std::endl
+               << max_read_image_args << std::endl
+               << max_samplers << std::endl
+               << max_work_group_size << std::endl
+               << max_work_item_dimensions << std::endl
+               << max_write_image_args << std::endl
+               << mem_base_addr_align << std::endl
+               << min_data_type_align_size << std::endl
+               << preferred_vector_width_char << std::endl
+               << preferred_vector_width_short << std::endl
+               << preferred_vector_width_int << std::endl
+               << preferred_vector_width_long << std::endl
+               << preferred_vector_width_float << std::endl
+               << preferred_vector_width_double << std::endl
+               << profiling_timer_resolution << std::endl
+               << queue_properties << std::endl
+               << single_fp_config << std::endl
+               << vendor_id << std::endl;
+
+    loc_output.close ();                                                                            // Closing cache file...
+  }
+}
+
+cl_uint device::partition
+(
+ device_partition loc_partition,                                                                    // Device partition.
+ cl_uint          loc_units                                                                         // Compute units per sub-device (NU_PARTITION_EQUALLY) [#].
+)
+{
+  cl_int                           loc_error;                                                       // Error code.
+  cl_uint                          loc_number = 0;                                                  // Number of sub-devices [#].
+  cl_device_partition_property     loc_property[3];                                                 // Partition properties.
+  size_t                           i;                                                               // Index.
+
+  for(i = 0; i < sub_device.size (); i++)                                                           // Scanning previous sub-devices...
+  {
+    clReleaseDevice (sub_device[i]);                                                                // Releasing sub-device...
+  }
+
+  sub_device.clear ();                                                                              // Resetting sub-device array...
+
+  switch(loc_partition)                                                                             // Selecting partition...
+  {
+    case NU_PARTITION_NUMA:
+      loc_property[0] = CL_DEVICE_PARTITION_BY_AFFINITY_DOMAIN;                                     // Setting partition by affinity domain...
+      loc_property[1] = CL_DEVICE_AFFINITY_DOMAIN_NUMA;                                             // Setting NUMA affinity domain...
+      loc_property[2] = 0;                                                                          // Terminating property list...
+      break;
+
+    case NU_PARTITION_EQUALLY:
+      loc_property[0] = CL_DEVICE_PARTITION_EQUALLY;                                                // Setting equal partition...
+      loc_property[1] = (cl_device_partition_property)std::max (loc_units, (cl_uint)1);             // Setting compute units per sub-device...
+      loc_property[2] = 0;                                                                          // Terminating property list...
+      break;
+
+    default:
+      return 0;                                                                                     // Returning no sub-devices...
+  }
+
+  baseline->action ("partitioning OpenCL device...");                                               // Printing message...
+
+  // Getting number of sub-devices:
+  loc_error = clCreateSubDevices
+              (
+               id,                                                                                  // OpenCL device id.
+               loc_property,                                                                        // Partition properties.
+               0,                                                                                   // "0" = we ask for the number of sub-devices.
+               NULL,                                                                                // Dummy parameter.
+               &loc_number                                                                          // Returned number of sub-devices.
+              );
+
+  if((loc_error != CL_SUCCESS) || (loc_number == 0))                                                // Checking for supported partition...
+  {
+    baseline->warning ("device partition not supported!");                                          // Printing message...
+    baseline->unfulfilled ();                                                                       // Printing message...
+    return 0;                                                                                       // Returning no sub-devices...
+  }
+
+  sub_device.resize (loc_number);                                                                   // Allocating sub-device array...
+
+  // Creating sub-devices:
+  loc_error = clCreateSubDevices
+              (
+               id,                                                                                  // OpenCL device id.
+               loc_property,                                                                        // Partition properties.
+               loc_number,                                                                          // Number of sub-devices.
+               sub_device.data (),                                                                  // Returned sub-device ids.
+               NULL                                                                                 // Returned number of sub-devices (NULL = ignored).
+              );
+
+  baseline->check_error (loc_error);                                                                // Checking error...
+  baseline->done ();                                                                                // Printing message...
+
+  return loc_number;                                                                                // Returning number of sub-devices...
 }
 
 device::~device()
 {
+  size_t i;                                                                                         // Index.
 
+  for(i = 0; i < sub_device.size (); i++)                                                           // Scanning sub-devices...
+  {
+    clReleaseDevice (sub_device[i]);                                                                // Releasing sub-device...
+  }
 }
@@ -0,0 +1,317 @@
+/// @file     ensemble.cpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Definition of the "ensemble" class.
+
+#include "ensemble.hpp"
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// "ensemble" class //////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+ensemble::ensemble()
+{
+  baseline        = NULL;                                                                           // Initializing Neutrino baseline...
+  instances       = 0;                                                                              // Initializing number of instances...
+  instance_size_i = 0;                                                                              // Initializing instance size (i-index)...
+  instance_size_j = 0;                                                                              // Initializing instance size (j-index)...
+  elements        = 0;                                                                              // Initializing elements per instance...
+  size            = 0;                                                                              // Initializing elements of all instances...
+  size_i          = 0;                                                                              // Initializing kernel size (i-index)...
+  size_j          = 0;                                                                              // Initializing kernel size (j-index)...
+  size_k          = 0;                                                                              // Initializing kernel size (k-index)...
+}
+
+void ensemble::init
+(
+ neutrino* loc_baseline,                                                                            // Neutrino baseline.
+ size_t    loc_instances,                                                                           // Number of instances [#].
+ size_t    loc_instance_size_i,                                                                     // Instance size (i-index) [#].
+ size_t    loc_instance_size_j                                                                      // Instance size (j-index) [#].
+)
+{
+  baseline        = loc_baseline;                                                                   // Getting Neutrino baseline...
+  instances       = std::max (loc_instances, (size_t)1);                                            // Getting number of instances...
+  instance_size_i = std::max (loc_instance_size_i, (size_t)1);                                      // Getting instance size (i-index)...
+  instance_size_j = std::max (loc_instance_size_j, (size_t)1);                                      // Getting instance size (j-index)...
+  elements        = instance_size_i*instance_size_j;                                                // Computing elements per instance...
+  size            = elements*instances;                                                             // Computing elements of all instances...
+
+  if(instance_size_j == 1)                                                                          // Checking for 1D instances...
+  {
+    size_i = instance_size_i;                                                                       // Setting kernel size (i-index)...
+    size_j = instances;                                                                             // Setting kernel size (j-index = instance)...
+    size_k = 1;                                                                                     // Setting kernel size (k-index)...
+  }
+
+  else
+  {
+    size_i = instance_size_i;                                                                       // Setting kernel size (i-index)...
+    size_j = instance_size_j;                                                                       // Setting kernel size (j-index)...
+    size_k = instances;                                                                             // Setting kernel size (k-index = instance)...
+  }
+}
+
+size_t ensemble::offset
+(
+ size_t loc_instance                                                                                // Instance index.
+)
+{
+  if(loc_instance >= instances)                                                                     // Checking instance index...
+  {
+    baseline->error ("Ensemble instance index out of range!");                                      // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  return loc_instance*elements;                                                                     // Returning instance offset...
+}
+
+void ensemble::read_instance
+(
+ queue* loc_queue,                                                                                  // OpenCL queue.
+ cl_mem loc_buffer,                                                                                 // Data buffer.
+ void*  loc_data,                                                                                   // Data storage.
+ size_t loc_element_size,                                                                           // Data element size [bytes].
+ size_t loc_instance                                                                                // Instance index.
+)
+{
+  cl_int   loc_error;                                                                               // Local error code.
+  size_t   loc_offset = offset (loc_instance)*loc_element_size;                                     // Instance offset [bytes].
+  cl_ulong loc_span   = baseline->trace_begin ();                                                   // Trace span beginning [ns].
+
+  // Reading OpenCL buffer (instance range):
+  loc_error = clEnqueueReadBuffer
+              (
+               loc_queue->queue_id,                                                                 // OpenCL queue ID.
+               loc_buffer,                                                                          // Data buffer.
+               CL_TRUE,                                                                             // Blocking read flag.
+               loc_offset,                                                                          // Data buffer offset.
+               elements*loc_element_size,                                                           // Data buffer size.
+               (char*)loc_data + loc_offset,                                                        // Data storage.
+               0,                                                                                   // Number of events in the list.
+               NULL,                                                                                // Event list.
+               NULL                                                                                 // Event.
+              );
+  baseline->check_error (loc_error);                                                                // Checking error...
+  baseline->trace_end ("read instance", loc_span);                                                  // Appending trace span...
+}
+
+void ensemble::stack
+(
+ int1* loc_data                                                                                     // int1 object.
+)
+{
+  loc_data->init (size);                                                                            // Allocating stacked data...
+}
+
+void ensemble::stack
+(
+ int2* loc_data                                                                                     // int2 object.
+)
+{
+  loc_data->init (size);                                                                            // Allocating stacked data...
+}
+
+void ensemble::stack
+(
+ int3* loc_data                                                                                     // int3 object.
+)
+{
+  loc_data->init (size);                                                                            // Allocating stacked data...
+}
+
+void ensemble::stack
+(
+ int4* loc_data                                                                                     // int4 object.
+)
+{
+  loc_data->init (size);                                                                            // Allocating stacked data...
+}
+
+void ensemble::stack
+(
+ float1* loc_data                                                                                   // float1 object.
+)
+{
+  loc_data->init (size);                                                                            // Allocating stacked data...
+}
+
+void ensemble::stack
+(
+ float2* loc_data                                                                                   // float2 object.
+)
+{
+  loc_data->init (size);                                                                            // Allocating stacked data...
+}
+
+void ensemble::stack
+(
+ float3* loc_data                                                                                   // float3 object.
+)
+{
+  loc_data->init (size);                                                                            // Allocating stacked data...
+}
+
+void ensemble::stack
+(
+ float4* loc_data                                                                                   // float4 object.
+)
+{
+  loc_data->init (size);                                                                            // Allocating stacked data...
+}
+
+cl_long* ensemble::view
+(
+ int1*   loc_data,                                                                                  // int1 object.
+ size_t  loc_instance                                                                               // Instance index.
+)
+{
+  return loc_data->data + offset (loc_instance);                                                    // Returning instance data...
+}
+
+int2_structure* ensemble::view
+(
+ int2*   loc_data,                                                                                  // int2 object.
+ size_t  loc_instance                                                                               // Instance index.
+)
+{
+  return loc_data->data + offset (loc_instance);                                                    // Returning instance data...
+}
+
+int3_structure* ensemble::view
+(
+ int3*   loc_data,                                                                                  // int3 object.
+ size_t  loc_instance                                                                               // Instance index.
+)
+{
+  return loc_data->data + offset (loc_instance);                                                    // Returning instance data...
+}
+
+int4_structure* ensemble::view
+(
+ int4*   loc_data,                                                                                  // int4 object.
+ size_t  loc_instance                                                                               // Instance index.
+)
+{
+  return loc_data->data + offset (loc_instance);                                                    // Returning instance data...
+}
+
+cl_float* ensemble::view
+(
+ float1* loc_data,                                                                                  // float1 object.
+ size_t  loc_instance                                                                               // Instance index.
+)
+{
+  return loc_data->data + offset (loc_instance);                                                    // Returning instance data...
+}
+
+float2_structure* ensemble::view
+(
+ float2* loc_data,                                                                                  // float2 object.
+ size_t  loc_instance                                                                               // Instance index.
+)
+{
+  return loc_data->data + offset (loc_instance);                                                    // Returning instance data...
+}
+
+float3_structure* ensemble::view
+(
+ float3* loc_data,                                                                                  // float3 object.
+ size_t  loc_instance                                                                               // Instance index.
+)
+{
+  return loc_data->data + offset (loc_instance);                                                    // Returning instance data...
+}
+
+float4_structure* ensemble::view
+(
+ float4* loc_data,                                                                                  // float4 object.
+ size_t  loc_instance                                                                               // Instance index.
+)
+{
+  return loc_data->data + offset (loc_instance);                                                    // Returning instance data...
+}
+
+void ensemble::read
+(
+ queue*  loc_queue,                                                                                 // OpenCL queue.
+ int1*   loc_data,                                                                                  // int1 object.
+ size_t  loc_instance                                                                               // Instance index.
+)
+{
+  read_instance (loc_queue, loc_data->buffer, loc_data->data, sizeof(cl_long), loc_instance);       // Reading instance...
+}
+
+void ensemble::read
+(
+ queue*  loc_queue,                                                                                 // OpenCL queue.
+ int2*   loc_data,                                                                                  // int2 object.
+ size_t  loc_instance                                                                               // Instance index.
+)
+{
+  read_instance (loc_queue, loc_data->buffer, loc_data->data, sizeof(int2_structure), loc_instance); // Reading instance...
+}
+
+void ensemble::read
+(
+ queue*  loc_queue,                                                                                 // OpenCL queue.
+ int3*   loc_data,                                                                                  // int3 object.
+ size_t  loc_instance                                                                               // Instance index.
+)
+{
+  read_instance (loc_queue, loc_data->buffer, loc_data->data, sizeof(int3_structure), loc_instance); // Reading instance...
+}
+
+void ensemble::read
+(
+ queue*  loc_queue,                                                                                 // OpenCL queue.
+ int4*   loc_data,                                                                                  // int4 object.
+ size_t  loc_instance                                                                               // Instance index.
+)
+{
+  read_instance (loc_queue, loc_data->buffer, loc_data->data, sizeof(int4_structure), loc_instance); // Reading instance...
+}
+
+void ensemble::read
+(
+ queue*  loc_queue,                                                                                 // OpenCL queue.
+ float1* loc_data,                                                                                  // float1 object.
+ size_t  loc_instance                                                                               // Instance index.
+)
+{
+  read_instance (loc_queue, loc_data->buffer, loc_data->data, sizeof(cl_float), loc_instance);      // Reading instance...
+}
+
+void ensemble::read
+(
+ queue*  loc_queue,                                                                                 // OpenCL queue.
+ float2* loc_data,                                                                                  // float2 object.
+ size_t  loc_instance                                                                               // Instance index.
+)
+{
+  read_instance (loc_queue, loc_data->buffer, loc_data->data, sizeof(float2_structure), loc_instance); // Reading instance...
+}
+
+void ensemble::read
+(
+ queue*  loc_queue,                                                                                 // OpenCL queue.
+ float3* loc_data,                                                                                  // float3 object.
+ size_t  loc_instance                                                                               // Instance index.
+)
+{
+  read_instance (loc_queue, loc_data->buffer, loc_data->data, sizeof(float3_structure), loc_instance); // Reading instance...
+}
+
+void ensemble::read
+(
+ queue*  loc_queue,                                                                                 // OpenCL queue.
+ float4* loc_data,                                                                                  // float4 object.
+ size_t  loc_instance                                                                               // Instance index.
+)
+{
+  read_instance (loc_queue, loc_data->buffer, loc_data->data, sizeof(float4_structure), loc_instance); // Reading instance...
+}
+
+ensemble::~ensemble()
+{
+
+}
@@ -10,12 +10,41 @@
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 kernel::kernel()
 {
-  program   = NULL;                                                                                 // Initializing kernel program...
-  size_i    = 0;                                                                                    // Initializing kernel size (i-index)...
-  size_j    = 0;                                                                                    // Initializing kernel size (j-index)...
-  size_k    = 0;                                                                                    // Initializing kernel size (k-index)...
-  event     = NULL;                                                                                 // Initializing kernel event...
-  kernel_id = NULL;                                                                                 // Initializing kernel id...
+  program          = NULL;                                                                          // Initializing kernel program...
+  size_i           = 0;                                                                             // Initializing kernel size (i-index)...
+  size_j           = 0;                                                                             // Initializing kernel size (j-index)...
+  size_k           = 0;                                                                             // Initializing kernel size (k-index)...
+  local_i          = 0;                                                                             // Initializing kernel local size (i-index, driver choice)...
+  local_j          = 0;                                                                             // Initializing kernel local size (j-index)...
+  local_k          = 0;                                                                             // Initializing kernel local size (k-index)...
+  chunk_offset     = 0;                                                                             // Initializing chunked execution offset...
+  event            = NULL;                                                                          // Initializing kernel event...
+  kernel_id        = NULL;                                                                          // Initializing kernel id...
+  compiler_options = "";                                                                            // Initializing compiler options...
+  kernel_name      = NU_KERNEL_NAME;                                                                // Initializing kernel entry point name...
+  watch_stop       = false;                                                                         // Initializing source watcher "stop" flag...
+  reload_program   = NULL;                                                                          // Initializing rebuilt program...
+  reload_kernel    = NULL;                                                                          // Initializing rebuilt kernel...
+  reload_ready     = false;                                                                         // Initializing rebuilt kernel "ready" flag...
+  replica_program  = NULL;                                                                          // Initializing program of the kernel copies...
+  il               = false;                                                                         // Initializing SPIR-V program flag...
+}
+
+void kernel::option
+(
+ std::string loc_option                                                                             // Compiler option.
+)
+{
+  compiler_options += " " + loc_option;                                                             // Appending compiler option...
+}
+
+void kernel::define
+(
+ std::string loc_name,                                                                              // Macro name.
+ std::string loc_value                                                                              // Macro value.
+)
+{
+  constant[loc_name] = loc_value;                                                                   // Setting specialization constant...
 }
 
 void kernel::init
@@ -30,11 +59,6 @@ void kernel::init
 {
   cl_int      loc_error;                                                                            // Error code.
   std::string loc_slash;                                                                            // Slash character, according to the operating system.
-  size_t      loc_log_size;                                                                         // OpenCL JIT compiler log size.
-  size_t*     loc_kernel_source_size;                                                               // Source file as string.
-  char**      loc_kernel_source;                                                                    // Source file temporary char buffer.
-  char*       loc_options;                                                                          // Options temporary char buffer.
-  size_t      loc_options_size;                                                                     // Options temporary char buffer size.
   size_t      i;                                                                                    // Index.
 
   baseline                              = loc_baseline;                                             // Getting Neutrino baseline...
@@ -56,14 +80,7 @@ void kernel::init
     loc_slash                           = "\\";                                                     // Setting slash according to Windows...
   #endif
 
-  compiler_options                      = "";                                                       // Setting no options...
-  loc_options_size                      = compiler_options.size () + 1;                             // Setting temporary options char buffer size...
-  loc_options                           = new char[loc_options_size]();                             // Building temporary options char buffer...
-  loc_options[loc_options_size - 1]     = '\0';                                                     // Null terminating options string...
-  compiler_options.copy (loc_options, compiler_options.size ());                                    // Building options string...
-
-  loc_kernel_source_size                = new size_t[loc_kernel_file_name.size ()]();               // Building temporary kernel source char buffer size...
-  loc_kernel_source                     = new char*[loc_kernel_file_name.size ()]();                // Building temporary kernel source char buffer...
+  build_options                         = baseline->build_options (compiler_options, constant);     // Getting compiler options, including specialization macros...
 
   for(i = 0; i < loc_kernel_file_name.size (); i++)
   {
@@ -74,88 +91,46 @@ void kernel::init
                                 loc_kernel_file_name[i]
                                );                                                                   // Building up vertex file full name...
     kernel_source.push_back (baseline->read_file (kernel_file_name[i]));                            // Loading file...
-    loc_kernel_source_size[i]                       = kernel_source[i].size ();                     // Getting source size...
-    loc_kernel_source[i]                            = new char[loc_kernel_source_size[i] + 1]();    // Building temporary source char buffer...
-    loc_kernel_source[i][loc_kernel_source_size[i] - 1] = '\0';                                     // Null terminating buffer string...
-    kernel_source[i].copy (loc_kernel_source[i], kernel_source[i].size ());                         // Building string source buffer...
-    
     baseline->done ();                                                                              // Printing message...
   }
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-
-  baseline->action ("creating OpenCL program from kernel source...");                               // Printing message...
-  program = clCreateProgramWithSource
-            (
-             baseline->context_id,                                                                  // OpenCL context ID.
-             (cl_uint)kernel_file_name.size (),                                                     // Number of program sources.
-             (const char**)loc_kernel_source,                                                       // Program source.
-             loc_kernel_source_size,                                                                // Source size.
-             &loc_error                                                                             // Error code.
-            );
-  baseline->check_error (loc_error);                                                                // Checking error...
-  baseline->done ();                                                                                // Printing message...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
 
-  delete[] loc_kernel_source;                                                                       // Deleting buffer...
-  delete loc_kernel_source_size;                                                                    // Deleting buffer...
+  // Creating device ID list:
+  device_id    = new cl_device_id[baseline->device_list.size ()];                                   // OpenCL device ID.
 
-  baseline->action ("building OpenCL program...");                                                  // Printing message...
+  for(i = 0; i < baseline->device_list.size (); i++)                                                // Scanning context devices...
+  {
+    device_id[i] = baseline->device_list[i];                                                        // Getting device ID.
+  }
 
-  // Creating device ID list:
-  device_id    = new cl_device_id[1];                                                               // OpenCL device ID.
-  device_id[0] = baseline->device_id;                                                               // Getting device ID.
-
-  // Building OpenCL program:
-  loc_error    = clBuildProgram
-                 (
-                  program,                                                                          // Program.
-                  1,                                                                                // Number of devices.
-                  device_id,                                                                        // Device ID.
-                  loc_options,                                                                      // Including header files from kernel's directory.
-                  NULL,                                                                             // Notification routine.
-                  NULL                                                                              // Notification argument.
-                 );
-
-  delete loc_options;
-
-  if(loc_error != CL_SUCCESS)                                                                       // Checking compiled kernel...
-  {
-    baseline->error (baseline->get_error (loc_error));                                              // Printing message...
-
-    // Getting OpenCL compiler information:
-    loc_error = clGetProgramBuildInfo
-                (
-                 program,                                                                           // Program.
-                 device_id[0],                                                                      // Device ID.
-                 CL_PROGRAM_BUILD_LOG,                                                              // Build log parameter.
-                 0,                                                                                 // Dummy parameter size.
-                 NULL,                                                                              // Dummy parameter value.
-                 &loc_log_size                                                                      // Size of log.
-                );
-
-    char* loc_log_buffer = new char[loc_log_size + 1]();                                            // Allocating log buffer...
-
-    // Reading OpenCL compiler error log:
-    loc_error    = clGetProgramBuildInfo
-                   (
-                    program,                                                                        // Program.
-                    device_id[0],                                                                   // Device ID.
-                    CL_PROGRAM_BUILD_LOG,                                                           // Build log parameter.
-                    loc_log_size + 1,                                                               // Log size.
-                    loc_log_buffer,                                                                 // The log.
-                    NULL                                                                            // Dummy size parameter.
-                   );
+  program = NULL;                                                                                   // Resetting program...
 
-    compiler_log = loc_log_buffer;                                                                  // Setting compiler log...
-    std::cout << "" << std::endl;                                                                   // Printing message...
-    std::cout << "See error log:" << std::endl;                                                     // Printing message...
-    std::cout << "" << std::endl;                                                                   // Printing message...
-    std::cout << compiler_log << std::endl;                                                         // Printing log...
-    delete[] (loc_log_buffer);                                                                      // Deleting log buffer...
-    exit (loc_error);                                                                               // Exiting...
+  if(constant.empty ())                                                                             // Checking for specialization constants (not applicable to SPIR-V modules)...
+  {
+    program = baseline->load_il (kernel_file_name, compiler_options);                               // Loading precompiled SPIR-V module...
   }
 
-  baseline->done ();                                                                                // Printing message...
+  il = (program != NULL);                                                                           // Setting SPIR-V program flag...
+
+  if(program == NULL)                                                                               // Checking for SPIR-V module...
+  {
+    // Building OpenCL program (from the binary cache, if any):
+    program = baseline->build_program
+              (
+               baseline->context_id,                                                                // OpenCL context ID.
+               baseline->device_list,                                                               // Device ID list.
+               kernel_home,                                                                         // Kernel home directory.
+               kernel_source,                                                                       // Kernel sources.
+               build_options,                                                                       // Compiler options.
+               compiler_log                                                                         // Compiler log.
+              );
+
+    if(program == NULL)                                                                             // Checking compiled kernel...
+    {
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
+  }
 
   baseline->action ("creating OpenCL kernel object from program...");                               // Printing message...
 
@@ -171,6 +146,80 @@ void kernel::init
 
   baseline->done ();                                                                                // Printing message...
 
+  describe ();                                                                                      // Getting argument metadata (rebuilding from source, if needed)...
+
+  // Initializing kernel object:
+  baseline->action ("initializing kernel object...");                                               // Printing message...
+
+  for(i = 0; i < baseline->k_num; i++)                                                              // Scanning OpenCL kernel argument array...
+  {
+    if(baseline->kernel_id[i] == NULL)                                                              // Looking for 1st non-assigned OpenCL kernel ID...
+    {
+      baseline->kernel_id[i] = kernel_id;                                                           // Assigning value to 1st non-assigned OpenCL kernel ID...
+      break;                                                                                        // Exiting loop...
+    }
+  }
+
+  baseline->done ();                                                                                // Printing message...
+}
+
+void kernel::init
+(
+ neutrino*                loc_baseline,                                                             // Neutrino baseline.
+ library*                 loc_library,                                                              // OpenCL library.
+ std::string              loc_kernel_name,                                                          // OpenCL kernel entry point name.
+ size_t                   loc_kernel_size_i,                                                        // OpenCL kernel size (i-index).
+ size_t                   loc_kernel_size_j,                                                        // OpenCL kernel size (j-index).
+ size_t                   loc_kernel_size_k                                                         // OpenCL kernel size (k-index).
+)
+{
+  cl_int      loc_error;                                                                            // Error code.
+  size_t      i;                                                                                    // Index.
+
+  baseline         = loc_baseline;                                                                  // Getting Neutrino baseline...
+  size_i           = loc_kernel_size_i;                                                             // Getting OpenCL kernel size (i-index)...
+  size_j           = loc_kernel_size_j;                                                             // Getting OpenCL kernel size (j-index)...
+  size_k           = loc_kernel_size_k;                                                             // Getting OpenCL kernel size (k-index)...
+
+  kernel_home      = loc_library->library_home;                                                     // Getting OpenCL kernel home directory...
+  kernel_file_name = loc_library->library_file_name;                                                // Getting OpenCL kernel file names...
+  kernel_source    = loc_library->library_source;                                                   // Getting OpenCL kernel sources...
+  compiler_options = loc_library->compiler_options;                                                 // Getting compiler options...
+  constant         = loc_library->constant;                                                         // Getting specialization constants...
+  kernel_name      = loc_kernel_name;                                                               // Getting kernel entry point name...
+  build_options    = baseline->build_options (compiler_options, constant);                          // Getting compiler options (as built by the library, for hot reload)...
+
+  // Creating device ID list:
+  device_id        = new cl_device_id[baseline->device_list.size ()];                               // OpenCL device ID.
+
+  for(i = 0; i < baseline->device_list.size (); i++)                                                // Scanning context devices...
+  {
+    device_id[i] = baseline->device_list[i];                                                        // Getting device ID.
+  }
+
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
+
+  baseline->action ("creating OpenCL kernel object from library...");                               // Printing message...
+
+  program          = loc_library->program;                                                          // Getting library program...
+  il               = loc_library->il;                                                               // Getting SPIR-V program flag...
+  loc_error        = clRetainProgram (program);                                                     // Retaining library program (released by the destructor)...
+  baseline->check_error (loc_error);                                                                // Checking error...
+
+  // Creating OpenCL kernel:
+  kernel_id        = clCreateKernel
+                     (
+                      program,                                                                      // OpenCL kernel program.
+                      kernel_name.c_str (),                                                         // Kernel name.
+                      &loc_error                                                                    // Error code.
+                     );
+
+  baseline->check_error (loc_error);                                                                // Checking error...
+
+  baseline->done ();                                                                                // Printing message...
+
+  describe ();                                                                                      // Getting argument metadata (rebuilding from source, if needed)...
+
   // Initializing kernel object:
   baseline->action ("initializing kernel object...");                                               // Printing message...
 
@@ -195,22 +244,22 @@ void kernel::setarg
  cl_uint loc_layout_index                                                                           // Layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Error code.
+  cl_int   loc_error;                                                                               // Error code.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
 
   baseline->action ("setting kernel argument...");                                                  // Printing message...
 
+  check (loc_layout_index, "long", 1);                                                              // Checking argument metadata...
+
   loc_data->layout = loc_layout_index;                                                              // Setting layout index.
 
   if(!loc_data->ready)
   {
     // Creating OpenCL memory buffer:
-    loc_data->buffer = clCreateBuffer
+    loc_data->buffer = baseline->create_buffer
                        (
-                        baseline->context_id,                                                       // OpenCL context.
-                        CL_MEM_READ_WRITE |                                                         // Memory flag.
-                        CL_MEM_COPY_HOST_PTR,                                                       // Memory flag.
                         sizeof(cl_long)*loc_data->size,                                             // Data buffer size.
                         loc_data->data,                                                             // Data buffer.
                         &loc_error                                                                  // Error code.
@@ -221,15 +270,26 @@ void kernel::setarg
     loc_data->ready = true;                                                                         // Setting "ready" flag...
   }
 
-  loc_error = clSetKernelArg
+  // Storing argument size (for profiling):
+  if(argument_bytes.size () <= loc_layout_index)
+  {
+    argument_bytes.resize (loc_layout_index + 1, 0);                                                // Resizing argument size array...
+  }
+
+  argument_bytes[loc_layout_index] = sizeof(cl_long)*loc_data->size;                                // Setting argument size...
+
+  loc_error = bind
               (
-               kernel_id,                                                                           // Kernel id.
-               (cl_uint)loc_layout_index,                                                           // Layout index.
+               loc_layout_index,                                                                    // Layout index.
                sizeof(cl_mem),                                                                      // Data size.
                &loc_data->buffer                                                                    // Data value.
               );
 
+  baseline->check_error (loc_error);                                                                // Checking returned error code...
+
   baseline->done ();                                                                                // Printing message...
+
+  baseline->trace_end ("setarg", loc_span);                                                         // Appending trace span...
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -241,22 +301,22 @@ void kernel::setarg
  cl_uint loc_layout_index                                                                           // Layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Error code.
+  cl_int   loc_error;                                                                               // Error code.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
 
   baseline->action ("setting kernel argument...");                                                  // Printing message...
 
+  check (loc_layout_index, "long", 2);                                                              // Checking argument metadata...
+
   loc_data->layout = loc_layout_index;                                                              // Setting layout index.
 
   if(!loc_data->ready)
   {
     // Creating OpenCL memory buffer:
-    loc_data->buffer = clCreateBuffer
+    loc_data->buffer = baseline->create_buffer
                        (
-                        baseline->context_id,                                                       // OpenCL context.
-                        CL_MEM_READ_WRITE |                                                         // Memory flag.
-                        CL_MEM_COPY_HOST_PTR,                                                       // Memory flag.
                         sizeof(int2_structure)*loc_data->size,                                      // Data buffer size.
                         loc_data->data,                                                             // Data buffer.
                         &loc_error                                                                  // Error code.
@@ -267,15 +327,26 @@ void kernel::setarg
     loc_data->ready = true;                                                                         // Setting "ready" flag...
   }
 
-  loc_error = clSetKernelArg
+  // Storing argument size (for profiling):
+  if(argument_bytes.size () <= loc_layout_index)
+  {
+    argument_bytes.resize (loc_layout_index + 1, 0);                                                // Resizing argument size array...
+  }
+
+  argument_bytes[loc_layout_index] = sizeof(int2_structure)*loc_data->size;                         // Setting argument size...
+
+  loc_error = bind
               (
-               kernel_id,                                                                           // Kernel id.
-               (cl_uint)loc_layout_index,                                                           // Layout index.
+               loc_layout_index,                                                                    // Layout index.
                sizeof(cl_mem),                                                                      // Data size.
                &loc_data->buffer                                                                    // Data value.
               );
 
+  baseline->check_error (loc_error);                                                                // Checking returned error code...
+
   baseline->done ();                                                                                // Printing message...
+
+  baseline->trace_end ("setarg", loc_span);                                                         // Appending trace span...
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -287,22 +358,22 @@ void kernel::setarg
  cl_uint loc_layout_index                                                                           // Layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Error code.
+  cl_int   loc_error;                                                                               // Error code.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
 
   baseline->action ("setting kernel argument...");                                                  // Printing message...
 
+  check (loc_layout_index, "long", 3);                                                              // Checking argument metadata...
+
   loc_data->layout = loc_layout_index;                                                              // Setting layout index.
 
   if(!loc_data->ready)
   {
     // Creating OpenCL memory buffer:
-    loc_data->buffer = clCreateBuffer
+    loc_data->buffer = baseline->create_buffer
                        (
-                        baseline->context_id,                                                       // OpenCL context.
-                        CL_MEM_READ_WRITE |                                                         // Memory flag.
-                        CL_MEM_COPY_HOST_PTR,                                                       // Memory flag.
                         sizeof(int3_structure)*loc_data->size,                                      // Data buffer size.
                         loc_data->data,                                                             // Data buffer.
                         &loc_error                                                                  // Error code.
@@ -313,15 +384,26 @@ void kernel::setarg
     loc_data->ready = true;                                                                         // Setting "ready" flag...
   }
 
-  loc_error = clSetKernelArg
+  // Storing argument size (for profiling):
+  if(argument_bytes.size () <= loc_layout_index)
+  {
+    argument_bytes.resize (loc_layout_index + 1, 0);                                                // Resizing argument size array...
+  }
+
+  argument_bytes[loc_layout_index] = sizeof(int3_structure)*loc_data->size;                         // Setting argument size...
+
+  loc_error = bind
               (
-               kernel_id,                                                                           // Kernel id.
-               (cl_uint)loc_layout_index,                                                           // Layout index.
+               loc_layout_index,                                                                    // Layout index.
                sizeof(cl_mem),                                                                      // Data size.
                &loc_data->buffer                                                                    // Data value.
               );
 
+  baseline->check_error (loc_error);                                                                // Checking returned error code...
+
   baseline->done ();                                                                                // Printing message...
+
+  baseline->trace_end ("setarg", loc_span);                                                         // Appending trace span...
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -333,22 +415,22 @@ void kernel::setarg
  cl_uint loc_layout_index                                                                           // Layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Error code.
+  cl_int   loc_error;                                                                               // Error code.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
 
   baseline->action ("setting kernel argument...");                                                  // Printing message...
 
+  check (loc_layout_index, "long", 4);                                                              // Checking argument metadata...
+
   loc_data->layout = loc_layout_index;                                                              // Setting layout index.
 
   if(!loc_data->ready)
   {
     // Creating OpenCL memory buffer:
-    loc_data->buffer = clCreateBuffer
+    loc_data->buffer = baseline->create_buffer
                        (
-                        baseline->context_id,                                                       // OpenCL context.
-                        CL_MEM_READ_WRITE |                                                         // Memory flag.
-                        CL_MEM_COPY_HOST_PTR,                                                       // Memory flag.
                         sizeof(int4_structure)*loc_data->size,                                      // Data buffer size.
                         loc_data->data,                                                             // Data buffer.
                         &loc_error                                                                  // Error code.
@@ -359,15 +441,26 @@ void kernel::setarg
     loc_data->ready = true;                                                                         // Setting "ready" flag...
   }
 
-  loc_error = clSetKernelArg
+  // Storing argument size (for profiling):
+  if(argument_bytes.size () <= loc_layout_index)
+  {
+    argument_bytes.resize (loc_layout_index + 1, 0);                                                // Resizing argument size array...
+  }
+
+  argument_bytes[loc_layout_index] = sizeof(int4_structure)*loc_data->size;                         // Setting argument size...
+
+  loc_error = bind
               (
-               kernel_id,                                                                           // Kernel id.
-               (cl_uint)loc_layout_index,                                                           // Layout index.
+               loc_layout_index,                                                                    // Layout index.
                sizeof(cl_mem),                                                                      // Data size.
                &loc_data->buffer                                                                    // Data value.
               );
 
+  baseline->check_error (loc_error);                                                                // Checking returned error code...
+
   baseline->done ();                                                                                // Printing message...
+
+  baseline->trace_end ("setarg", loc_span);                                                         // Appending trace span...
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -379,22 +472,22 @@ void kernel::setarg
  cl_uint loc_layout_index                                                                           // Layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Error code.
+  cl_int   loc_error;                                                                               // Error code.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
 
   baseline->action ("setting kernel argument...");                                                  // Printing message...
 
+  check (loc_layout_index, "float", 1);                                                             // Checking argument metadata...
+
   loc_data->layout = loc_layout_index;                                                              // Setting layout index.
 
   if(!loc_data->ready)
   {
     // Creating OpenCL memory buffer:
-    loc_data->buffer = clCreateBuffer
+    loc_data->buffer = baseline->create_buffer
                        (
-                        baseline->context_id,                                                       // OpenCL context.
-                        CL_MEM_READ_WRITE |                                                         // Memory flag.
-                        CL_MEM_COPY_HOST_PTR,                                                       // Memory flag.
                         sizeof(cl_float)*loc_data->size,                                            // Data buffer size.
                         loc_data->data,                                                             // Data buffer.
                         &loc_error                                                                  // Error code.
@@ -405,15 +498,26 @@ void kernel::setarg
     loc_data->ready = true;                                                                         // Setting "ready" flag...
   }
 
-  loc_error = clSetKernelArg
+  // Storing argument size (for profiling):
+  if(argument_bytes.size () <= loc_layout_index)
+  {
+    argument_bytes.resize (loc_layout_index + 1, 0);                                                // Resizing argument size array...
+  }
+
+  argument_bytes[loc_layout_index] = sizeof(cl_float)*loc_data->size;                               // Setting argument size...
+
+  loc_error = bind
               (
-               kernel_id,                                                                           // Kernel id.
-               (cl_uint)loc_layout_index,                                                           // Layout index.
+               loc_layout_index,                                                                    // Layout index.
                sizeof(cl_mem),                                                                      // Data size.
                &loc_data->buffer                                                                    // Data value.
               );
 
+  baseline->check_error (loc_error);                                                                // Checking returned error code...
+
   baseline->done ();                                                                                // Printing message...
+
+  baseline->trace_end ("setarg", loc_span);                                                         // Appending trace span...
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -425,77 +529,83 @@ void kernel::setarg
  GLuint   loc_layout_index                                                                          // Layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Error code.
+  cl_int   loc_error;                                                                               // Error code.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
 
   baseline->action ("setting kernel argument...");                                                  // Printing message...
 
+  check (loc_layout_index, "float", 1);                                                             // Checking argument metadata...
+
   loc_data->layout = loc_layout_index;                                                              // Setting layout index.
 
   if(!loc_data->ready)
   {
-    // Generating VAO...
-    glGenVertexArrays
-    (
-     1,                                                                                             // Number of VAOs to generate.
-     &loc_data->vao                                                                                 // VAOs array.
-    );
-
-    // Binding node VAO...
-    glBindVertexArray
-    (
-     loc_data->vao                                                                                  // VAOs array.
-    );
-
-    // Generating VBO:
-    glGenBuffers
-    (
-     1,                                                                                             // Number of VBOs to generate.
-     &loc_data->vbo                                                                                 // VBOs array.
-    );
-
-    // Binding VBO:
-    glBindBuffer
-    (
-     GL_ARRAY_BUFFER,                                                                               // VBO target.
-     loc_data->vbo                                                                                  // VBO to bind.
-    );
-
-    // Creating and initializing a buffer object's data store:
-    glBufferData
-    (
-     GL_ARRAY_BUFFER,                                                                               // VBO target.
-     sizeof(GLfloat)*loc_data->size,                                                                // VBO size.
-     loc_data->data,                                                                                // VBO data.
-     GL_DYNAMIC_DRAW                                                                                // VBO usage.
-    );
-
-    // Specifying the format for attribute in vertex shader:
-    glVertexAttribPointer
-    (
-     loc_layout_index,                                                                              // VAO index.
-     1,                                                                                             // VAO's number of components.
-     GL_FLOAT,                                                                                      // Data type.
-     GL_FALSE,                                                                                      // Not using normalized numbers.
-     0,                                                                                             // Data stride.
-     0                                                                                              // Data offset.
-    );
-
-    // Enabling attribute in vertex shader:
-    glEnableVertexAttribArray
-    (
-     loc_layout_index                                                                               // VAO index.
-    );
-
-    // Binding VBO:
-    glBindBuffer
-    (
-     GL_ARRAY_BUFFER,                                                                               // VBO target.
-     loc_data->vbo                                                                                  // VBO to bind.
-    );
+    if(!baseline->headless)                                                                         // Checking for OpenGL context (headless: plain OpenCL buffer)...
+    {
+      // Generating VAO...
+      glGenVertexArrays
+      (
+       1,                                                                                           // Number of VAOs to generate.
+       &loc_data->vao                                                                               // VAOs array.
+      );
+
+      // Binding node VAO...
+      glBindVertexArray
+      (
+       loc_data->vao                                                                                // VAOs array.
+      );
+
+      // Generating VBO:
+      glGenBuffers
+      (
+       1,                                                                                           // Number of VBOs to generate.
+       &loc_data->vbo                                                                               // VBOs array.
+      );
+
+      // Binding VBO:
+      glBindBuffer
+      (
+       GL_ARRAY_BUFFER,                                                                             // VBO target.
+       loc_data->vbo                                                                                // VBO to bind.
+      );
+
+      // Creating and initializing a buffer object's data store:
+      glBufferData
+      (
+       GL_ARRAY_BUFFER,                                                                             // VBO target.
+       sizeof(GLfloat)*loc_data->size,                                                              // VBO size.
+       loc_data->data,                                                                              // VBO data.
+       GL_DYNAMIC_DRAW                                                                              // VBO usage.
+      );
+
+      // Specifying the format for attribute in vertex shader:
+      glVertexAttribPointer
+      (
+       loc_layout_index,                                                                            // VAO index.
+       1,                                                                                           // VAO's number of components.
+       GL_FLOAT,                                                                                    // Data type.
+       GL_FALSE,                                                                                    // Not using normalized numbers.
+       0,                                                                                           // Data stride.
+       0                                                                                            // Data offset.
+      );
+
+      // Enabling attribute in vertex shader:
+      glEnableVertexAttribArray
+      (
+       loc_layout_index                                                                             // VAO index.
+      );
+
+      // Binding VBO:
+      glBindBuffer
+      (
+       GL_ARRAY_BUFFER,                                                                             // VBO target.
+       loc_data->vbo                                                                                // VBO to bind.
+      );
+    }
 
-    glFinish ();                                                                                    // Waiting for OpenGL to finish...
+    baseline->gl_finish ();                                                                         // Waiting for OpenGL to finish...
 
     if(baseline->interop)                                                                           // Checking for interoperability...
     {
@@ -512,11 +622,8 @@ void kernel::setarg
     else
     {
       // Creating OpenCL memory buffer:
-      loc_data->buffer = clCreateBuffer
+      loc_data->buffer = baseline->create_buffer
                          (
-                          baseline->context_id,                                                     // OpenCL context.
-                          CL_MEM_READ_WRITE |                                                       // Memory flag.
-                          CL_MEM_COPY_HOST_PTR,                                                     // Memory flag.
                           sizeof(GLfloat)*loc_data->size,                                           // Data buffer size.
                           loc_data->data,                                                           // Data buffer.
                           &loc_error                                                                // Error code.
@@ -527,9 +634,16 @@ void kernel::setarg
     loc_data->ready = true;                                                                         // Setting "ready" flag...
   }
 
-  loc_error = clSetKernelArg
+  // Storing argument size (for profiling):
+  if(argument_bytes.size () <= loc_layout_index)
+  {
+    argument_bytes.resize (loc_layout_index + 1, 0);                                                // Resizing argument size array...
+  }
+
+  argument_bytes[loc_layout_index] = sizeof(GLfloat)*loc_data->size;                                // Setting argument size...
+
+  loc_error = bind
               (
-               kernel_id,                                                                           // Kernel id.
                loc_layout_index,                                                                    // Layout index.
                sizeof(cl_mem),                                                                      // Data size.
                &loc_data->buffer                                                                    // Data value.
@@ -537,6 +651,8 @@ void kernel::setarg
 
   baseline->check_error (loc_error);                                                                // Checking returned error code...
   baseline->done ();                                                                                // Printing message...
+
+  baseline->trace_end ("setarg", loc_span);                                                         // Appending trace span...
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -548,22 +664,22 @@ void kernel::setarg
  cl_uint loc_layout_index                                                                           // Layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Error code.
+  cl_int   loc_error;                                                                               // Error code.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
 
   baseline->action ("setting kernel argument...");                                                  // Printing message...
 
+  check (loc_layout_index, "float", 2);                                                             // Checking argument metadata...
+
   loc_data->layout = loc_layout_index;                                                              // Setting layout index.
 
   if(!loc_data->ready)
   {
     // Creating OpenCL memory buffer:
-    loc_data->buffer = clCreateBuffer
+    loc_data->buffer = baseline->create_buffer
                        (
-                        baseline->context_id,                                                       // OpenCL context.
-                        CL_MEM_READ_WRITE |                                                         // Memory flag.
-                        CL_MEM_COPY_HOST_PTR,                                                       // Memory flag.
                         sizeof(float2_structure)*loc_data->size,                                    // Data buffer size.
                         loc_data->data,                                                             // Data buffer.
                         &loc_error                                                                  // Error code.
@@ -574,15 +690,26 @@ void kernel::setarg
     loc_data->ready = true;                                                                         // Setting "ready" flag...
   }
 
-  loc_error = clSetKernelArg
+  // Storing argument size (for profiling):
+  if(argument_bytes.size () <= loc_layout_index)
+  {
+    argument_bytes.resize (loc_layout_index + 1, 0);                                                // Resizing argument size array...
+  }
+
+  argument_bytes[loc_layout_index] = sizeof(float2_structure)*loc_data->size;                       // Setting argument size...
+
+  loc_error = bind
               (
-               kernel_id,                                                                           // Kernel id.
-               (cl_uint)loc_layout_index,                                                           // Layout index.
+               loc_layout_index,                                                                    // Layout index.
                sizeof(cl_mem),                                                                      // Data size.
                &loc_data->buffer                                                                    // Data value.
               );
 
+  baseline->check_error (loc_error);                                                                // Checking returned error code...
+
   baseline->done ();                                                                                // Printing message...
+
+  baseline->trace_end ("setarg", loc_span);                                                         // Appending trace span...
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -594,22 +721,22 @@ void kernel::setarg
  cl_uint loc_layout_index                                                                           // Layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Error code.
+  cl_int   loc_error;                                                                               // Error code.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
 
   baseline->action ("setting kernel argument...");                                                  // Printing message...
 
+  check (loc_layout_index, "float", 3);                                                             // Checking argument metadata...
+
   loc_data->layout = loc_layout_index;                                                              // Setting layout index.
 
   if(!loc_data->ready)
   {
     // Creating OpenCL memory buffer:
-    loc_data->buffer = clCreateBuffer
+    loc_data->buffer = baseline->create_buffer
                        (
-                        baseline->context_id,                                                       // OpenCL context.
-                        CL_MEM_READ_WRITE |                                                         // Memory flag.
-                        CL_MEM_COPY_HOST_PTR,                                                       // Memory flag.
                         sizeof(float3_structure)*loc_data->size,                                    // Data buffer size.
                         loc_data->data,                                                             // Data buffer.
                         &loc_error                                                                  // Error code.
@@ -620,15 +747,26 @@ void kernel::setarg
     loc_data->ready = true;                                                                         // Setting "ready" flag...
   }
 
-  loc_error = clSetKernelArg
+  // Storing argument size (for profiling):
+  if(argument_bytes.size () <= loc_layout_index)
+  {
+    argument_bytes.resize (loc_layout_index + 1, 0);                                                // Resizing argument size array...
+  }
+
+  argument_bytes[loc_layout_index] = sizeof(float3_structure)*loc_data->size;                       // Setting argument size...
+
+  loc_error = bind
               (
-               kernel_id,                                                                           // Kernel id.
-               (cl_uint)loc_layout_index,                                                           // Layout index.
+               loc_layout_index,                                                                    // Layout index.
                sizeof(cl_mem),                                                                      // Data size.
                &loc_data->buffer                                                                    // Data value.
               );
 
+  baseline->check_error (loc_error);                                                                // Checking returned error code...
+
   baseline->done ();                                                                                // Printing message...
+
+  baseline->trace_end ("setarg", loc_span);                                                         // Appending trace span...
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -640,22 +778,22 @@ void kernel::setarg
  cl_uint loc_layout_index                                                                           // Layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Error code.
+  cl_int   loc_error;                                                                               // Error code.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
 
   baseline->action ("setting kernel argument...");                                                  // Printing message...
 
+  check (loc_layout_index, "float", 4);                                                             // Checking argument metadata...
+
   loc_data->layout = loc_layout_index;                                                              // Setting layout index.
 
   if(!loc_data->ready)
   {
     // Creating OpenCL memory buffer:
-    loc_data->buffer = clCreateBuffer
+    loc_data->buffer = baseline->create_buffer
                        (
-                        baseline->context_id,                                                       // OpenCL context.
-                        CL_MEM_READ_WRITE |                                                         // Memory flag.
-                        CL_MEM_COPY_HOST_PTR,                                                       // Memory flag.
                         sizeof(float4_structure)*loc_data->size,                                    // Data buffer size.
                         loc_data->data,                                                             // Data buffer.
                         &loc_error                                                                  // Error code.
@@ -666,15 +804,26 @@ void kernel::setarg
     loc_data->ready = true;                                                                         // Setting "ready" flag...
   }
 
-  loc_error = clSetKernelArg
+  // Storing argument size (for profiling):
+  if(argument_bytes.size () <= loc_layout_index)
+  {
+    argument_bytes.resize (loc_layout_index + 1, 0);                                                // Resizing argument size array...
+  }
+
+  argument_bytes[loc_layout_index] = sizeof(float4_structure)*loc_data->size;                       // Setting argument size...
+
+  loc_error = bind
               (
-               kernel_id,                                                                           // Kernel id.
-               (cl_uint)loc_layout_index,                                                           // Layout index.
+               loc_layout_index,                                                                    // Layout index.
                sizeof(cl_mem),                                                                      // Data size.
                &loc_data->buffer                                                                    // Data value.
               );
 
+  baseline->check_error (loc_error);                                                                // Checking returned error code...
+
   baseline->done ();                                                                                // Printing message...
+
+  baseline->trace_end ("setarg", loc_span);                                                         // Appending trace span...
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -686,77 +835,83 @@ void kernel::setarg
  GLuint   loc_layout_index                                                                          // Layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Error code.
+  cl_int   loc_error;                                                                               // Error code.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
 
   baseline->action ("setting kernel argument...");                                                  // Printing message...
 
+  check (loc_layout_index, "float", 4);                                                             // Checking argument metadata...
+
   loc_data->layout = loc_layout_index;                                                              // Setting layout index.
 
   if(!loc_data->ready)
   {
-    // Generating VAO...
-    glGenVertexArrays
-    (
-     1,                                                                                             // Number of VAOs to generate.
-     &loc_data->vao                                                                                 // VAOs array.
-    );
-
-    // Binding node VAO...
-    glBindVertexArray
-    (
-     loc_data->vao                                                                                  // VAOs array.
-    );
-
-    // Generating VBO:
-    glGenBuffers
-    (
-     1,                                                                                             // Number of VBOs to generate.
-     &loc_data->vbo                                                                                 // VBOs array.
-    );
-
-    // Binding VBO:
-    glBindBuffer
-    (
-     GL_ARRAY_BUFFER,                                                                               // VBO target.
-     loc_data->vbo                                                                                  // VBO to bind.
-    );
-
-    // Creating and initializing a buffer object's data store:
-    glBufferData
-    (
-     GL_ARRAY_BUFFER,                                                                               // VBO target.
-     sizeof(float4G_structure)*loc_data->size,                                                      // VBO size.
-     loc_data->data,                                                                                // VBO data.
-     GL_DYNAMIC_DRAW                                                                                // VBO usage.
-    );
-
-    // Specifying the format for attribute in vertex shader:
-    glVertexAttribPointer
-    (
-     loc_layout_index,                                                                              // VAO index.
-     4,                                                                                             // VAO's number of components.
-     GL_FLOAT,                                                                                      // Data type.
-     GL_FALSE,                                                                                      // Not using normalized numbers.
-     0,                                                                                             // Data stride.
-     0                                                                                              // Data offset.
-    );
-
-    // Enabling attribute in vertex shader:
-    glEnableVertexAttribArray
-    (
-     loc_layout_index                                                                               // VAO index.
-    );
-
-    // Binding VBO:
-    glBindBuffer
-    (
-     GL_ARRAY_BUFFER,                                                                               // VBO target.
-     loc_data->vbo                                                                                  // VBO to bind.
-    );
+    if(!baseline->headless)                                                                         // Checking for OpenGL context (headless: plain OpenCL buffer)...
+    {
+      // Generating VAO...
+      glGenVertexArrays
+      (
+       1,                                                                                           // Number of VAOs to generate.
+       &loc_data->vao                                                                               // VAOs array.
+      );
+
+      // Binding node VAO...
+      glBindVertexArray
+      (
+       loc_data->vao                                                                                // VAOs array.
+      );
+
+      // Generating VBO:
+      glGenBuffers
+      (
+       1,                                                                                           // Number of VBOs to generate.
+       &loc_data->vbo                                                                               // VBOs array.
+      );
+
+      // Binding VBO:
+      glBindBuffer
+      (
+       GL_ARRAY_BUFFER,                                                                             // VBO target.
+       loc_data->vbo                                                                                // VBO to bind.
+      );
+
+      // Creating and initializing a buffer object's data store:
+      glBufferData
+      (
+       GL_ARRAY_BUFFER,                                                                             // VBO target.
+       sizeof(float4G_structure)*loc_data->size,                                                    // VBO size.
+       loc_data->data,                                                                              // VBO data.
+       GL_DYNAMIC_DRAW                                                                              // VBO usage.
+      );
+
+      // Specifying the format for attribute in vertex shader:
+      glVertexAttribPointer
+      (
+       loc_layout_index,                                                                            // VAO index.
+       4,                                                                                           // VAO's number of components.
+       GL_FLOAT,                                                                                    // Data type.
+       GL_FALSE,                                                                                    // Not using normalized numbers.
+       0,                                                                                           // Data stride.
+       0                                                                                            // Data offset.
+      );
+
+      // Enabling attribute in vertex shader:
+      glEnableVertexAttribArray
+      (
+       loc_layout_index                                                                             // VAO index.
+      );
+
+      // Binding VBO:
+      glBindBuffer
+      (
+       GL_ARRAY_BUFFER,                                                                             // VBO target.
+       loc_data->vbo                                                                                // VBO to bind.
+      );
+    }
 
-    glFinish ();                                                                                    // Waiting for OpenGL to finish...
+    baseline->gl_finish ();                                                                         // Waiting for OpenGL to finish...
 
     if(baseline->interop)                                                                           // Checking for interoperability...
     {
@@ -773,11 +928,8 @@ void kernel::setarg
     else
     {
       // Creating OpenCL memory buffer:
-      loc_data->buffer = clCreateBuffer
+      loc_data->buffer = baseline->create_buffer
                          (
-                          baseline->context_id,                                                     // OpenCL context.
-                          CL_MEM_READ_WRITE |                                                       // Memory flag.
-                          CL_MEM_COPY_HOST_PTR,                                                     // Memory flag.
                           sizeof(float4G_structure)*loc_data->size,                                 // Data buffer size.
                           loc_data->data,                                                           // Data buffer.
                           &loc_error                                                                // Error code.
@@ -787,9 +939,16 @@ void kernel::setarg
     baseline->check_error (loc_error);                                                              // Checking returned error code...
     loc_data->ready = true;                                                                         // Setting "ready" flag...
   }
-  loc_error = clSetKernelArg
+  // Storing argument size (for profiling):
+  if(argument_bytes.size () <= loc_layout_index)
+  {
+    argument_bytes.resize (loc_layout_index + 1, 0);                                                // Resizing argument size array...
+  }
+
+  argument_bytes[loc_layout_index] = sizeof(float4G_structure)*loc_data->size;                      // Setting argument size...
+
+  loc_error = bind
               (
-               kernel_id,                                                                           // Kernel id.
                loc_layout_index,                                                                    // Layout index.
                sizeof(cl_mem),                                                                      // Data size.
                &loc_data->buffer                                                                    // Data value.
@@ -798,26 +957,1284 @@ void kernel::setarg
   baseline->check_error (loc_error);                                                                // Checking returned error code...
 
   baseline->done ();                                                                                // Printing message...
+
+  baseline->trace_end ("setarg", loc_span);                                                         // Appending trace span...
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
-////////////////////////////////////////////// DESTRUCTOR ////////////////////////////////////////////
+///////////////////////////////////// setarg "by value" overload /////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////////////////////////////
-kernel::~kernel()
+void kernel::setarg
+(
+ const void* loc_value,                                                                             // Argument value.
+ size_t      loc_size,                                                                              // Argument size [bytes].
+ cl_uint     loc_layout_index                                                                       // Layout index.
+)
 {
-  cl_int loc_error;                                                                                 // Error code.
+  cl_int   loc_error;                                                                               // Error code.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  check_value (loc_layout_index, loc_size);                                                         // Checking argument metadata...
 
-  baseline->action ("releasing OpenCL kernel...");                                                  // Printing message...
-  loc_error = clReleaseKernel (kernel_id);                                                          // Releasing OpenCL kernel...
-  baseline->check_error (loc_error);                                                                // Checking error code...
-  baseline->done ();                                                                                // Printing message...
+  // Storing argument size (for profiling, no data transfer):
+  if(argument_bytes.size () <= loc_layout_index)
+  {
+    argument_bytes.resize (loc_layout_index + 1, 0);                                                // Resizing argument size array...
+  }
 
-  baseline->action ("releasing OpenCL kernel event...");                                            // Printing message...
-  loc_error = clReleaseEvent (event);                                                               // Releasing OpenCL event...
-  baseline->check_error (loc_error);                                                                // Checking error code...
-  baseline->done ();                                                                                // Printing message...
+  argument_bytes[loc_layout_index] = 0;                                                             // Setting argument size...
+
+  loc_error = bind
+              (
+               loc_layout_index,                                                                    // Layout index.
+               loc_size,                                                                            // Data size.
+               loc_value                                                                            // Data value.
+              );
+
+  baseline->check_error (loc_error);                                                                // Checking returned error code...
+
+  baseline->trace_end ("setarg", loc_span);                                                         // Appending trace span...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////// setarg "cl_int" overload //////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void kernel::setarg
+(
+ cl_int    loc_value,                                                                               // Argument value.
+ cl_uint   loc_layout_index                                                                         // Layout index.
+)
+{
+  setarg (&loc_value, sizeof(cl_int), loc_layout_index);                                            // Setting argument by value...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////// setarg "cl_uint" overload //////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void kernel::setarg
+(
+ cl_uint   loc_value,                                                                               // Argument value.
+ cl_uint   loc_layout_index                                                                         // Layout index.
+)
+{
+  setarg (&loc_value, sizeof(cl_uint), loc_layout_index);                                           // Setting argument by value...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////// setarg "cl_long" overload //////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void kernel::setarg
+(
+ cl_long   loc_value,                                                                               // Argument value.
+ cl_uint   loc_layout_index                                                                         // Layout index.
+)
+{
+  setarg (&loc_value, sizeof(cl_long), loc_layout_index);                                           // Setting argument by value...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////// setarg "cl_ulong" overload /////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void kernel::setarg
+(
+ cl_ulong  loc_value,                                                                               // Argument value.
+ cl_uint   loc_layout_index                                                                         // Layout index.
+)
+{
+  setarg (&loc_value, sizeof(cl_ulong), loc_layout_index);                                          // Setting argument by value...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////// setarg "cl_float" overload /////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void kernel::setarg
+(
+ cl_float  loc_value,                                                                               // Argument value.
+ cl_uint   loc_layout_index                                                                         // Layout index.
+)
+{
+  setarg (&loc_value, sizeof(cl_float), loc_layout_index);                                          // Setting argument by value...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////// setarg "cl_double" overload /////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void kernel::setarg
+(
+ cl_double loc_value,                                                                               // Argument value.
+ cl_uint   loc_layout_index                                                                         // Layout index.
+)
+{
+  setarg (&loc_value, sizeof(cl_double), loc_layout_index);                                         // Setting argument by value...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////// setarg "cl_int2" overload //////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void kernel::setarg
+(
+ cl_int2   loc_value,                                                                               // Argument value.
+ cl_uint   loc_layout_index                                                                         // Layout index.
+)
+{
+  setarg (&loc_value, sizeof(cl_int2), loc_layout_index);                                           // Setting argument by value...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////// setarg "cl_int4" overload //////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void kernel::setarg
+(
+ cl_int4   loc_value,                                                                               // Argument value.
+ cl_uint   loc_layout_index                                                                         // Layout index.
+)
+{
+  setarg (&loc_value, sizeof(cl_int4), loc_layout_index);                                           // Setting argument by value...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////// setarg "cl_float2" overload /////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void kernel::setarg
+(
+ cl_float2 loc_value,                                                                               // Argument value.
+ cl_uint   loc_layout_index                                                                         // Layout index.
+)
+{
+  setarg (&loc_value, sizeof(cl_float2), loc_layout_index);                                         // Setting argument by value...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////// setarg "cl_float4" overload /////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void kernel::setarg
+(
+ cl_float4 loc_value,                                                                               // Argument value.
+ cl_uint   loc_layout_index                                                                         // Layout index.
+)
+{
+  setarg (&loc_value, sizeof(cl_float4), loc_layout_index);                                         // Setting argument by value...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////// setlocal //////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void kernel::setlocal
+(
+ size_t  loc_size,                                                                                  // Local memory size [bytes].
+ cl_uint loc_layout_index                                                                           // Layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Error code.
+
+  baseline->action ("setting kernel local memory argument...");                                     // Printing message...
+
+  // Storing argument size (for profiling, no data transfer):
+  if(argument_bytes.size () <= loc_layout_index)
+  {
+    argument_bytes.resize (loc_layout_index + 1, 0);                                                // Resizing argument size array...
+  }
+
+  argument_bytes[loc_layout_index] = 0;                                                             // Setting argument size...
+
+  loc_error = bind
+              (
+               loc_layout_index,                                                                    // Layout index.
+               loc_size,                                                                            // Local memory size.
+               NULL                                                                                 // No value: local memory allocation.
+              );
+
+  baseline->check_error (loc_error);                                                                // Checking returned error code...
+
+  baseline->done ();                                                                                // Printing message...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////// get_size //////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+cl_uint kernel::get_size
+(
+ size_t* loc_global,                                                                                // Global size array (3 elements).
+ size_t* loc_local                                                                                  // Local size array (3 elements, NULL = driver choice).
+)
+{
+  cl_uint kernel_dimension = 0;                                                                     // Kernel dimension.
+  cl_uint i;                                                                                        // Index.
+
+  // Selecting kernel size:
+  if(
+     (size_i > 0) &&
+     (size_j == 0) &&
+     (size_k == 0)
+    )
+  {
+    kernel_dimension = 1;
+  }
+
+  if(
+     (size_i > 0) &&
+     (size_j > 0) &&
+     (size_k == 0)
+    )
+  {
+    kernel_dimension = 2;
+  }
+
+  if(
+     (size_i > 0) &&
+     (size_j > 0) &&
+     (size_k > 0)
+    )
+  {
+    kernel_dimension = 3;
+  }
+
+  if(kernel_dimension == 0)
+  {
+    baseline->error ("invalid kernel size!");
+    exit (EXIT_FAILURE);
+  }
+
+  loc_global[0] = size_i;                                                                           // Setting global size (i-index)...
+  loc_global[1] = size_j;                                                                           // Setting global size (j-index)...
+  loc_global[2] = size_k;                                                                           // Setting global size (k-index)...
+
+  if(local_i == 0)                                                                                  // Checking for explicit local size...
+  {
+    return kernel_dimension;                                                                        // Leaving local size to the driver...
+  }
+
+  loc_local[0]  = local_i;                                                                          // Setting local size (i-index)...
+  loc_local[1]  = std::max (local_j, (size_t)1);                                                    // Setting local size (j-index)...
+  loc_local[2]  = std::max (local_k, (size_t)1);                                                    // Setting local size (k-index)...
+
+  for(i = 0; i < kernel_dimension; i++)                                                             // Padding global size to a multiple of the local size...
+  {
+    loc_global[i] = ((loc_global[i] + loc_local[i] - 1)/loc_local[i])*loc_local[i];
+  }
+
+  return kernel_dimension;                                                                          // Returning kernel dimension...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////// bind ////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+cl_int kernel::bind
+(
+ cl_uint     loc_layout_index,                                                                      // Layout index.
+ size_t      loc_size,                                                                              // Argument size [bytes].
+ const void* loc_value                                                                              // Argument value (NULL = local memory).
+)
+{
+  if(argument_size.size () <= loc_layout_index)                                                     // Checking argument record size...
+  {
+    argument_size.resize (loc_layout_index + 1, 0);                                                 // Resizing argument size record...
+    argument_value.resize (loc_layout_index + 1);                                                   // Resizing argument value record...
+  }
+
+  argument_size[loc_layout_index] = loc_size;                                                       // Recording argument size...
+
+  if(loc_value != NULL)                                                                             // Checking for argument value...
+  {
+    argument_value[loc_layout_index].assign ((const char*)loc_value, (const char*)loc_value + loc_size); // Recording argument value...
+  }
+
+  else
+  {
+    argument_value[loc_layout_index].clear ();                                                      // Recording local memory argument...
+  }
+
+  // Setting kernel argument:
+  return clSetKernelArg
+         (
+          kernel_id,                                                                                // Kernel id.
+          loc_layout_index,                                                                         // Layout index.
+          loc_size,                                                                                 // Data size.
+          loc_value                                                                                 // Data value.
+         );
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////// watch ////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void kernel::watch ()
+{
+  if(watcher.joinable () || kernel_file_name.empty ())                                              // Checking for watcher or sources...
+  {
+    return;
+  }
+
+  baseline->action ("watching OpenCL kernel sources...");                                           // Printing message...
+  watch_stop = false;                                                                               // Resetting source watcher "stop" flag...
+  watcher    = std::thread (&kernel::watch_loop, this);                                             // Starting source watcher thread...
+  baseline->done ();                                                                                // Printing message...
+}
+
+void kernel::watch_loop ()
+{
+  std::vector<std::string>     loc_source = kernel_source;                                          // Last built sources.
+  std::vector<std::string>     loc_new_source;                                                      // Current sources.
+  std::ifstream                loc_file;                                                            // Source file.
+  std::string                  loc_log;                                                             // OpenCL JIT compiler log.
+  cl_int                       loc_error;                                                           // Error code.
+  cl_program                   loc_program;                                                         // Rebuilt program.
+  cl_kernel                    loc_kernel;                                                          // Rebuilt kernel.
+  bool                         loc_changed;                                                         // Source "changed" flag.
+  size_t                       i;                                                                   // Index.
+
+  std::unique_lock<std::mutex> loc_lock (watch_lock);                                               // Source watcher lock.
+
+  while(!watch_stop)
+  {
+    watch_wakeup.wait_for (loc_lock, std::chrono::milliseconds (NU_WATCH_PERIOD));                  // Waiting for next check...
+
+    if(watch_stop)                                                                                  // Checking "stop" flag...
+    {
+      break;
+    }
+
+    loc_new_source.clear ();                                                                        // Resetting current sources...
+    loc_changed = false;                                                                            // Resetting "changed" flag...
+
+    for(i = 0; i < kernel_file_name.size (); i++)                                                   // Reading current sources...
+    {
+      loc_file.open (kernel_file_name[i], std::ios::in | std::ios::binary);                         // Opening source file...
+
+      if(!loc_file)                                                                                 // Checking file (e.g. while being saved)...
+      {
+        break;
+      }
+
+      loc_new_source.push_back (std::string (std::istreambuf_iterator<char>(loc_file), std::istreambuf_iterator<char>())); // Reading source...
+      loc_file.close ();                                                                            // Closing source file...
+      loc_changed = loc_changed || (loc_new_source[i] != loc_source[i]);                            // Comparing source...
+    }
+
+    loc_file.clear ();                                                                              // Resetting file state...
+
+    if((loc_new_source.size () != kernel_file_name.size ()) || !loc_changed)                        // Checking for complete changed sources...
+    {
+      continue;
+    }
+
+    loc_source = loc_new_source;                                                                    // Updating last built sources (not retrying on build errors)...
+    loc_lock.unlock ();                                                                             // Releasing lock during build...
+
+    loc_program = NULL;                                                                             // Resetting rebuilt program...
+
+    if(constant.empty ())                                                                           // Checking for specialization constants (same selection as the initializer)...
+    {
+      loc_program = baseline->load_il (kernel_file_name, compiler_options);                         // Loading up to date SPIR-V module, if any...
+    }
+
+    if(loc_program == NULL)                                                                         // Checking for SPIR-V module...
+    {
+      // Building OpenCL program:
+      loc_program = baseline->build_program
+                    (
+                     baseline->context_id,                                                          // OpenCL context ID.
+                     baseline->device_list,                                                         // Device ID list.
+                     kernel_home,                                                                   // Kernel home directory.
+                     loc_source,                                                                    // Kernel sources.
+                     build_options,                                                                 // Compiler options.
+                     loc_log                                                                        // Compiler log.
+                    );
+    }
+
+    if(loc_program == NULL)                                                                         // Checking compiled program...
+    {
+      baseline->error ("kernel reload failed, keeping old kernel!");                                // Printing message...
+    }
+
+    else
+    {
+      // Creating OpenCL kernel:
+      loc_kernel = clCreateKernel
+                   (
+                    loc_program,                                                                    // OpenCL kernel program.
+                    kernel_name.c_str (),                                                           // Kernel name.
+                    &loc_error                                                                      // Error code.
+                   );
+
+      if(loc_error != CL_SUCCESS)                                                                   // Checking kernel...
+      {
+        baseline->error ("kernel reload failed, keeping old kernel: entry point not found!");       // Printing message...
+        clReleaseProgram (loc_program);                                                             // Releasing rebuilt program...
+      }
+
+      else
+      {
+        loc_lock.lock ();                                                                           // Acquiring lock...
+
+        if(reload_kernel != NULL)                                                                   // Checking for a previous kernel not swapped in yet...
+        {
+          clReleaseKernel (reload_kernel);                                                          // Releasing previous rebuilt kernel...
+          clReleaseProgram (reload_program);                                                        // Releasing previous rebuilt program...
+        }
+
+        reload_program = loc_program;                                                               // Handing rebuilt program...
+        reload_kernel  = loc_kernel;                                                                // Handing rebuilt kernel...
+        reload_source  = loc_source;                                                                // Handing rebuilt sources...
+        reload_ready   = true;                                                                      // Setting rebuilt kernel "ready" flag...
+        continue;
+      }
+    }
+
+    loc_lock.lock ();                                                                               // Acquiring lock...
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////// reload ///////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+bool kernel::reload ()
+{
+  cl_int                          loc_error = CL_SUCCESS;                                           // Error code.
+  cl_program                      loc_program;                                                      // Rebuilt program.
+  cl_kernel                       loc_kernel;                                                       // Rebuilt kernel.
+  std::vector<std::string>        loc_source;                                                       // Rebuilt sources.
+  std::vector<argument_structure> loc_argument;                                                     // Previous argument metadata.
+  cl_uint                         i;                                                                // Index.
+
+  if(!reload_ready)                                                                                 // Checking for rebuilt kernel (fast path)...
+  {
+    return false;
+  }
+
+  {
+    std::lock_guard<std::mutex> loc_lock (watch_lock);                                              // Source watcher lock.
+
+    loc_program    = reload_program;                                                                // Taking rebuilt program...
+    loc_kernel     = reload_kernel;                                                                 // Taking rebuilt kernel...
+    reload_program = NULL;                                                                          // Resetting rebuilt program...
+    reload_kernel  = NULL;                                                                          // Resetting rebuilt kernel...
+    loc_source     = reload_source;                                                                 // Taking rebuilt sources...
+    reload_ready   = false;                                                                         // Resetting rebuilt kernel "ready" flag...
+  }
+
+  for(i = 0; (i < argument_size.size ()) && (loc_error == CL_SUCCESS); i++)                         // Rebinding current arguments...
+  {
+    if(argument_size[i] > 0)                                                                        // Checking for argument...
+    {
+      // Setting kernel argument:
+      loc_error = clSetKernelArg
+                  (
+                   loc_kernel,                                                                      // Kernel id.
+                   i,                                                                               // Layout index.
+                   argument_size[i],                                                                // Data size.
+                   argument_value[i].empty () ? NULL : argument_value[i].data ()                    // Data value.
+                  );
+    }
+  }
+
+  if(loc_error != CL_SUCCESS)                                                                       // Checking rebound arguments...
+  {
+    baseline->error ("kernel reload failed, keeping old kernel: arguments do not match!");          // Printing message...
+    clReleaseKernel (loc_kernel);                                                                   // Releasing rebuilt kernel...
+    clReleaseProgram (loc_program);                                                                 // Releasing rebuilt program...
+    return false;
+  }
+
+  for(i = 0; i < baseline->k_num; i++)                                                              // Scanning OpenCL kernel argument array...
+  {
+    if(baseline->kernel_id[i] == kernel_id)                                                         // Looking for old OpenCL kernel ID...
+    {
+      baseline->kernel_id[i] = loc_kernel;                                                          // Replacing OpenCL kernel ID...
+      break;
+    }
+  }
+
+  clReleaseKernel (kernel_id);                                                                      // Releasing old kernel...
+  clReleaseProgram (program);                                                                       // Releasing old program...
+  kernel_id = loc_kernel;                                                                           // Swapping in rebuilt kernel...
+  program   = loc_program;                                                                          // Swapping in rebuilt program...
+
+  kernel_source = loc_source;                                                                       // Updating sources (metadata cache key)...
+  loc_argument  = argument;                                                                         // Saving previous argument metadata...
+  introspect (metadata_file ());                                                                    // Getting argument metadata of the rebuilt kernel...
+
+  if(argument.empty () && !loc_argument.empty ())                                                   // Checking for missing metadata (e.g. SPIR-V module)...
+  {
+    baseline->warning ("no argument metadata for reloaded kernel " + kernel_name + ", keeping the previous ones!");
+    argument = loc_argument;                                                                        // Keeping previous argument metadata...
+
+    for(i = 0; i < argument.size (); i++)                                                           // Indexing arguments by name...
+    {
+      argument_index[argument[i].name] = i;
+    }
+  }
+
+  baseline->action ("kernel reloaded...");                                                          // Printing message...
+  baseline->done ();                                                                                // Printing message...
+
+  return true;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// metadata_file ////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+std::string kernel::metadata_file ()
+{
+  std::string loc_key;                                                                              // Argument metadata cache key.
+  size_t      i;                                                                                    // Index.
+
+  if(!baseline->cache)                                                                              // Checking for program cache...
+  {
+    return "";                                                                                      // No metadata cache...
+  }
+
+  for(i = 0; i < kernel_source.size (); i++)                                                        // Scanning kernel sources...
+  {
+    loc_key += kernel_source[i] + '\0';                                                             // Appending kernel source to cache key...
+    loc_key += baseline->headers (kernel_home, kernel_source[i]);                                   // Appending included headers to cache key...
+  }
+
+  loc_key += build_options + '\0' + kernel_name;                                                    // Appending compiler options and entry point name to cache key...
+
+  return baseline->cache_file (kernel_home, loc_key, NU_ARGS_EXTENSION);                            // Returning argument metadata cache file name...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////// replica ///////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void kernel::partition_output
+(
+ cl_uint loc_layout_index,                                                                          // Layout index.
+ size_t  loc_row                                                                                    // Size per index along the last dimension (0 = derived) [bytes].
+)
+{
+  partition[loc_layout_index] = loc_row;                                                            // Declaring output...
+}
+
+std::vector<output_structure> kernel::output ()
+{
+  std::vector<output_structure> loc_output;                                                         // Output buffers.
+  output_structure              loc_buffer;                                                         // Output buffer.
+  bool                          loc_new;                                                            // New buffer flag.
+  size_t                        i;                                                                  // Index.
+  size_t                        j;                                                                  // Index.
+
+  if(partition.empty () && argument.empty () && !argument_size.empty ())                            // Checking for output declarations or argument metadata...
+  {
+    baseline->error ("Kernel argument metadata not available: declare the outputs by kernel::partition_output!");
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  for(i = 0; i < argument_size.size (); i++)                                                        // Scanning kernel arguments...
+  {
+    if(argument_value[i].size () != sizeof(cl_mem))                                                 // Checking for buffer argument...
+    {
+      continue;
+    }
+
+    if(partition.empty ())                                                                          // Checking for output declarations...
+    {
+      if((i >= argument.size ()) ||
+         (argument[i].address != CL_KERNEL_ARG_ADDRESS_GLOBAL) ||
+         (argument[i].qualifier & CL_KERNEL_ARG_TYPE_CONST))                                        // Checking for writable global buffer...
+      {
+        continue;
+      }
+
+      loc_buffer.row = 0;                                                                           // Deriving size per index...
+    }
+
+    else
+    {
+      if(partition.find ((cl_uint)i) == partition.end ())                                           // Checking for declared output...
+      {
+        continue;
+      }
+
+      loc_buffer.row = partition[(cl_uint)i];                                                       // Getting size per index...
+    }
+
+    loc_buffer.buffer = *(cl_mem*)argument_value[i].data ();                                        // Getting data buffer...
+    loc_new           = (loc_buffer.buffer != NULL);                                                // Checking buffer...
+
+    for(j = 0; (j < loc_output.size ()) && loc_new; j++)                                            // Checking for new buffer...
+    {
+      loc_new = (loc_output[j].buffer != loc_buffer.buffer);
+    }
+
+    if(loc_new)
+    {
+      loc_output.push_back (loc_buffer);                                                            // Storing output buffer...
+    }
+  }
+
+  return loc_output;                                                                                // Returning output buffers...
+}
+
+cl_kernel kernel::replica
+(
+ size_t                    loc_device_index,                                                        // Device index in the context device list.
+ std::map<cl_mem, cl_mem>& loc_buffer                                                               // Replica buffer map (original buffer, replica buffer).
+)
+{
+  cl_int                             loc_error;                                                     // Error code.
+  cl_mem                             loc_value;                                                     // Buffer argument value.
+  std::map<cl_mem, cl_mem>::iterator loc_replica;                                                   // Replica buffer.
+  size_t                             i;                                                             // Index.
+
+  if(replica_program != program)                                                                    // Checking for reloaded kernel...
+  {
+    for(i = 0; i < replica_id.size (); i++)                                                         // Scanning kernel copies...
+    {
+      if(replica_id[i] != NULL)
+      {
+        clReleaseKernel (replica_id[i]);                                                            // Releasing stale kernel copy...
+      }
+    }
+
+    replica_id.clear ();                                                                            // Resetting kernel copies...
+    replica_program = program;                                                                      // Setting program of the kernel copies...
+  }
+
+  if(replica_id.size () <= loc_device_index)                                                        // Checking kernel copy array size...
+  {
+    replica_id.resize (loc_device_index + 1, NULL);                                                 // Resizing kernel copy array...
+  }
+
+  if(replica_id[loc_device_index] == NULL)                                                          // Checking for kernel copy...
+  {
+    // Creating OpenCL kernel copy:
+    replica_id[loc_device_index] = clCreateKernel
+                                   (
+                                    program,                                                        // OpenCL kernel program.
+                                    kernel_name.c_str (),                                           // Kernel name.
+                                    &loc_error                                                      // Error code.
+                                   );
+    baseline->check_error (loc_error);                                                              // Checking error...
+  }
+
+  for(i = 0; i < argument_size.size (); i++)                                                        // Setting current arguments...
+  {
+    if(argument_size[i] == 0)                                                                       // Checking for argument...
+    {
+      continue;
+    }
+
+    if(argument_value[i].empty ())                                                                  // Checking for local memory argument...
+    {
+      loc_error = clSetKernelArg (replica_id[loc_device_index], i, argument_size[i], NULL);
+    }
+
+    else
+    {
+      loc_replica = loc_buffer.end ();                                                              // Resetting replica buffer...
+
+      if(argument_size[i] == sizeof(cl_mem))                                                        // Checking for buffer argument...
+      {
+        loc_value   = *(cl_mem*)argument_value[i].data ();                                          // Getting argument value...
+        loc_replica = loc_buffer.find (loc_value);                                                  // Looking for replica buffer...
+      }
+
+      if(loc_replica != loc_buffer.end ())                                                          // Checking for replica buffer...
+      {
+        loc_error = clSetKernelArg (replica_id[loc_device_index], i, sizeof(cl_mem), &loc_replica->second);
+      }
+
+      else
+      {
+        loc_error = clSetKernelArg (replica_id[loc_device_index], i, argument_size[i], argument_value[i].data ());
+      }
+    }
+
+    baseline->check_error (loc_error);                                                              // Checking error...
+  }
+
+  return replica_id[loc_device_index];                                                              // Returning kernel copy...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////// describe //////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void kernel::describe ()
+{
+  cl_int  loc_error;                                                                                // Error code.
+  cl_uint loc_arguments = 0;                                                                        // Number of kernel arguments.
+
+  introspect (metadata_file ());                                                                    // Getting argument metadata...
+
+  clGetKernelInfo (kernel_id, CL_KERNEL_NUM_ARGS, sizeof(cl_uint), &loc_arguments, NULL);           // Getting number of kernel arguments...
+
+  if(!il || !argument.empty () || (loc_arguments == 0))                                             // Checking for missing SPIR-V metadata...
+  {
+    return;
+  }
+
+  baseline->warning ("no argument metadata for SPIR-V kernel " + kernel_name + ", building it from source!");
+
+  baseline->check_error (clReleaseKernel (kernel_id));                                              // Releasing SPIR-V kernel...
+  baseline->check_error (clReleaseProgram (program));                                               // Releasing SPIR-V program...
+  il = false;                                                                                       // Resetting SPIR-V program flag...
+
+  // Building OpenCL program (from the binary cache, if any):
+  program = baseline->build_program
+            (
+             baseline->context_id,                                                                  // OpenCL context ID.
+             baseline->device_list,                                                                 // Device ID list.
+             kernel_home,                                                                           // Kernel home directory.
+             kernel_source,                                                                         // Kernel sources.
+             build_options,                                                                         // Compiler options.
+             compiler_log                                                                           // Compiler log.
+            );
+
+  if(program == NULL)                                                                               // Checking compiled kernel...
+  {
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  kernel_id = clCreateKernel (program, kernel_name.c_str (), &loc_error);                           // Creating OpenCL kernel...
+  baseline->check_error (loc_error);                                                                // Checking error...
+
+  describe ();                                                                                      // Getting argument metadata from source...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////// introspect /////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void kernel::introspect
+(
+ std::string loc_file_name                                                                          // Argument metadata cache file name ("" = none).
+)
+{
+  cl_int             loc_error;                                                                     // Error code.
+  cl_uint            loc_arguments;                                                                 // Number of kernel arguments.
+  size_t             loc_size;                                                                      // Parameter size.
+  argument_structure loc_argument;                                                                  // Argument metadata.
+  std::ifstream      loc_input;                                                                     // Metadata cache input file.
+  std::ofstream      loc_output;                                                                    // Metadata cache output file.
+  std::string        loc_address;                                                                   // Address qualifier text.
+  std::string        loc_qualifier;                                                                 // Type qualifier text.
+  cl_uint            i;                                                                             // Index.
+
+  argument.clear ();                                                                                // Resetting argument metadata...
+
+  // Getting number of kernel arguments:
+  loc_error = clGetKernelInfo
+              (
+               kernel_id,                                                                           // Kernel id.
+               CL_KERNEL_NUM_ARGS,                                                                  // Parameter name.
+               sizeof(cl_uint),                                                                     // Parameter size.
+               &loc_arguments,                                                                      // Parameter value.
+               NULL                                                                                 // Returned parameter size.
+              );
+  baseline->check_error (loc_error);                                                                // Checking error...
+
+  for(i = 0; i < loc_arguments; i++)                                                                // Scanning kernel arguments...
+  {
+    // Getting argument name:
+    loc_error = clGetKernelArgInfo (kernel_id, i, CL_KERNEL_ARG_NAME, 0, NULL, &loc_size);
+
+    if(loc_error != CL_SUCCESS)                                                                     // Checking for metadata (not available for binary programs)...
+    {
+      break;
+    }
+
+    loc_argument.name.resize (loc_size);                                                            // Allocating name...
+    clGetKernelArgInfo (kernel_id, i, CL_KERNEL_ARG_NAME, loc_size, loc_argument.name.data (), NULL);
+    loc_argument.name = std::string (loc_argument.name.c_str ());                                   // Dropping null terminator...
+
+    // Getting argument type name:
+    clGetKernelArgInfo (kernel_id, i, CL_KERNEL_ARG_TYPE_NAME, 0, NULL, &loc_size);
+    loc_argument.type.resize (loc_size);                                                            // Allocating type name...
+    clGetKernelArgInfo (kernel_id, i, CL_KERNEL_ARG_TYPE_NAME, loc_size, loc_argument.type.data (), NULL);
+    loc_argument.type = std::string (loc_argument.type.c_str ());                                   // Dropping null terminator...
+
+    // Getting argument address qualifier:
+    clGetKernelArgInfo
+    (
+     kernel_id,                                                                                     // Kernel id.
+     i,                                                                                             // Layout index.
+     CL_KERNEL_ARG_ADDRESS_QUALIFIER,                                                               // Parameter name.
+     sizeof(cl_kernel_arg_address_qualifier),                                                       // Parameter size.
+     &loc_argument.address,                                                                         // Parameter value.
+     NULL                                                                                           // Returned parameter size.
+    );
+
+    // Getting argument type qualifier:
+    clGetKernelArgInfo
+    (
+     kernel_id,                                                                                     // Kernel id.
+     i,                                                                                             // Layout index.
+     CL_KERNEL_ARG_TYPE_QUALIFIER,                                                                  // Parameter name.
+     sizeof(cl_kernel_arg_type_qualifier),                                                          // Parameter size.
+     &loc_argument.qualifier,                                                                       // Parameter value.
+     NULL                                                                                           // Returned parameter size.
+    );
+
+    classify (loc_argument);                                                                        // Getting base type and vector width...
+    argument.push_back (loc_argument);                                                              // Storing argument metadata...
+  }
+
+  argument_index.clear ();                                                                          // Resetting argument indexes...
+
+  if(loc_file_name.empty ())                                                                        // Checking for metadata cache...
+  {
+    for(i = 0; i < argument.size (); i++)                                                           // Indexing arguments by name...
+    {
+      argument_index[argument[i].name] = i;
+    }
+
+    return;
+  }
+
+  if(argument.size () == loc_arguments)                                                             // Checking for complete metadata...
+  {
+    loc_output.open (loc_file_name);                                                                // Opening metadata cache file...
+
+    for(i = 0; i < argument.size (); i++)                                                           // Writing argument metadata...
+    {
+      loc_output << argument[i].address << "\t" << argument[i].qualifier << "\t" << argument[i].type << "\t" << argument[i].name << std::endl;
+    }
+
+    loc_output.close ();                                                                            // Closing metadata cache file...
+
+    for(i = 0; i < argument.size (); i++)                                                           // Indexing arguments by name...
+    {
+      argument_index[argument[i].name] = i;
+    }
+
+    return;
+  }
+
+  argument.clear ();                                                                                // Resetting partial argument metadata...
+  loc_input.open (loc_file_name);                                                                   // Opening metadata cache file...
+
+  while(std::getline (loc_input, loc_address, '\t') &&
+        std::getline (loc_input, loc_qualifier, '\t') &&
+        std::getline (loc_input, loc_argument.type, '\t') &&
+        std::getline (loc_input, loc_argument.name))                                                // Reading argument metadata...
+  {
+    if((loc_address.find_first_not_of ("0123456789") != std::string::npos) ||
+       (loc_qualifier.find_first_not_of ("0123456789") != std::string::npos) ||
+       loc_address.empty () || loc_qualifier.empty ())                                              // Checking format (e.g. stale cache file)...
+    {
+      argument.clear ();                                                                            // Discarding cached metadata...
+      break;
+    }
+
+    loc_argument.address   = (cl_kernel_arg_address_qualifier)std::stoul (loc_address);             // Converting address qualifier...
+    loc_argument.qualifier = (cl_kernel_arg_type_qualifier)std::stoul (loc_qualifier);              // Converting type qualifier...
+    classify (loc_argument);                                                                        // Getting base type and vector width...
+    argument.push_back (loc_argument);                                                              // Storing argument metadata...
+  }
+
+  if(argument.size () != loc_arguments)                                                             // Checking cached metadata...
+  {
+    argument.clear ();                                                                              // Metadata not available: no checks, no names...
+  }
+
+  for(i = 0; i < argument.size (); i++)                                                             // Indexing arguments by name...
+  {
+    argument_index[argument[i].name] = i;
+  }
+}
+
+void kernel::classify
+(
+ argument_structure& loc_argument                                                                   // Argument metadata.
+)
+{
+  std::string loc_type;                                                                             // Argument type name.
+  size_t      i;                                                                                    // Index.
+
+  loc_type = loc_argument.type;                                                                     // Getting argument type name...
+  loc_type.erase (std::remove (loc_type.begin (), loc_type.end (), '*'), loc_type.end ());          // Removing pointer...
+  i        = loc_type.find_first_of ("0123456789");                                                 // Finding vector width...
+
+  loc_argument.base  = loc_type.substr (0, i);                                                      // Getting argument base type...
+  loc_argument.width = (i == std::string::npos) ? 1 : std::stoul (loc_type.substr (i));             // Getting argument vector width...
+
+  if((loc_argument.base != "char") && (loc_argument.base != "uchar") && (loc_argument.base != "short") &&
+     (loc_argument.base != "ushort") && (loc_argument.base != "int") && (loc_argument.base != "uint") &&
+     (loc_argument.base != "long") && (loc_argument.base != "ulong") && (loc_argument.base != "half") &&
+     (loc_argument.base != "float") && (loc_argument.base != "double"))                             // Checking for built-in type...
+  {
+    loc_argument.base  = "";                                                                        // User defined type...
+    loc_argument.width = 1;
+  }
+}
+
+cl_uint kernel::index
+(
+ std::string loc_argument_name                                                                      // Argument name.
+)
+{
+  std::map<std::string, cl_uint>::iterator loc_index = argument_index.find (loc_argument_name);     // Argument layout index.
+
+  if(loc_index != argument_index.end ())                                                            // Checking argument name...
+  {
+    return loc_index->second;                                                                       // Returning layout index...
+  }
+
+  baseline->error ("Kernel argument \"" + loc_argument_name + "\" not found!");                     // Printing message...
+  exit (EXIT_FAILURE);                                                                              // Exiting...
+}
+
+void kernel::check
+(
+ cl_uint     loc_layout_index,                                                                      // Layout index.
+ std::string loc_base,                                                                              // Data base type ("long" or "float").
+ size_t      loc_width                                                                              // Data vector width [#].
+)
+{
+  if(loc_layout_index >= argument.size ())                                                          // Checking for argument metadata...
+  {
+    return;
+  }
+
+  if((argument[loc_layout_index].address != CL_KERNEL_ARG_ADDRESS_GLOBAL) &&
+     (argument[loc_layout_index].address != CL_KERNEL_ARG_ADDRESS_CONSTANT))                        // Checking address qualifier...
+  {
+    baseline->error ("Kernel argument \"" + argument[loc_layout_index].name + "\" is not a global pointer!"); // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  if(argument[loc_layout_index].base.empty ())                                                      // Checking for built-in type...
+  {
+    return;                                                                                         // Accepting user defined type...
+  }
+
+  // Checking base type and vector width (packed 3-component data can only be seen as scalars):
+  if((argument[loc_layout_index].base != loc_base) ||
+     ((argument[loc_layout_index].width != 1) && ((argument[loc_layout_index].width != loc_width) || (loc_width == 3))))
+  {
+    baseline->error ("Kernel argument \"" + argument[loc_layout_index].name + "\" type mismatch (" +
+                     argument[loc_layout_index].type + ")!");                                       // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+}
+
+void kernel::check_value
+(
+ cl_uint loc_layout_index,                                                                          // Layout index.
+ size_t  loc_size                                                                                   // Value size [bytes].
+)
+{
+  std::string loc_base;                                                                             // Argument base type.
+  size_t      loc_scalar;                                                                           // Argument scalar size [bytes].
+  size_t      loc_width;                                                                            // Argument vector width (3 stored as 4) [#].
+
+  if(loc_layout_index >= argument.size ())                                                          // Checking for argument metadata...
+  {
+    return;
+  }
+
+  if(argument[loc_layout_index].address != CL_KERNEL_ARG_ADDRESS_PRIVATE)                           // Checking address qualifier...
+  {
+    baseline->error ("Kernel argument \"" + argument[loc_layout_index].name + "\" is not passed by value!"); // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  loc_base = argument[loc_layout_index].base;                                                       // Getting argument base type...
+
+  if(loc_base.empty ())                                                                             // Checking for built-in type...
+  {
+    return;                                                                                         // Accepting user defined type...
+  }
+
+  loc_scalar = ((loc_base == "char") || (loc_base == "uchar")) ? 1 :
+               ((loc_base == "short") || (loc_base == "ushort") || (loc_base == "half")) ? 2 :
+               ((loc_base == "int") || (loc_base == "uint") || (loc_base == "float")) ? 4 : 8;      // Getting scalar size...
+  loc_width  = (argument[loc_layout_index].width == 3) ? 4 : argument[loc_layout_index].width;      // Getting stored vector width...
+
+  if(loc_size != loc_scalar*loc_width)                                                              // Checking value size...
+  {
+    baseline->error ("Kernel argument \"" + argument[loc_layout_index].name + "\" size mismatch (" +
+                     argument[loc_layout_index].type + ", " + std::to_string (loc_size) + " bytes given)!"); // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+}
+
+void kernel::rebind
+(
+ cl_uint loc_layout_index,                                                                          // Layout index.
+ cl_mem* loc_buffer,                                                                                // Data buffer.
+ size_t  loc_bytes                                                                                  // Data size [bytes].
+)
+{
+  // Storing argument size (for profiling):
+  if(argument_bytes.size () <= loc_layout_index)
+  {
+    argument_bytes.resize (loc_layout_index + 1, 0);                                                // Resizing argument size array...
+  }
+
+  argument_bytes[loc_layout_index] = loc_bytes;                                                     // Setting argument size...
+
+  baseline->check_error (bind (loc_layout_index, sizeof(cl_mem), loc_buffer));                      // Binding data buffer...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////// setarg "int1" by name overload ///////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void kernel::setarg
+(
+ int1*       loc_data,                                                                              // int1 data.
+ std::string loc_argument_name                                                                      // Argument name.
+)
+{
+  cl_uint loc_layout_index = index (loc_argument_name);                                             // Getting layout index...
+
+  if(!loc_data->ready)                                                                              // Checking for OpenCL buffer...
+  {
+    setarg (loc_data, loc_layout_index);                                                            // Creating OpenCL buffer...
+    return;
+  }
+
+  check (loc_layout_index, "long", 1);                                                              // Checking argument metadata...
+  loc_data->layout = loc_layout_index;                                                              // Setting layout index...
+  rebind (loc_layout_index, &loc_data->buffer, sizeof(cl_long)*loc_data->size);                     // Binding data buffer...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////// setarg "int2" by name overload ///////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void kernel::setarg
+(
+ int2*       loc_data,                                                                              // int2 data.
+ std::string loc_argument_name                                                                      // Argument name.
+)
+{
+  cl_uint loc_layout_index = index (loc_argument_name);                                             // Getting layout index...
+
+  if(!loc_data->ready)                                                                              // Checking for OpenCL buffer...
+  {
+    setarg (loc_data, loc_layout_index);                                                            // Creating OpenCL buffer...
+    return;
+  }
+
+  check (loc_layout_index, "long", 2);                                                              // Checking argument metadata...
+  loc_data->layout = loc_layout_index;                                                              // Setting layout index...
+  rebind (loc_layout_index, &loc_data->buffer, sizeof(int2_structure)*loc_data->size);              // Binding data buffer...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////// setarg "int3" by name overload ///////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void kernel::setarg
+(
+ int3*       loc_data,                                                                              // int3 data.
+ std::string loc_argument_name                                                                      // Argument name.
+)
+{
+  cl_uint loc_layout_index = index (loc_argument_name);                                             // Getting layout index...
+
+  if(!loc_data->ready)                                                                              // Checking for OpenCL buffer...
+  {
+    setarg (loc_data, loc_layout_index);                                                            // Creating OpenCL buffer...
+    return;
+  }
+
+  check (loc_layout_index, "long", 3);                                                              // Checking argument metadata...
+  loc_data->layout = loc_layout_index;                                                              // Setting layout index...
+  rebind (loc_layout_index, &loc_data->buffer, sizeof(int3_structure)*loc_data->size);              // Binding data buffer...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////// setarg "int4" by name overload ///////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void kernel::setarg
+(
+ int4*       loc_data,                                                                              // int4 data.
+ std::string loc_argument_name                                                                      // Argument name.
+)
+{
+  cl_uint loc_layout_index = index (loc_argument_name);                                             // Getting layout index...
+
+  if(!loc_data->ready)                                                                              // Checking for OpenCL buffer...
+  {
+    setarg (loc_data, loc_layout_index);                                                            // Creating OpenCL buffer...
+    return;
+  }
+
+  check (loc_layout_index, "long", 4);                                                              // Checking argument metadata...
+  loc_data->layout = loc_layout_index;                                                              // Setting layout index...
+  rebind (loc_layout_index, &loc_data->buffer, sizeof(int4_structure)*loc_data->size);              // Binding data buffer...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////// setarg "float1" by name overload //////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void kernel::setarg
+(
+ float1*     loc_data,                                                                              // float1 data.
+ std::string loc_argument_name                                                                      // Argument name.
+)
+{
+  cl_uint loc_layout_index = index (loc_argument_name);                                             // Getting layout index...
+
+  if(!loc_data->ready)                                                                              // Checking for OpenCL buffer...
+  {
+    setarg (loc_data, loc_layout_index);                                                            // Creating OpenCL buffer...
+    return;
+  }
+
+  check (loc_layout_index, "float", 1);                                                             // Checking argument metadata...
+  loc_data->layout = loc_layout_index;                                                              // Setting layout index...
+  rebind (loc_layout_index, &loc_data->buffer, sizeof(cl_float)*loc_data->size);                    // Binding data buffer...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////// setarg "float1G" by name overload //////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void kernel::setarg
+(
+ float1G*    loc_data,                                                                              // float1G data.
+ std::string loc_argument_name                                                                      // Argument name.
+)
+{
+  cl_uint loc_layout_index = index (loc_argument_name);                                             // Getting layout index...
+
+  if(!loc_data->ready)                                                                              // Checking for OpenCL buffer...
+  {
+    setarg (loc_data, loc_layout_index);                                                            // Creating OpenCL buffer...
+    return;
+  }
+
+  check (loc_layout_index, "float", 1);                                                             // Checking argument metadata...
+  loc_data->layout = loc_layout_index;                                                              // Setting layout index...
+  rebind (loc_layout_index, &loc_data->buffer, sizeof(GLfloat)*loc_data->size);                     // Binding data buffer...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////// setarg "float2" by name overload //////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void kernel::setarg
+(
+ float2*     loc_data,                                                                              // float2 data.
+ std::string loc_argument_name                                                                      // Argument name.
+)
+{
+  cl_uint loc_layout_index = index (loc_argument_name);                                             // Getting layout index...
+
+  if(!loc_data->ready)                                                                              // Checking for OpenCL buffer...
+  {
+    setarg (loc_data, loc_layout_index);                                                            // Creating OpenCL buffer...
+    return;
+  }
+
+  check (loc_layout_index, "float", 2);                                                             // Checking argument metadata...
+  loc_data->layout = loc_layout_index;                                                              // Setting layout index...
+  rebind (loc_layout_index, &loc_data->buffer, sizeof(float2_structure)*loc_data->size);            // Binding data buffer...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////// setarg "float3" by name overload //////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void kernel::setarg
+(
+ float3*     loc_data,                                                                              // float3 data.
+ std::string loc_argument_name                                                                      // Argument name.
+)
+{
+  cl_uint loc_layout_index = index (loc_argument_name);                                             // Getting layout index...
+
+  if(!loc_data->ready)                                                                              // Checking for OpenCL buffer...
+  {
+    setarg (loc_data, loc_layout_index);                                                            // Creating OpenCL buffer...
+    return;
+  }
+
+  check (loc_layout_index, "float", 3);                                                             // Checking argument metadata...
+  loc_data->layout = loc_layout_index;                                                              // Setting layout index...
+  rebind (loc_layout_index, &loc_data->buffer, sizeof(float3_structure)*loc_data->size);            // Binding data buffer...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////// setarg "float4" by name overload //////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void kernel::setarg
+(
+ float4*     loc_data,                                                                              // float4 data.
+ std::string loc_argument_name                                                                      // Argument name.
+)
+{
+  cl_uint loc_layout_index = index (loc_argument_name);                                             // Getting layout index...
+
+  if(!loc_data->ready)                                                                              // Checking for OpenCL buffer...
+  {
+    setarg (loc_data, loc_layout_index);                                                            // Creating OpenCL buffer...
+    return;
+  }
+
+  check (loc_layout_index, "float", 4);                                                             // Checking argument metadata...
+  loc_data->layout = loc_layout_index;                                                              // Setting layout index...
+  rebind (loc_layout_index, &loc_data->buffer, sizeof(float4_structure)*loc_data->size);            // Binding data buffer...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////// setarg "float4G" by name overload //////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void kernel::setarg
+(
+ float4G*    loc_data,                                                                              // float4G data.
+ std::string loc_argument_name                                                                      // Argument name.
+)
+{
+  cl_uint loc_layout_index = index (loc_argument_name);                                             // Getting layout index...
+
+  if(!loc_data->ready)                                                                              // Checking for OpenCL buffer...
+  {
+    setarg (loc_data, loc_layout_index);                                                            // Creating OpenCL buffer...
+    return;
+  }
+
+  check (loc_layout_index, "float", 4);                                                             // Checking argument metadata...
+  loc_data->layout = loc_layout_index;                                                              // Setting layout index...
+  rebind (loc_layout_index, &loc_data->buffer, sizeof(float4G_structure)*loc_data->size);           // Binding data buffer...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////// DESTRUCTOR ////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+kernel::~kernel()
+{
+  cl_int loc_error;                                                                                 // Error code.
+  size_t i;                                                                                         // Index.
+
+  if(watcher.joinable ())                                                                           // Checking for source watcher...
+  {
+    // Stopping source watcher thread:
+    {
+      std::lock_guard<std::mutex> loc_lock (watch_lock);                                            // Source watcher lock.
+      watch_stop = true;                                                                            // Setting source watcher "stop" flag...
+    }
+
+    watch_wakeup.notify_all ();                                                                     // Waking up source watcher thread...
+    watcher.join ();                                                                                // Waiting for source watcher thread...
+  }
+
+  if(reload_kernel != NULL)                                                                         // Checking for rebuilt kernel not swapped in...
+  {
+    clReleaseKernel (reload_kernel);                                                                // Releasing rebuilt kernel...
+    clReleaseProgram (reload_program);                                                              // Releasing rebuilt program...
+  }
+
+  for(i = 0; i < replica_id.size (); i++)                                                           // Scanning kernel copies...
+  {
+    if(replica_id[i] != NULL)
+    {
+      clReleaseKernel (replica_id[i]);                                                              // Releasing kernel copy...
+    }
+  }
+
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
+
+  baseline->action ("releasing OpenCL kernel...");                                                  // Printing message...
+  loc_error = clReleaseKernel (kernel_id);                                                          // Releasing OpenCL kernel...
+  baseline->check_error (loc_error);                                                                // Checking error code...
+  baseline->done ();                                                                                // Printing message...
+
+  if(event != NULL)                                                                                 // Checking for kernel event...
+  {
+    baseline->action ("releasing OpenCL kernel event...");                                          // Printing message...
+    loc_error = clReleaseEvent (event);                                                             // Releasing OpenCL event...
+    baseline->check_error (loc_error);                                                              // Checking error code...
+    baseline->done ();                                                                              // Printing message...
+  }
 
   baseline->action ("releasing OpenCL program...");                                                 // Printing message...
   loc_error = clReleaseProgram (program);                                                           // Releasing OpenCL program...
@@ -0,0 +1,109 @@
+/// @file     library.cpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Definition of an OpenCL "library" class.
+
+#include "library.hpp"
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// "library" class ///////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+library::library()
+{
+  baseline         = NULL;                                                                          // Initializing Neutrino baseline...
+  program          = NULL;                                                                          // Initializing library program...
+  il               = false;                                                                         // Initializing SPIR-V program flag...
+  compiler_options = "";                                                                            // Initializing compiler options...
+}
+
+void library::option
+(
+ std::string loc_option                                                                             // Compiler option.
+)
+{
+  compiler_options += " " + loc_option;                                                             // Appending compiler option...
+}
+
+void library::define
+(
+ std::string loc_name,                                                                              // Macro name.
+ std::string loc_value                                                                              // Macro value.
+)
+{
+  constant[loc_name] = loc_value;                                                                   // Setting specialization constant...
+}
+
+void library::init
+(
+ neutrino*                loc_baseline,                                                             // Neutrino baseline.
+ std::string              loc_library_home,                                                         // Library home directory.
+ std::vector<std::string> loc_library_file_name                                                     // OpenCL library file names.
+)
+{
+  std::string loc_slash;                                                                            // Slash character, according to the operating system.
+  std::string loc_build_options;                                                                    // Compiler options, including specialization macros.
+  size_t      i;                                                                                    // Index.
+
+  baseline     = loc_baseline;                                                                      // Getting Neutrino baseline...
+  library_home = loc_library_home;                                                                  // Getting library home directory...
+
+  #ifdef __linux__
+    loc_slash  = "/";                                                                               // Setting slash according to Linux...
+  #endif
+
+  #ifdef __APPLE__
+    loc_slash  = "/";                                                                               // Setting slash according to Apple...
+  #endif
+
+  #ifdef WIN32
+    loc_slash  = "\\";                                                                              // Setting slash according to Windows...
+  #endif
+
+  loc_build_options = baseline->build_options (compiler_options, constant);                         // Getting compiler options, including specialization macros...
+
+  for(i = 0; i < loc_library_file_name.size (); i++)
+  {
+    baseline->action ("loading OpenCL library source from file...");                                // Printing message...
+    library_file_name.push_back (library_home + loc_slash + loc_library_file_name[i]);              // Building up library file full name...
+    library_source.push_back (baseline->read_file (library_file_name[i]));                          // Loading file...
+    baseline->done ();                                                                              // Printing message...
+  }
+
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
+
+  if(constant.empty () && !library_file_name.empty ())                                              // Checking for specialization constants (not applicable to SPIR-V modules)...
+  {
+    program = baseline->load_il (library_file_name, compiler_options);                              // Loading precompiled SPIR-V module...
+  }
+
+  il = (program != NULL);                                                                           // Setting SPIR-V program flag...
+
+  if(program == NULL)                                                                               // Checking for SPIR-V module...
+  {
+    // Building OpenCL program (from the binary cache, if any):
+    program = baseline->build_program
+              (
+               baseline->context_id,                                                                // OpenCL context ID.
+               baseline->device_list,                                                               // Device ID list.
+               library_home,                                                                        // Library home directory.
+               library_source,                                                                      // Library sources.
+               loc_build_options,                                                                   // Compiler options.
+               compiler_log                                                                         // Compiler log.
+              );
+
+    if(program == NULL)                                                                             // Checking compiled program...
+    {
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
+  }
+}
+
+library::~library()
+{
+  if(program != NULL)                                                                               // Checking for program...
+  {
+    baseline->action ("releasing OpenCL library program...");                                       // Printing message...
+    baseline->check_error (clReleaseProgram (program));                                             // Releasing OpenCL program...
+    baseline->done ();                                                                              // Printing message...
+  }
+}
@@ -0,0 +1,288 @@
+/// @file     native.cpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Definition of the "native" class.
+
+#include "native.hpp"
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////// "native" class ///////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+native::native()
+{
+  size_i     = 0;                                                                                   // Initializing kernel size (i-index)...
+  size_j     = 0;                                                                                   // Initializing kernel size (j-index)...
+  size_k     = 0;                                                                                   // Initializing kernel size (k-index)...
+  block_size = 0;                                                                                   // Initializing block size (derived from the cache budget)...
+  cache_size = 0;                                                                                   // Initializing cache budget (detected)...
+  item_bytes = NU_NATIVE_ITEM;                                                                      // Initializing bytes per work-item...
+  threads    = 0;                                                                                   // Initializing number of worker threads (one per hardware thread)...
+  remaining  = 0;                                                                                   // Initializing number of blocks to be executed...
+  generation = 0;                                                                                   // Initializing execution counter...
+  stop       = false;                                                                               // Initializing worker threads "stop" flag...
+}
+
+bool native::next
+(
+ size_t           loc_worker,                                                                       // Worker index.
+ block_structure& loc_block                                                                         // Fetched block.
+)
+{
+  size_t loc_victim;                                                                                // Victim worker index.
+  size_t i;                                                                                         // Index.
+
+  // Taking next block from own queue:
+  {
+    std::lock_guard<std::mutex> loc_lock (block_lock[loc_worker]);                                  // Worker block queue lock.
+
+    if(!block[loc_worker].empty ())                                                                 // Checking for own blocks...
+    {
+      loc_block = block[loc_worker].front ();                                                       // Getting block...
+      block[loc_worker].pop_front ();                                                               // Removing block...
+      return true;
+    }
+  }
+
+  // Stealing block from another queue:
+  for(i = 1; i < block.size (); i++)                                                                // Scanning other workers...
+  {
+    loc_victim = (loc_worker + i) % block.size ();                                                  // Getting victim worker...
+
+    std::lock_guard<std::mutex> loc_lock (block_lock[loc_victim]);                                  // Victim block queue lock.
+
+    if(!block[loc_victim].empty ())                                                                 // Checking for victim blocks...
+    {
+      loc_block = block[loc_victim].back ();                                                        // Stealing block...
+      block[loc_victim].pop_back ();                                                                // Removing block...
+      return true;
+    }
+  }
+
+  return false;                                                                                     // No block left...
+}
+
+void native::halt ()
+{
+  size_t i;                                                                                         // Index.
+
+  if(worker.empty ())                                                                               // Checking for worker threads...
+  {
+    return;
+  }
+
+  wait ();                                                                                          // Waiting for current execution...
+
+  // Stopping worker threads:
+  {
+    std::lock_guard<std::mutex> loc_lock (lock);                                                    // Thread pool lock.
+    stop = true;                                                                                    // Setting worker threads "stop" flag...
+  }
+
+  wakeup.notify_all ();                                                                             // Waking up worker threads...
+
+  for(i = 0; i < worker.size (); i++)                                                               // Scanning worker threads...
+  {
+    worker[i].join ();                                                                              // Waiting for worker thread to end...
+  }
+
+  worker.clear ();                                                                                  // Resetting worker threads...
+}
+
+void native::work_loop
+(
+ size_t loc_worker                                                                                  // Worker index.
+)
+{
+  block_structure loc_block;                                                                        // Current block.
+  size_t          loc_generation = 0;                                                               // Last seen execution counter [#].
+  size_t          i;                                                                                // i-index.
+  size_t          j;                                                                                // j-index.
+  size_t          k;                                                                                // k-index.
+
+  while(true)
+  {
+    // Waiting for an execution to be started:
+    {
+      std::unique_lock<std::mutex> loc_lock (lock);                                                 // Thread pool lock.
+      wakeup.wait (loc_lock, [this, &loc_generation] {return stop || (generation != loc_generation);});
+
+      if(stop)                                                                                      // Checking for "stop" flag...
+      {
+        break;                                                                                      // Stopping worker thread...
+      }
+
+      loc_generation = generation;                                                                  // Getting execution counter...
+    }
+
+    while(next (loc_worker, loc_block))                                                             // Executing blocks...
+    {
+      for(k = loc_block.begin[2]; k < loc_block.end[2]; k++)
+      {
+        for(j = loc_block.begin[1]; j < loc_block.end[1]; j++)
+        {
+          for(i = loc_block.begin[0]; i < loc_block.end[0]; i++)
+          {
+            body (i, j, k);                                                                         // Executing work-item...
+          }
+        }
+      }
+
+      if(--remaining == 0)                                                                          // Checking for last block...
+      {
+        std::lock_guard<std::mutex> loc_lock (lock);                                                // Thread pool lock.
+        finished.notify_all ();                                                                     // Waking up waiting threads...
+      }
+    }
+  }
+}
+
+void native::init
+(
+ size_t                                       loc_size_i,                                           // Kernel size (i-index).
+ size_t                                       loc_size_j,                                           // Kernel size (j-index).
+ size_t                                       loc_size_k,                                           // Kernel size (k-index).
+ std::function<void (size_t, size_t, size_t)> loc_body                                              // Kernel body (i, j, k).
+)
+{
+  block_structure loc_block;                                                                        // Block.
+  size_t          loc_block_i;                                                                      // Block size (i-index).
+  size_t          loc_block_j;                                                                      // Block size (j-index).
+  size_t          loc_block_k;                                                                      // Block size (k-index).
+  size_t          loc_block_size = block_size;                                                      // Work-items per block [#].
+  size_t          loc_cache      = cache_size;                                                      // Cache budget per block [bytes].
+  size_t          i;                                                                                // i-index.
+  size_t          j;                                                                                // j-index.
+  size_t          k;                                                                                // k-index.
+
+  halt ();                                                                                          // Stopping worker threads of a previous initialization, if any...
+
+  size_i   = std::max (loc_size_i, (size_t)1);                                                      // Getting kernel size (i-index)...
+  size_j   = std::max (loc_size_j, (size_t)1);                                                      // Getting kernel size (j-index)...
+  size_k   = std::max (loc_size_k, (size_t)1);                                                      // Getting kernel size (k-index)...
+  body     = loc_body;                                                                              // Getting kernel body...
+
+  if(threads == 0)                                                                                  // Checking for automatic number of threads...
+  {
+    threads = std::max (std::thread::hardware_concurrency (), 1u);                                  // Using one thread per hardware thread...
+  }
+
+  #ifdef __linux__
+    if(loc_cache == 0)                                                                              // Checking for cache budget...
+    {
+      std::ifstream loc_file ("/sys/devices/system/cpu/cpu0/cache/index2/size");                    // L2 cache size file (e.g. "1024K").
+      std::string   loc_size;                                                                       // L2 cache size.
+
+      if((loc_file >> loc_size) && (loc_size.find_first_of ("0123456789") == 0))                    // Reading L2 cache size...
+      {
+        loc_cache = std::stoul (loc_size);
+
+        switch(loc_size.back ())                                                                    // Checking for unit...
+        {
+          case 'K':
+            loc_cache *= 1024;
+            break;
+
+          case 'M':
+            loc_cache *= 1024*1024;
+            break;
+        }
+      }
+    }
+  #endif
+
+  if(loc_cache == 0)                                                                                // Checking for detected cache size...
+  {
+    loc_cache = NU_NATIVE_CACHE;                                                                    // Using default cache budget...
+  }
+
+  if(loc_block_size == 0)                                                                           // Checking for automatic block size...
+  {
+    loc_block_size = loc_cache/std::max (item_bytes, (size_t)1);                                    // Fitting the block data in the cache...
+  }
+
+  // Getting block sizes (contiguous work-items along i first, then j and k):
+  loc_block_size = std::max (loc_block_size, (size_t)1);
+  loc_block_i    = std::min (size_i, loc_block_size);
+  loc_block_j    = std::min (size_j, std::max (loc_block_size/loc_block_i, (size_t)1));
+  loc_block_k    = std::min (size_k, std::max (loc_block_size/(loc_block_i*loc_block_j), (size_t)1));
+
+  tile.clear ();                                                                                    // Resetting blocks...
+
+  for(k = 0; k < size_k; k += loc_block_k)                                                          // Partitioning the index space...
+  {
+    for(j = 0; j < size_j; j += loc_block_j)
+    {
+      for(i = 0; i < size_i; i += loc_block_i)
+      {
+        loc_block.begin[0] = i;
+        loc_block.begin[1] = j;
+        loc_block.begin[2] = k;
+        loc_block.end[0]   = std::min (i + loc_block_i, size_i);
+        loc_block.end[1]   = std::min (j + loc_block_j, size_j);
+        loc_block.end[2]   = std::min (k + loc_block_k, size_k);
+        tile.push_back (loc_block);                                                                 // Adding block...
+      }
+    }
+  }
+
+  // Allocating worker block queues:
+  std::vector<std::mutex> loc_block_lock (threads);
+  block_lock.swap (loc_block_lock);
+  block.assign (threads, std::deque<block_structure> ());
+
+  stop       = false;                                                                               // Resetting worker threads "stop" flag...
+  generation = 0;                                                                                   // Resetting execution counter...
+
+  for(i = 0; i < threads; i++)                                                                      // Starting worker threads...
+  {
+    worker.push_back (std::thread (&native::work_loop, this, i));
+  }
+}
+
+void native::execute
+(
+ native_mode loc_native_mode                                                                        // Native kernel mode.
+)
+{
+  size_t loc_begin;                                                                                 // Worker first block.
+  size_t loc_end;                                                                                   // Worker last block (excluded).
+  size_t w;                                                                                         // Worker index.
+
+  wait ();                                                                                          // Waiting for previous execution...
+
+  remaining = tile.size ();                                                                         // Setting number of blocks to be executed...
+
+  for(w = 0; w < threads; w++)                                                                      // Handing contiguous blocks to each worker...
+  {
+    loc_begin = tile.size ()*w/threads;
+    loc_end   = tile.size ()*(w + 1)/threads;
+
+    std::lock_guard<std::mutex> loc_lock (block_lock[w]);                                           // Worker block queue lock.
+    block[w].assign (tile.begin () + loc_begin, tile.begin () + loc_end);                           // Setting worker blocks...
+  }
+
+  // Starting execution:
+  {
+    std::lock_guard<std::mutex> loc_lock (lock);                                                    // Thread pool lock.
+    generation++;                                                                                   // Advancing execution counter...
+  }
+
+  wakeup.notify_all ();                                                                             // Waking up worker threads...
+
+  if(loc_native_mode != NU_NATIVE_DONT_WAIT)                                                        // Checking for native kernel mode...
+  {
+    wait ();                                                                                        // Waiting for execution to complete...
+  }
+}
+
+void native::wait ()
+{
+  std::unique_lock<std::mutex> loc_lock (lock);                                                     // Thread pool lock.
+
+  finished.wait (loc_lock, [this] {return remaining == 0;});                                        // Waiting for all blocks...
+}
+
+native::~native()
+{
+  halt ();                                                                                          // Stopping worker threads...
+}
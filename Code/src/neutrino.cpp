@@ -4,6 +4,8 @@
 /// @brief    Definition of the "neutrino" class and some macros.
 
 #include "neutrino.hpp"
+#include "profiler.hpp"
+#include "tracer.hpp"
 
 //////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////// "neutrino" class ///////////////////////////////
@@ -11,6 +13,7 @@
 neutrino::neutrino()
 {
   interop     = false;                                                                              // Use OpenCL-OpenGL interop.
+  headless    = false;                                                                              // Compute-only mode.
   tic         = 0.0;                                                                                // Tic time [us].
   toc         = 0.0;                                                                                // Toc time [us].
   loop_time   = 0.0;                                                                                // Loop time [us].
@@ -18,6 +21,10 @@ neutrino::neutrino()
   context_id  = NULL;                                                                               // OpenCL context ID.
   platform_id = NULL;                                                                               // OpenCL platform ID.
   device_id   = NULL;                                                                               // OpenCL device ID.
+  profiling   = NULL;                                                                               // OpenCL event profiler.
+  tracing     = NULL;                                                                               // Host/device trace recorder.
+  cache       = true;                                                                               // Use OpenCL program binary cache.
+  cache_home  = "";                                                                                 // Device cache home directory.
 }
 
 void neutrino::init
@@ -61,7 +68,10 @@ void neutrino::init
 
 void neutrino::get_tic ()
 {
-  tic = glfwGetTime ();                                                                             // Getting "tic"...
+  tic = std::chrono::duration<double>
+        (
+         std::chrono::steady_clock::now ().time_since_epoch ()
+        ).count ();                                                                                 // Getting "tic"...
 }
 
 void neutrino::get_toc ()
@@ -69,7 +79,10 @@ void neutrino::get_toc ()
   std::string loc_text;                                                                             // Text buffer.
   std::string loc_pad;                                                                              // Text pad.
 
-  toc            = glfwGetTime ();                                                                  // Getting "toc"...
+  toc            = std::chrono::duration<double>
+                   (
+                    std::chrono::steady_clock::now ().time_since_epoch ()
+                   ).count ();                                                                      // Getting "toc"...
   loop_time      = toc - tic;                                                                       // Loop execution time [s].
   terminal_time += size_t (round (loop_time*1000000.0f));                                           // Terminal time [us].
 
@@ -90,6 +103,183 @@ void neutrino::get_toc ()
   }
 }
 
+void neutrino::gl_finish ()
+{
+  if(!headless)                                                                                     // Checking for OpenGL context...
+  {
+    glFinish ();                                                                                    // Waiting for OpenGL to finish...
+  }
+}
+
+cl_mem neutrino::create_buffer
+(
+ size_t  loc_size,                                                                                  // Data buffer size [bytes].
+ void*   loc_data,                                                                                  // Data buffer.
+ cl_int* loc_error                                                                                  // Error code.
+)
+{
+  cl_mem                   loc_buffer;                                                              // Data buffer.
+  char*                    loc_host = NULL;                                                         // Page aligned host allocation.
+  size_t                   loc_pages;                                                               // Host allocation size [bytes].
+  double                   loc_share = 0.0;                                                         // Cumulative placement share.
+  std::vector<size_t>      loc_begin (placement.size () + 1, 0);                                    // Placement slice boundaries [bytes].
+  std::vector<std::thread> loc_touch;                                                               // First-touch threads.
+  size_t                   i;                                                                       // Index.
+
+  if(placement.size () < 2)                                                                         // Checking for NUMA placement...
+  {
+    // Creating OpenCL memory buffer:
+    loc_buffer = clCreateBuffer
+                 (
+                  context_id,                                                                       // OpenCL context.
+                  CL_MEM_READ_WRITE |                                                               // Memory flag.
+                  CL_MEM_COPY_HOST_PTR,                                                             // Memory flag.
+                  loc_size,                                                                         // Data buffer size.
+                  loc_data,                                                                         // Data buffer.
+                  loc_error                                                                         // Error code.
+                 );
+
+    return loc_buffer;                                                                              // Returning buffer...
+  }
+
+  loc_pages = ((std::max (loc_size, (size_t)1) + NU_PAGE_SIZE - 1)/NU_PAGE_SIZE)*NU_PAGE_SIZE;      // Rounding allocation to whole pages...
+
+  // Allocating page aligned host memory (not touched yet):
+  #ifdef __linux__
+    if(posix_memalign ((void**)&loc_host, NU_PAGE_SIZE, loc_pages) != 0)
+    {
+      loc_host = NULL;
+    }
+  #endif
+
+  #ifdef __APPLE__
+    if(posix_memalign ((void**)&loc_host, NU_PAGE_SIZE, loc_pages) != 0)
+    {
+      loc_host = NULL;
+    }
+  #endif
+
+  #ifdef WIN32
+    loc_host = (char*)_aligned_malloc (loc_pages, NU_PAGE_SIZE);
+  #endif
+
+  if(loc_host == NULL)                                                                              // Checking allocation...
+  {
+    *loc_error = CL_OUT_OF_HOST_MEMORY;                                                             // Setting error...
+    return NULL;
+  }
+
+  for(i = 0; i < placement.size (); i++)                                                            // Getting slice boundaries (whole pages, proportional to the shares)...
+  {
+    loc_share       += placement[i];
+    loc_begin[i + 1] = (i == (placement.size () - 1)) ? loc_pages :
+                       std::min ((size_t)(loc_share*loc_pages/NU_PAGE_SIZE + 0.5)*NU_PAGE_SIZE, loc_pages);
+    loc_begin[i + 1] = std::max (loc_begin[i + 1], loc_begin[i]);
+  }
+
+  for(i = 0; i < placement.size (); i++)                                                            // Scanning NUMA nodes...
+  {
+    // Initializing slice from a thread pinned to its NUMA node (first touch):
+    loc_touch.push_back (std::thread ([this, i, loc_host, loc_data, loc_size, &loc_begin] ()
+    {
+      size_t loc_end = loc_begin[i];                                                                // End of the slice part copied from the data [bytes].
+
+      pin (i);                                                                                      // Pinning thread to NUMA node...
+
+      if(loc_data != NULL)                                                                          // Checking for data...
+      {
+        loc_end = std::max (std::min (loc_begin[i + 1], loc_size), loc_begin[i]);
+        std::copy ((char*)loc_data + loc_begin[i], (char*)loc_data + loc_end, loc_host + loc_begin[i]);
+      }
+
+      std::fill (loc_host + loc_end, loc_host + loc_begin[i + 1], 0);                               // Touching the rest of the slice...
+    }));
+  }
+
+  for(i = 0; i < loc_touch.size (); i++)                                                            // Scanning first-touch threads...
+  {
+    loc_touch[i].join ();                                                                           // Waiting for slice...
+  }
+
+  // Creating OpenCL memory buffer on the placed host memory:
+  loc_buffer = clCreateBuffer
+               (
+                context_id,                                                                         // OpenCL context.
+                CL_MEM_READ_WRITE |                                                                 // Memory flag.
+                CL_MEM_USE_HOST_PTR,                                                                // Memory flag.
+                loc_size,                                                                           // Data buffer size.
+                loc_host,                                                                           // Data buffer (placed host memory).
+                loc_error                                                                           // Error code.
+               );
+
+  if(*loc_error != CL_SUCCESS)                                                                      // Checking error...
+  {
+    release_host (NULL, loc_host);                                                                  // Freeing host memory...
+    return NULL;
+  }
+
+  *loc_error = clSetMemObjectDestructorCallback (loc_buffer, &neutrino::release_host, loc_host);    // Freeing host memory along with the buffer...
+
+  return loc_buffer;                                                                                // Returning buffer...
+}
+
+void neutrino::pin
+(
+ size_t loc_node                                                                                    // NUMA node index.
+)
+{
+  #ifdef __linux__
+    std::ifstream loc_file ("/sys/devices/system/node/node" + std::to_string (loc_node) + "/cpulist"); // CPU list file (e.g. "0-15,32-47").
+    std::string   loc_range;                                                                        // CPU range.
+    size_t        loc_dash;                                                                         // Range separator position.
+    size_t        loc_first;                                                                        // First CPU of range.
+    size_t        loc_last;                                                                         // Last CPU of range.
+    size_t        i;                                                                                // CPU index.
+    cpu_set_t     loc_set;                                                                          // CPU set.
+
+    if(!loc_file)                                                                                   // Checking for NUMA node...
+    {
+      return;
+    }
+
+    CPU_ZERO (&loc_set);                                                                            // Resetting CPU set...
+
+    while(std::getline (loc_file, loc_range, ','))                                                  // Reading CPU ranges...
+    {
+      if(loc_range.find_first_of ("0123456789") == std::string::npos)                               // Checking for empty range...
+      {
+        continue;
+      }
+
+      loc_dash  = loc_range.find ('-');                                                             // Finding range separator...
+      loc_first = std::stoul (loc_range.substr (0, loc_dash));                                      // Getting first CPU...
+      loc_last  = (loc_dash == std::string::npos) ? loc_first : std::stoul (loc_range.substr (loc_dash + 1));
+
+      for(i = loc_first; (i <= loc_last) && (i < CPU_SETSIZE); i++)                                 // Adding CPUs...
+      {
+        CPU_SET (i, &loc_set);
+      }
+    }
+
+    sched_setaffinity (0, sizeof(cpu_set_t), &loc_set);                                             // Pinning calling thread...
+  #endif
+}
+
+void CL_CALLBACK neutrino::release_host
+(
+ cl_mem loc_buffer,                                                                                 // Released buffer.
+ void*  loc_data                                                                                    // Host allocation.
+)
+{
+  (void)loc_buffer;                                                                                 // Unused (required by the OpenCL callback signature)...
+
+  #ifdef WIN32
+    _aligned_free (loc_data);                                                                       // Freeing host memory...
+  #else
+    free (loc_data);                                                                                // Freeing host memory...
+  #endif
+}
+
 std::string neutrino::read_file
 (
  std::string loc_file_name                                                                          // File name.
@@ -496,6 +686,620 @@ std::string neutrino::get_error
   }
 }
 
+std::string neutrino::hash
+(
+ std::string loc_text                                                                               // Text.
+)
+{
+  size_t   i;                                                                                       // Index.
+  cl_ulong loc_hash;                                                                                // Hash value.
+  char     loc_digits[17];                                                                          // Hexadecimal digits.
+
+  loc_hash = 14695981039346656037ULL;                                                               // Setting FNV-1a offset basis...
+
+  for(i = 0; i < loc_text.size (); i++)                                                             // Scanning text...
+  {
+    loc_hash ^= (cl_ulong)(unsigned char)loc_text[i];                                               // Mixing character...
+    loc_hash *= 1099511628211ULL;                                                                   // Multiplying by FNV-1a prime...
+  }
+
+  snprintf (loc_digits, sizeof(loc_digits), "%016llx", (unsigned long long)loc_hash);               // Converting to hexadecimal...
+
+  return std::string (loc_digits);                                                                  // Returning hash...
+}
+
+std::string neutrino::cache_file
+(
+ std::string loc_kernel_home,                                                                       // Kernel home directory.
+ std::string loc_key,                                                                               // Cache key (program sources and compiler options).
+ std::string loc_extension                                                                          // Cache file extension.
+)
+{
+  return cache_file (loc_kernel_home, loc_key, loc_extension, device_id);                           // Returning cache file name for the current device...
+}
+
+std::string neutrino::cache_file
+(
+ std::string  loc_kernel_home,                                                                      // Kernel home directory.
+ std::string  loc_key,                                                                              // Cache key.
+ std::string  loc_extension,                                                                        // Cache file extension.
+ cl_device_id loc_device_id                                                                         // OpenCL device ID.
+)
+{
+  std::string loc_slash;                                                                            // Slash character, according to the operating system.
+  std::string loc_directory;                                                                        // Cache directory.
+  char        loc_device_name[NU_MAX_PATH_SIZE];                                                    // Device name.
+  char        loc_driver_version[NU_MAX_PATH_SIZE];                                                 // Driver version.
+
+  #ifdef __linux__
+    loc_slash = "/";                                                                                // Setting slash according to Linux...
+  #endif
+
+  #ifdef __APPLE__
+    loc_slash = "/";                                                                                // Setting slash according to Apple...
+  #endif
+
+  #ifdef WIN32
+    loc_slash = "\\";                                                                               // Setting slash according to Windows...
+  #endif
+
+  // Getting device name and driver version:
+  loc_device_name[0]    = '\0';
+  loc_driver_version[0] = '\0';
+  clGetDeviceInfo (loc_device_id, CL_DEVICE_NAME, sizeof(loc_device_name), loc_device_name, NULL);
+  clGetDeviceInfo (loc_device_id, CL_DRIVER_VERSION, sizeof(loc_driver_version), loc_driver_version, NULL);
+
+  loc_directory = loc_kernel_home + loc_slash + NU_CACHE_DIRECTORY;                                 // Setting cache directory...
+
+  // Creating cache directory (if not existing):
+  #ifdef __linux__
+    mkdir (loc_directory.c_str (), 0755);
+  #endif
+
+  #ifdef __APPLE__
+    mkdir (loc_directory.c_str (), 0755);
+  #endif
+
+  #ifdef WIN32
+    _mkdir (loc_directory.c_str ());
+  #endif
+
+  // Returning cache file name:
+  return loc_directory +
+         loc_slash +
+         hash (loc_key + '\0' + loc_device_name + '\0' + loc_driver_version) +
+         loc_extension;
+}
+
+std::string neutrino::headers
+(
+ std::string loc_kernel_home,                                                                       // Kernel home directory.
+ std::string loc_source                                                                             // Program source.
+)
+{
+  std::string              loc_slash;                                                               // Slash character, according to the operating system.
+  std::string              loc_key;                                                                 // Header key (names and contents).
+  std::string              loc_line;                                                                // Source line.
+  std::string              loc_name;                                                                // Header file name.
+  std::string              loc_text;                                                                // Header file content.
+  std::vector<std::string> loc_pending (1, loc_source);                                             // Texts to be scanned.
+  std::vector<std::string> loc_included;                                                            // Included header names.
+  size_t                   loc_begin;                                                               // Token beginning.
+  size_t                   loc_end;                                                                 // Token end.
+
+  #ifdef __linux__
+    loc_slash = "/";                                                                                // Setting slash according to Linux...
+  #endif
+
+  #ifdef __APPLE__
+    loc_slash = "/";                                                                                // Setting slash according to Apple...
+  #endif
+
+  #ifdef WIN32
+    loc_slash = "\\";                                                                               // Setting slash according to Windows...
+  #endif
+
+  while(!loc_pending.empty ())                                                                      // Scanning texts...
+  {
+    std::istringstream loc_stream (loc_pending.back ());                                            // Text stream.
+
+    loc_pending.pop_back ();                                                                        // Removing text from the scan list...
+
+    while(std::getline (loc_stream, loc_line))                                                      // Scanning lines...
+    {
+      loc_begin = loc_line.find_first_not_of (" \t");                                               // Skipping indentation...
+
+      if((loc_begin == std::string::npos) || (loc_line[loc_begin] != '#'))                          // Checking for preprocessor directive...
+      {
+        continue;
+      }
+
+      loc_begin = loc_line.find_first_not_of (" \t", loc_begin + 1);                                // Skipping spaces after "#"...
+
+      if((loc_begin == std::string::npos) || (loc_line.compare (loc_begin, 7, "include") != 0))     // Checking for include directive...
+      {
+        continue;
+      }
+
+      loc_begin = loc_line.find ('"', loc_begin + 7);                                               // Finding opening quote...
+      loc_end   = (loc_begin == std::string::npos) ? std::string::npos : loc_line.find ('"', loc_begin + 1);
+
+      if(loc_end == std::string::npos)                                                              // Checking for quoted header...
+      {
+        continue;
+      }
+
+      loc_name = loc_line.substr (loc_begin + 1, loc_end - loc_begin - 1);                          // Getting header name...
+
+      if(std::find (loc_included.begin (), loc_included.end (), loc_name) != loc_included.end ())   // Checking for already included header...
+      {
+        continue;
+      }
+
+      loc_included.push_back (loc_name);                                                            // Marking header as included...
+
+      std::ifstream loc_file (loc_kernel_home + loc_slash + loc_name, std::ios::in | std::ios::binary);
+
+      if(!loc_file)                                                                                 // Checking for header in kernel home...
+      {
+        continue;
+      }
+
+      loc_text.assign (std::istreambuf_iterator<char>(loc_file), std::istreambuf_iterator<char>()); // Reading header...
+      loc_key += loc_name + '\0' + loc_text + '\0';                                                 // Appending header to key...
+      loc_pending.push_back (loc_text);                                                             // Scanning nested includes...
+    }
+  }
+
+  return loc_key;                                                                                   // Returning header key...
+}
+
+cl_program neutrino::load_program
+(
+ std::string  loc_file_name,                                                                        // Cache file name.
+ std::string  loc_options,                                                                          // Compiler options.
+ cl_context   loc_context,                                                                          // OpenCL context.
+ cl_device_id loc_device_id                                                                         // OpenCL device ID.
+)
+{
+  cl_int               loc_error;                                                                   // Error code.
+  cl_int               loc_status;                                                                  // Binary status.
+  cl_program           loc_program;                                                                 // OpenCL program.
+  std::string          loc_binary;                                                                  // Program binary.
+  size_t               loc_size;                                                                    // Program binary size.
+  const unsigned char* loc_pointer;                                                                 // Program binary pointer.
+  std::ifstream        loc_file (loc_file_name, std::ios::in | std::ios::binary);                   // Cache file.
+
+  if(!loc_file)                                                                                     // Checking cache file...
+  {
+    return NULL;                                                                                    // No cached binary...
+  }
+
+  action ("loading OpenCL program from binary cache...");                                           // Printing message...
+
+  loc_file.seekg (0, std::ios::end);
+  loc_binary.resize (loc_file.tellg ());
+  loc_file.seekg (0, std::ios::beg);
+  loc_file.read (loc_binary.data (), loc_binary.size ());
+  loc_file.close ();
+
+  loc_size    = loc_binary.size ();                                                                 // Getting binary size...
+  loc_pointer = (const unsigned char*)loc_binary.data ();                                           // Getting binary pointer...
+
+  // Creating OpenCL program from binary:
+  loc_program = clCreateProgramWithBinary
+                (
+                 loc_context,                                                                       // OpenCL context ID.
+                 1,                                                                                 // Number of devices.
+                 &loc_device_id,                                                                    // Device ID.
+                 &loc_size,                                                                         // Binary size.
+                 &loc_pointer,                                                                      // Binary.
+                 &loc_status,                                                                       // Binary status.
+                 &loc_error                                                                         // Error code.
+                );
+
+  if((loc_error != CL_SUCCESS) || (loc_status != CL_SUCCESS))                                       // Checking for stale binary...
+  {
+    if(loc_program != NULL)
+    {
+      clReleaseProgram (loc_program);                                                               // Releasing program...
+    }
+
+    unfulfilled ();                                                                                 // Printing message...
+    return NULL;                                                                                    // Stale binary...
+  }
+
+  // Building OpenCL program:
+  loc_error = clBuildProgram
+              (
+               loc_program,                                                                         // Program.
+               1,                                                                                   // Number of devices.
+               &loc_device_id,                                                                      // Device ID.
+               loc_options.c_str (),                                                                // Compiler options.
+               NULL,                                                                                // Notification routine.
+               NULL                                                                                 // Notification argument.
+              );
+
+  if(loc_error != CL_SUCCESS)                                                                       // Checking for stale binary...
+  {
+    clReleaseProgram (loc_program);                                                                 // Releasing program...
+    unfulfilled ();                                                                                 // Printing message...
+    return NULL;                                                                                    // Stale binary...
+  }
+
+  done ();                                                                                          // Printing message...
+
+  return loc_program;                                                                               // Returning program...
+}
+
+std::string neutrino::build_options
+(
+ std::string                        loc_compiler_options,                                           // Compiler options.
+ std::map<std::string, std::string> loc_constant                                                    // Specialization constants.
+)
+{
+  std::string                                  loc_options;                                         // Build options.
+  std::map<std::string, std::string>::iterator loc_macro;                                           // Specialization constant.
+
+  loc_options = loc_compiler_options + " -cl-kernel-arg-info";                                      // Getting compiler options (keeping argument metadata)...
+
+  // Injecting specialization constants as macros:
+  for(loc_macro = loc_constant.begin (); loc_macro != loc_constant.end (); loc_macro++)
+  {
+    loc_options += " -D" + loc_macro->first + "=" + loc_macro->second;                              // Adding macro...
+  }
+
+  return loc_options;                                                                               // Returning build options...
+}
+
+cl_program neutrino::build_program
+(
+ cl_context                loc_context,                                                             // OpenCL context.
+ std::vector<cl_device_id> loc_device,                                                              // OpenCL device IDs.
+ std::string               loc_kernel_home,                                                         // Kernel home directory ("" = no cache).
+ std::vector<std::string>  loc_source,                                                              // Program sources.
+ std::string               loc_options,                                                             // Compiler options.
+ std::string&              loc_log                                                                  // OpenCL JIT compiler log.
+)
+{
+  cl_int                   loc_error;                                                               // Error code.
+  cl_program               loc_program;                                                             // OpenCL program.
+  std::string              loc_key;                                                                 // Program cache key.
+  std::string              loc_cache_file;                                                          // Program cache file name.
+  std::vector<const char*> loc_pointer;                                                             // Source pointer array.
+  std::vector<size_t>      loc_size;                                                                // Source size array.
+  size_t                   loc_log_size;                                                            // OpenCL JIT compiler log size.
+  size_t                   i;                                                                       // Index.
+
+  loc_log.clear ();                                                                                 // Resetting compiler log...
+
+  if(cache && !loc_kernel_home.empty () && (loc_device.size () == 1))                               // Checking for program cache (single device binaries only)...
+  {
+    for(i = 0; i < loc_source.size (); i++)                                                         // Scanning program sources...
+    {
+      loc_key += loc_source[i] + '\0';                                                              // Appending program source to cache key...
+      loc_key += headers (loc_kernel_home, loc_source[i]);                                          // Appending included headers to cache key...
+    }
+
+    loc_key       += loc_options;                                                                   // Appending compiler options to cache key...
+    loc_cache_file = cache_file (loc_kernel_home, loc_key, NU_CACHE_EXTENSION, loc_device[0]);      // Getting cache file name...
+    loc_program    = load_program (loc_cache_file, loc_options, loc_context, loc_device[0]);        // Loading cached program...
+
+    if(loc_program != NULL)                                                                         // Checking for cached program...
+    {
+      return loc_program;                                                                           // Returning cached program...
+    }
+  }
+
+  for(i = 0; i < loc_source.size (); i++)                                                           // Getting source pointers...
+  {
+    loc_pointer.push_back (loc_source[i].c_str ());                                                 // Getting source pointer...
+    loc_size.push_back (loc_source[i].size ());                                                     // Getting source size...
+  }
+
+  action ("creating OpenCL program from source...");                                                // Printing message...
+
+  // Creating OpenCL program:
+  loc_program = clCreateProgramWithSource
+                (
+                 loc_context,                                                                       // OpenCL context ID.
+                 (cl_uint)loc_pointer.size (),                                                      // Number of program sources.
+                 loc_pointer.data (),                                                               // Program source.
+                 loc_size.data (),                                                                  // Source size.
+                 &loc_error                                                                         // Error code.
+                );
+
+  if(loc_error != CL_SUCCESS)                                                                       // Checking program...
+  {
+    error (get_error (loc_error));                                                                  // Printing message...
+    return NULL;
+  }
+
+  done ();                                                                                          // Printing message...
+
+  action ("building OpenCL program...");                                                            // Printing message...
+
+  // Building OpenCL program:
+  loc_error = clBuildProgram
+              (
+               loc_program,                                                                         // Program.
+               (cl_uint)loc_device.size (),                                                         // Number of devices.
+               loc_device.data (),                                                                  // Device ID list.
+               loc_options.c_str (),                                                                // Compiler options.
+               NULL,                                                                                // Notification routine.
+               NULL                                                                                 // Notification argument.
+              );
+
+  if(loc_error != CL_SUCCESS)                                                                       // Checking compiled program...
+  {
+    error (get_error (loc_error));                                                                  // Printing message...
+
+    // Reading OpenCL compiler error log:
+    clGetProgramBuildInfo (loc_program, loc_device[0], CL_PROGRAM_BUILD_LOG, 0, NULL, &loc_log_size);
+    loc_log.resize (loc_log_size + 1);                                                              // Allocating log buffer...
+    clGetProgramBuildInfo (loc_program, loc_device[0], CL_PROGRAM_BUILD_LOG, loc_log_size + 1, loc_log.data (), NULL);
+
+    std::cout << "" << std::endl;                                                                   // Printing message...
+    std::cout << "See error log:" << std::endl;                                                     // Printing message...
+    std::cout << "" << std::endl;                                                                   // Printing message...
+    std::cout << loc_log << std::endl;                                                              // Printing log...
+    clReleaseProgram (loc_program);                                                                 // Releasing program...
+    return NULL;
+  }
+
+  done ();                                                                                          // Printing message...
+
+  if(!loc_cache_file.empty ())                                                                      // Checking for program cache...
+  {
+    save_program (loc_program, loc_cache_file);                                                     // Saving program to cache...
+  }
+
+  return loc_program;                                                                               // Returning program...
+}
+
+cl_program neutrino::load_il
+(
+ std::vector<std::string> loc_source_file_name,                                                     // Kernel source file names.
+ std::string              loc_options                                                               // Compiler options.
+)
+{
+  cl_program loc_program = NULL;                                                                    // OpenCL program.
+
+  #ifdef CL_VERSION_2_1
+    cl_int             loc_error;                                                                   // Error code.
+    char               loc_version[NU_MAX_TEXT_SIZE];                                               // Device IL version.
+    std::string        loc_file_name;                                                               // SPIR-V module file name.
+    std::string        loc_module;                                                                  // SPIR-V module.
+    std::string        loc_option;                                                                  // Compiler option.
+    std::istringstream loc_option_list (loc_options);                                               // Compiler option list.
+    struct stat        loc_module_status;                                                           // SPIR-V module file status.
+    struct stat        loc_source_status;                                                           // Kernel source file status.
+    size_t             loc_dot;                                                                     // Extension position.
+    size_t             i;                                                                           // Index.
+
+    if(loc_source_file_name.empty ())                                                               // Checking for kernel sources...
+    {
+      return NULL;
+    }
+
+    while(loc_option_list >> loc_option)                                                            // Scanning compiler options...
+    {
+      if((loc_option.rfind ("-D", 0) == 0) || (loc_option.rfind ("-U", 0) == 0) || (loc_option.rfind ("-I", 0) == 0))
+      {
+        return NULL;                                                                                // Preprocessor option, not applicable to a precompiled module...
+      }
+    }
+
+    loc_dot = loc_source_file_name.back ().find_last_of (".");                                      // Getting extension position...
+
+    if((loc_dot == std::string::npos) || (loc_source_file_name.back ().find_first_of ("/\\", loc_dot) != std::string::npos))
+    {
+      loc_dot = loc_source_file_name.back ().size ();                                               // No extension...
+    }
+
+    loc_file_name = loc_source_file_name.back ().substr (0, loc_dot) + NU_IL_EXTENSION;             // Getting SPIR-V module file name...
+
+    if(stat (loc_file_name.c_str (), &loc_module_status) != 0)                                      // Checking SPIR-V module file...
+    {
+      return NULL;                                                                                  // No SPIR-V module...
+    }
+
+    for(i = 0; i < loc_source_file_name.size (); i++)                                               // Scanning kernel sources...
+    {
+      if((stat (loc_source_file_name[i].c_str (), &loc_source_status) == 0) &&
+         (loc_source_status.st_mtime > loc_module_status.st_mtime))                                 // Checking for stale module...
+      {
+        warning ("SPIR-V module " + loc_file_name + " older than its sources, building from source!");
+        return NULL;                                                                                // Stale SPIR-V module...
+      }
+    }
+
+    std::ifstream loc_file (loc_file_name, std::ios::in | std::ios::binary);                        // SPIR-V module file.
+
+    if(!loc_file)                                                                                   // Checking SPIR-V module file...
+    {
+      return NULL;                                                                                  // No SPIR-V module...
+    }
+
+    action ("loading OpenCL program from SPIR-V module...");                                        // Printing message...
+
+    for(i = 0; i < device_list.size (); i++)                                                        // Checking SPIR-V support on all devices...
+    {
+      loc_version[0] = '\0';
+      loc_error      = clGetDeviceInfo (device_list[i], CL_DEVICE_IL_VERSION, sizeof(loc_version), loc_version, NULL);
+
+      if((loc_error != CL_SUCCESS) || (std::string (loc_version).find ("SPIR-V") == std::string::npos))
+      {
+        unfulfilled ();                                                                             // Printing message...
+        return NULL;                                                                                // No SPIR-V support...
+      }
+    }
+
+    loc_file.seekg (0, std::ios::end);
+    loc_module.resize (loc_file.tellg ());
+    loc_file.seekg (0, std::ios::beg);
+    loc_file.read (loc_module.data (), loc_module.size ());
+    loc_file.close ();
+
+    loc_program = clCreateProgramWithIL (context_id, loc_module.data (), loc_module.size (), &loc_error);
+
+    if(loc_error != CL_SUCCESS)                                                                     // Checking for rejected module...
+    {
+      unfulfilled ();                                                                               // Printing message...
+      return NULL;                                                                                  // Rejected module...
+    }
+
+    // Building OpenCL program:
+    loc_error = clBuildProgram
+                (
+                 loc_program,                                                                       // Program.
+                 (cl_uint)device_list.size (),                                                      // Number of devices.
+                 device_list.data (),                                                               // Device ID list.
+                 loc_options.c_str (),                                                              // Compiler options.
+                 NULL,                                                                              // Notification routine.
+                 NULL                                                                               // Notification argument.
+                );
+
+    if(loc_error != CL_SUCCESS)                                                                     // Checking for rejected module...
+    {
+      clReleaseProgram (loc_program);                                                               // Releasing program...
+      unfulfilled ();                                                                               // Printing message...
+      return NULL;                                                                                  // Rejected module...
+    }
+
+    done ();                                                                                        // Printing message...
+  #endif
+
+  return loc_program;                                                                               // Returning program...
+}
+
+void neutrino::save_program
+(
+ cl_program  loc_program,                                                                           // OpenCL program.
+ std::string loc_file_name                                                                          // Cache file name.
+)
+{
+  cl_int         loc_error;                                                                         // Error code.
+  size_t         loc_size;                                                                          // Program binary size.
+  unsigned char* loc_binary;                                                                        // Program binary.
+  std::ofstream  loc_file;                                                                          // Cache file.
+  cl_uint        loc_devices = 0;                                                                   // Number of program devices.
+
+  clGetProgramInfo (loc_program, CL_PROGRAM_NUM_DEVICES, sizeof(cl_uint), &loc_devices, NULL);      // Getting number of program devices...
+
+  if(loc_devices != 1)                                                                              // Checking for multi-device program (single device binaries only)...
+  {
+    return;                                                                                         // Nothing to save...
+  }
+
+  action ("saving OpenCL program to binary cache...");                                              // Printing message...
+
+  // Getting program binary size (single device):
+  loc_error = clGetProgramInfo (loc_program, CL_PROGRAM_BINARY_SIZES, sizeof(size_t), &loc_size, NULL);
+
+  if((loc_error != CL_SUCCESS) || (loc_size == 0))                                                  // Checking binary...
+  {
+    unfulfilled ();                                                                                 // Printing message...
+    return;                                                                                         // Nothing to save...
+  }
+
+  loc_binary = new unsigned char[loc_size];                                                         // Allocating binary buffer...
+
+  // Getting program binary:
+  loc_error  = clGetProgramInfo (loc_program, CL_PROGRAM_BINARIES, sizeof(unsigned char*), &loc_binary, NULL);
+
+  if(loc_error == CL_SUCCESS)
+  {
+    // Writing a temporary file first, not to leave a truncated binary in the cache:
+    loc_file.open (loc_file_name + ".tmp", std::ios::out | std::ios::binary | std::ios::trunc);
+    loc_file.write ((char*)loc_binary, loc_size);
+    loc_file.close ();
+
+    std::remove (loc_file_name.c_str ());                                                           // Removing previous binary...
+    std::rename ((loc_file_name + ".tmp").c_str (), loc_file_name.c_str ());                        // Publishing binary...
+  }
+
+  delete[] loc_binary;                                                                              // Deleting binary buffer...
+
+  if(loc_error == CL_SUCCESS)
+  {
+    done ();                                                                                        // Printing message...
+  }
+
+  else
+  {
+    unfulfilled ();                                                                                 // Printing message...
+  }
+}
+
+cl_event* neutrino::profile
+(
+ cl_event* loc_event                                                                                // OpenCL event.
+)
+{
+  if((profiling != NULL) || (tracing != NULL))                                                      // Checking for profiling or tracing...
+  {
+    return loc_event;                                                                               // Returning event pointer...
+  }
+
+  return NULL;                                                                                      // Returning no event...
+}
+
+void neutrino::record
+(
+ cl_event    loc_event,                                                                             // OpenCL event.
+ std::string loc_name,                                                                              // Profiling entry name.
+ size_t      loc_bytes                                                                              // Transferred data [bytes].
+)
+{
+  if(loc_event == NULL)                                                                             // Checking event...
+  {
+    return;                                                                                         // Nothing to record...
+  }
+
+  if(tracing != NULL)                                                                               // Checking for tracing...
+  {
+    if(profiling != NULL)                                                                           // Checking for profiling...
+    {
+      clRetainEvent (loc_event);                                                                    // Retaining event for the profiler...
+    }
+
+    tracing->record (loc_event, loc_name);                                                          // Handing event to tracer...
+  }
+
+  if(profiling != NULL)                                                                             // Checking for profiling...
+  {
+    profiling->record (loc_event, loc_name, loc_bytes);                                             // Handing event to profiler...
+  }
+
+  if((profiling == NULL) && (tracing == NULL))                                                      // Checking for no consumer...
+  {
+    clReleaseEvent (loc_event);                                                                     // Releasing event...
+  }
+}
+
+cl_ulong neutrino::trace_begin ()
+{
+  if(tracing == NULL)                                                                               // Checking for tracing...
+  {
+    return 0;                                                                                       // Returning null time...
+  }
+
+  return tracing->now ();                                                                           // Returning host time...
+}
+
+void neutrino::trace_end
+(
+ const char* loc_name,                                                                              // Span name.
+ cl_ulong    loc_begin                                                                              // Beginning time, host clock [ns].
+)
+{
+  if(tracing != NULL)                                                                               // Checking for tracing...
+  {
+    tracing->host (loc_name, loc_begin);                                                            // Appending host span...
+  }
+}
+
 void neutrino::check_error
 (
  cl_int loc_error                                                                                   // Error code.
@@ -16,6 +16,9 @@ opencl::opencl()
   properties       = NULL;                                                                          // Initializing platforms' properties...
   context_id       = NULL;                                                                          // Initializing platforms' context...
   device_type      = NU_DEFAULT;                                                                    // Initializing device type...
+  shared_memory    = false;                                                                         // Initializing shared memory flag...
+  quiet            = false;                                                                         // Initializing quiet startup flag...
+  policy           = "";                                                                            // Initializing device selection policy (interactive)...
 }
 
 cl_uint opencl::get_platforms_number ()
@@ -23,7 +26,7 @@ cl_uint opencl::get_platforms_number ()
   cl_int  loc_error;                                                                                // Error code.
   cl_uint loc_platforms_number;                                                                     // Number of platforms.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
 
   // Getting number of existing OpenCL platforms:
   loc_error = clGetPlatformIDs
@@ -47,7 +50,7 @@ cl_platform_id opencl::get_platform_id
   cl_platform_id* loc_platform_id;                                                                  // Platform IDs array.
   cl_platform_id  loc_selected_platform_id;                                                         // Selected platform ID.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
 
   baseline->action ("getting OpenCL platform ID...");                                               // Printing message...
 
@@ -79,7 +82,7 @@ cl_uint opencl::get_devices_number
   cl_int  loc_error;                                                                                // Error code.
   cl_uint loc_devices_number;                                                                       // Number of devices.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
 
   // Getting number of existing OpenCL devices:
   loc_error = clGetDeviceIDs
@@ -106,7 +109,7 @@ cl_device_id opencl::get_device_id
   cl_device_id* loc_device_id;                                                                      // Opencl device ID.
   cl_device_id  loc_selected_device_id;                                                             // OpenCL selected device ID.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
 
   devices_number = get_devices_number (loc_platform_index);                                         // Getting number of existing devices...
   loc_device_id  = new cl_device_id[devices_number];                                                // Allocating platform array...
@@ -133,6 +136,271 @@ cl_device_id opencl::get_device_id
   return(loc_selected_device_id);                                                                   // Returning selected device ID...
 }
 
+double opencl::calibrate
+(
+ cl_uint      loc_platform_index,                                                                   // OpenCL platform index.
+ cl_device_id loc_device_id                                                                         // OpenCL device ID.
+)
+{
+  cl_int                loc_error;                                                                  // Error code.
+  cl_context_properties loc_property[3];                                                            // Calibration context properties.
+  cl_context            loc_context;                                                                // Calibration context.
+  cl_command_queue      loc_queue     = NULL;                                                       // Calibration queue.
+  cl_program            loc_program   = NULL;                                                       // Calibration program.
+  cl_kernel             loc_kernel[2] = {NULL, NULL};                                               // Calibration micro-kernels (bandwidth, FLOP).
+  cl_mem                loc_buffer[2] = {NULL, NULL};                                               // Calibration buffers.
+  cl_event              loc_event;                                                                  // Calibration event.
+  cl_ulong              loc_start;                                                                  // Kernel start time [ns].
+  cl_ulong              loc_end;                                                                    // Kernel end time [ns].
+  size_t                loc_size      = NU_CALIBRATION_SIZE;                                        // Calibration micro-kernel size [#].
+  double                loc_time[2]   = {0.0, 0.0};                                                 // Best micro-kernel times [ns].
+  double                loc_bandwidth = 0.0;                                                        // Memory bandwidth [GB/s].
+  double                loc_flops     = 0.0;                                                        // Arithmetic throughput [GFLOP/s].
+  std::string           loc_file_name;                                                              // Calibration cache file name.
+  char                  loc_text[NU_MAX_TEXT_SIZE];                                                 // Calibration scores text.
+  std::ifstream         loc_input;                                                                  // Calibration cache input file.
+  std::ofstream         loc_output;                                                                 // Calibration cache output file.
+  size_t                i;                                                                          // Index.
+  size_t                r;                                                                          // Run index.
+
+  // Calibration micro-kernels (float4 copy and dependent multiply-add chain):
+  const char*           loc_source =
+    "__kernel void nu_bandwidth (__global const float4* a, __global float4* b)\n"
+    "{\n"
+    "  b[get_global_id (0)] = a[get_global_id (0)];\n"
+    "}\n"
+    "__kernel void nu_flops (__global float4* a)\n"
+    "{\n"
+    "  float4 x = a[get_global_id (0)];\n"
+    "  float4 y = x;\n"
+    "  for(int k = 0; k < 64; k++)\n"
+    "  {\n"
+    "    x = mad (x, y, (float4)(0.5f));\n"
+    "    y = mad (y, x, (float4)(0.5f));\n"
+    "  }\n"
+    "  a[get_global_id (0)] = x + y;\n"
+    "}\n";
+
+  if(baseline->cache && !baseline->cache_home.empty ())                                             // Checking for calibration cache...
+  {
+    // Getting calibration cache file name (per platform, device and driver):
+    loc_file_name = baseline->cache_file
+                    (
+                     baseline->cache_home,                                                          // Cache home directory.
+                     "calibration" + opencl_platform[loc_platform_index]->name,                     // Cache key.
+                     NU_CALIBRATION_EXTENSION,                                                      // Cache file extension.
+                     loc_device_id                                                                  // Device ID.
+                    );
+    loc_input.open (loc_file_name);                                                                 // Opening cache file...
+
+    if(loc_input >> loc_bandwidth >> loc_flops)                                                     // Reading cached scores...
+    {
+      loc_input.close ();                                                                           // Closing cache file...
+      snprintf (loc_text, sizeof(loc_text), "%.1f GB/s, %.1f GFLOP/s", loc_bandwidth, loc_flops);
+      baseline->action ("reading cached device calibration (" + std::string (loc_text) + ")...");   // Printing message...
+      baseline->done ();                                                                            // Printing message...
+
+      return sqrt (loc_bandwidth*loc_flops);                                                        // Returning cached score...
+    }
+  }
+
+  baseline->action ("calibrating device...");                                                       // Printing message...
+
+  loc_property[0] = CL_CONTEXT_PLATFORM;                                                            // Setting calibration context platform...
+  loc_property[1] = (cl_context_properties)opencl_platform[loc_platform_index]->id;
+  loc_property[2] = 0;
+
+  loc_context = clCreateContext (loc_property, 1, &loc_device_id, NULL, NULL, &loc_error);
+
+  if(loc_error != CL_SUCCESS)                                                                       // Checking for unusable device...
+  {
+    baseline->unfulfilled ();                                                                       // Printing message...
+    return 0.0;                                                                                     // Returning null score...
+  }
+
+  loc_queue   = clCreateCommandQueue (loc_context, loc_device_id, CL_QUEUE_PROFILING_ENABLE, &loc_error);
+  loc_program = clCreateProgramWithSource (loc_context, 1, &loc_source, NULL, &loc_error);
+
+  if((loc_error == CL_SUCCESS) &&
+     (clBuildProgram (loc_program, 1, &loc_device_id, NULL, NULL, NULL) == CL_SUCCESS))             // Building micro-kernels...
+  {
+    loc_kernel[0] = clCreateKernel (loc_program, "nu_bandwidth", &loc_error);                       // Creating bandwidth micro-kernel...
+    loc_kernel[1] = clCreateKernel (loc_program, "nu_flops", &loc_error);                           // Creating FLOP micro-kernel...
+  }
+
+  for(i = 0; i < 2; i++)                                                                            // Creating calibration buffers...
+  {
+    loc_buffer[i] = clCreateBuffer (loc_context, CL_MEM_READ_WRITE, loc_size*sizeof(cl_float4), NULL, &loc_error);
+  }
+
+  if((loc_kernel[0] != NULL) && (loc_kernel[1] != NULL) && (loc_buffer[0] != NULL) && (loc_buffer[1] != NULL))
+  {
+    clSetKernelArg (loc_kernel[0], 0, sizeof(cl_mem), &loc_buffer[0]);                              // Setting bandwidth source...
+    clSetKernelArg (loc_kernel[0], 1, sizeof(cl_mem), &loc_buffer[1]);                              // Setting bandwidth destination...
+    clSetKernelArg (loc_kernel[1], 0, sizeof(cl_mem), &loc_buffer[1]);                              // Setting FLOP data...
+
+    for(i = 0; i < 2; i++)                                                                          // Scanning micro-kernels...
+    {
+      for(r = 0; r <= NU_CALIBRATION_RUNS; r++)                                                     // Running micro-kernel (1st run = warm-up)...
+      {
+        loc_error = clEnqueueNDRangeKernel (loc_queue, loc_kernel[i], 1, NULL, &loc_size, NULL, 0, NULL, &loc_event);
+
+        if(loc_error != CL_SUCCESS)                                                                 // Checking for rejected launch...
+        {
+          break;
+        }
+
+        clWaitForEvents (1, &loc_event);                                                            // Waiting for micro-kernel...
+        clGetEventProfilingInfo (loc_event, CL_PROFILING_COMMAND_START, sizeof(cl_ulong), &loc_start, NULL);
+        clGetEventProfilingInfo (loc_event, CL_PROFILING_COMMAND_END, sizeof(cl_ulong), &loc_end, NULL);
+        clReleaseEvent (loc_event);                                                                 // Releasing event...
+
+        if((r > 0) && (loc_end > loc_start) && ((loc_time[i] == 0.0) || ((double)(loc_end - loc_start) < loc_time[i])))
+        {
+          loc_time[i] = (double)(loc_end - loc_start);                                              // Keeping best time...
+        }
+      }
+    }
+  }
+
+  if((loc_time[0] > 0.0) && (loc_time[1] > 0.0))                                                    // Checking for valid measurements...
+  {
+    loc_bandwidth = 2.0*sizeof(cl_float4)*loc_size/loc_time[0];                                     // Getting memory bandwidth (read + write) [GB/s]...
+    loc_flops     = 1024.0*loc_size/loc_time[1];                                                    // Getting arithmetic throughput (64 x 2 x 4 multiply-adds) [GFLOP/s]...
+  }
+
+  for(i = 0; i < 2; i++)                                                                            // Releasing calibration micro-kernels and buffers...
+  {
+    if(loc_kernel[i] != NULL)
+    {
+      clReleaseKernel (loc_kernel[i]);                                                              // Releasing micro-kernel...
+    }
+
+    if(loc_buffer[i] != NULL)
+    {
+      clReleaseMemObject (loc_buffer[i]);                                                           // Releasing buffer...
+    }
+  }
+
+  if(loc_program != NULL)
+  {
+    clReleaseProgram (loc_program);                                                                 // Releasing calibration program...
+  }
+
+  if(loc_queue != NULL)
+  {
+    clReleaseCommandQueue (loc_queue);                                                              // Releasing calibration queue...
+  }
+
+  clReleaseContext (loc_context);                                                                   // Releasing calibration context...
+
+  if(loc_bandwidth == 0.0)                                                                          // Checking for valid measurements...
+  {
+    baseline->unfulfilled ();                                                                       // Printing message...
+    return 0.0;                                                                                     // Returning null score...
+  }
+
+  baseline->done ();                                                                                // Printing message...
+
+  if(!loc_file_name.empty ())                                                                       // Checking for calibration cache...
+  {
+    loc_output.open (loc_file_name);                                                                // Opening cache file...
+    loc_output << loc_bandwidth << " " << loc_flops << std::endl;                                   // Writing scores...
+    loc_output.close ();                                                                            // Closing cache file...
+  }
+
+  snprintf (loc_text, sizeof(loc_text), "%.1f GB/s, %.1f GFLOP/s", loc_bandwidth, loc_flops);
+  baseline->action ("device calibration: " + std::string (loc_text) + "...");                       // Printing message...
+  baseline->done ();                                                                                // Printing message...
+
+  return sqrt (loc_bandwidth*loc_flops);                                                            // Returning score (geometric mean)...
+}
+
+cl_uint opencl::choose
+(
+ std::string loc_policy                                                                             // Device selection policy.
+)
+{
+  cl_int                    loc_error;                                                              // Error code.
+  cl_uint                   loc_number;                                                             // Number of devices on platform [#].
+  std::vector<cl_device_id> loc_device_id;                                                          // Device IDs on platform.
+  char                      loc_text[NU_MAX_PATH_SIZE];                                             // Device information text.
+  cl_bool                   loc_available;                                                          // Device availability.
+  cl_device_type            loc_type;                                                               // Device type.
+  std::string               loc_description;                                                        // Device description (name, vendor and type).
+  std::string               loc_pattern;                                                            // Selection pattern (lower case).
+  double                    loc_score;                                                              // Device score.
+  double                    loc_best = -1.0;                                                        // Best device score.
+  cl_uint                   loc_selected = 0;                                                       // Selected device index.
+  cl_uint                   p;                                                                      // Platform index.
+  cl_uint                   i;                                                                      // Device index.
+
+  loc_pattern = loc_policy;
+  std::transform (loc_pattern.begin (), loc_pattern.end (), loc_pattern.begin (), ::tolower);       // Getting lower case pattern...
+
+  std::cout << "        DEVICE SELECTION POLICY: " << loc_policy << std::endl;                      // Printing message...
+
+  for(p = 0; p < platforms_number; p++)                                                             // Scanning platforms...
+  {
+    loc_number = 0;                                                                                 // Resetting number of devices...
+    loc_error  = clGetDeviceIDs (opencl_platform[p]->id, device_type, 0, NULL, &loc_number);
+
+    if((loc_error != CL_SUCCESS) || (loc_number == 0))                                              // Checking for devices of the requested type...
+    {
+      continue;
+    }
+
+    loc_device_id.resize (loc_number);                                                              // Allocating device IDs...
+    clGetDeviceIDs (opencl_platform[p]->id, device_type, loc_number, loc_device_id.data (), NULL);
+
+    for(i = 0; i < loc_number; i++)                                                                 // Scanning devices...
+    {
+      loc_text[0]   = '\0';
+      loc_available = CL_FALSE;
+      loc_type      = 0;
+      clGetDeviceInfo (loc_device_id[i], CL_DEVICE_AVAILABLE, sizeof(cl_bool), &loc_available, NULL);
+      clGetDeviceInfo (loc_device_id[i], CL_DEVICE_TYPE, sizeof(cl_device_type), &loc_type, NULL);
+      clGetDeviceInfo (loc_device_id[i], CL_DEVICE_NAME, sizeof(loc_text), loc_text, NULL);
+      loc_description = std::string (loc_text) + " ";
+      clGetDeviceInfo (loc_device_id[i], CL_DEVICE_VENDOR, sizeof(loc_text), loc_text, NULL);
+      loc_description += std::string (loc_text) + " ";
+      loc_description += (loc_type & CL_DEVICE_TYPE_CPU) ? "cpu" : (loc_type & CL_DEVICE_TYPE_GPU) ? "gpu" : "accelerator";
+
+      if(!loc_available)                                                                            // Checking for available device...
+      {
+        continue;
+      }
+
+      std::cout << "        PLATFORM #" << (p + 1) << ", DEVICE #" << (i + 1) << ": " << loc_description << std::endl;
+      std::transform (loc_description.begin (), loc_description.end (), loc_description.begin (), ::tolower);
+
+      if(loc_pattern == NU_POLICY_FASTEST)                                                          // Checking for fastest device policy...
+      {
+        loc_score = calibrate (p, loc_device_id[i]);                                                // Getting calibration score...
+      }
+      else
+      {
+        loc_score = (loc_description.find (loc_pattern) != std::string::npos) ? 1.0 : 0.0;          // Matching pattern...
+      }
+
+      if((loc_score > 0.0) && (loc_score > loc_best))                                               // Keeping best (or first matching) device...
+      {
+        loc_best          = loc_score;
+        selected_platform = p;
+        loc_selected      = i;
+      }
+    }
+  }
+
+  if(loc_best <= 0.0)                                                                               // Checking for selected device...
+  {
+    baseline->error ("no OpenCL device fulfils the selection policy \"" + loc_policy + "\"!");      // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  return loc_selected;                                                                              // Returning selected device index...
+}
+
 void opencl::init
 (
  neutrino*           loc_baseline,                                                                  // Neutrino baseline.
@@ -140,16 +408,58 @@ void opencl::init
  compute_device_type loc_device_type                                                                // OpenCL device type.
 )
 {
-  cl_int  loc_error;                                                                                // Error code.
-  cl_uint i;                                                                                        // Index.
-  bool    loc_platform_interop = false;                                                             // Platform interoperability flag.
-  bool    loc_device_interop   = false;                                                             // Device interoperability flag.
+  setup (loc_baseline, loc_gui, loc_device_type, false, NU_PARTITION_NONE, 0);                      // Initializing OpenCL on the selected device...
+}
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+void opencl::init
+(
+ neutrino*           loc_baseline,                                                                  // Neutrino baseline.
+ opengl*             loc_gui,                                                                       // OpenGL gui.
+ compute_device_type loc_device_type,                                                               // OpenCL device type.
+ bool                loc_multi_device                                                               // Multi-device flag.
+)
+{
+  setup (loc_baseline, loc_gui, loc_device_type, loc_multi_device, NU_PARTITION_NONE, 0);           // Initializing OpenCL...
+}
+
+void opencl::init
+(
+ neutrino*           loc_baseline,                                                                  // Neutrino baseline.
+ opengl*             loc_gui,                                                                       // OpenGL gui.
+ compute_device_type loc_device_type,                                                               // OpenCL device type.
+ device_partition    loc_partition,                                                                 // Device partition.
+ cl_uint             loc_units                                                                      // Compute units per sub-device (NU_PARTITION_EQUALLY) [#].
+)
+{
+  setup (loc_baseline, loc_gui, loc_device_type, false, loc_partition, loc_units);                  // Initializing OpenCL on the sub-devices of the selected device...
+}
+
+void opencl::setup
+(
+ neutrino*           loc_baseline,                                                                  // Neutrino baseline.
+ opengl*             loc_gui,                                                                       // OpenGL gui.
+ compute_device_type loc_device_type,                                                               // OpenCL device type.
+ bool                loc_multi_device,                                                              // Multi-device flag.
+ device_partition    loc_partition,                                                                 // Device partition.
+ cl_uint             loc_units                                                                      // Compute units per sub-device (NU_PARTITION_EQUALLY) [#].
+)
+{
+  cl_int      loc_error;                                                                            // Error code.
+  cl_uint     i;                                                                                    // Index.
+  bool        loc_platform_interop = false;                                                         // Platform interoperability flag.
+  bool        loc_device_interop   = false;                                                         // Device interoperability flag.
+  cl_uint     loc_compute_units    = 1;                                                             // Device compute units [#].
+  cl_uint     loc_clock            = 1;                                                             // Device clock frequency [MHz].
+  cl_uint     loc_choice           = 0;                                                             // Device chosen by the selection policy.
+  std::string loc_policy           = policy;                                                        // Device selection policy.
+
+  baseline           = loc_baseline;                                                                // Getting Neutrino baseline...
+  baseline->headless = (loc_gui == NULL);                                                           // Setting headless (compute-only) mode...
+
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
 
   baseline->action ("initializing OpenCL...");                                                      // Printing message...
 
-  baseline         = loc_baseline;                                                                  // Getting Neutrino baseline...
   device_type_text = new char[NU_MAX_TEXT_SIZE]();                                                  // Device type text [string].
 
   ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -199,7 +509,12 @@ void opencl::init
   for(i = 0; i < platforms_number; i++)                                                             // Checking all platforms:
   {
     opencl_platform[i] = new platform ();
-    opencl_platform[i]->init (get_platform_id (i));
+    opencl_platform[i]->init (baseline, get_platform_id (i));                                       // Initializing OpenCL platform...
+
+    if(quiet)                                                                                       // Checking for quiet startup...
+    {
+      continue;                                                                                     // Skipping platform listing...
+    }
 
     std::cout << "        PLATFORM #: " +
       std::to_string (i + 1) << std::endl;                                                          // Printing message...
@@ -221,12 +536,22 @@ void opencl::init
                    );
   }
 
+  if(getenv (NU_DEVICE_POLICY) != NULL)                                                             // Checking for device selection policy environment variable...
+  {
+    loc_policy = getenv (NU_DEVICE_POLICY);                                                         // Overriding device selection policy...
+  }
+
   if(platforms_number == 1)
   {
     selected_platform = 0;                                                                          // Setting 1st platform, in case it is the only found one...
   }
 
-  if (platforms_number > 1)                                                                         // Asking to select a platform...
+  if(!loc_policy.empty ())                                                                          // Checking for device selection policy...
+  {
+    loc_choice = choose (loc_policy);                                                               // Choosing platform and device, without asking...
+  }
+
+  if ((platforms_number > 1) && loc_policy.empty ())                                                // Asking to select a platform...
   {
       std::cout << "Action: please select a platform [1..." + std::to_string(platforms_number);     // Formulating query...
 
@@ -261,7 +586,14 @@ void opencl::init
   for(i = 0; i < devices_number; i++)                                                               // Checking all devices:
   {
     opencl_device[i] = new device ();
-    opencl_device[i]->init (get_device_id (i, selected_platform));                                  // Initializing OpenCL device...
+    opencl_device[i]->init (baseline, get_device_id (i, selected_platform));                        // Initializing OpenCL device...
+
+    if(quiet)                                                                                       // Checking for quiet startup...
+    {
+      continue;                                                                                     // Skipping device listing...
+    }
+
+    opencl_device[i]->query ();                                                                     // Getting detailed properties (for listing)...
 
     std::cout << "        DEVICE #: ";
     std::cout << std::to_string (i + 1) << std::endl;                                               // Printing message...
@@ -430,7 +762,17 @@ void opencl::init
     selected_device = 0;                                                                             // Setting 1st device, in case it is the only found one...
   }
 
-  if(devices_number > 1)                                                                            // Asking to select a platform...
+  if((devices_number > 1) && loc_multi_device)                                                      // Using all devices...
+  {
+    selected_device = 0;                                                                            // Setting 1st device as the primary one...
+  }
+
+  if(!loc_policy.empty ())                                                                          // Checking for device selection policy...
+  {
+    selected_device = loc_choice;                                                                   // Setting device chosen by the selection policy...
+  }
+
+  if((devices_number > 1) && !loc_multi_device && loc_policy.empty ())                              // Asking to select a device...
   {
     std::cout << "Action: please select a device [1..." +
       std::to_string (devices_number);                                                              // Formulating query...
@@ -453,7 +795,8 @@ void opencl::init
       loc_device_interop = false;                                                                   // Resetting device interoperability flag...
   }
 
-  if(loc_platform_interop && loc_device_interop)                                                    // Evaluating interoperability flag...
+  if(loc_platform_interop && loc_device_interop && !baseline->headless && !loc_multi_device &&
+     (loc_partition == NU_PARTITION_NONE))                                                          // Evaluating interoperability flag...
   {
     baseline->interop = true;                                                                       // Setting interoperability flag...
   }
@@ -466,14 +809,33 @@ void opencl::init
   // It looks it works also when interop = false.
   // baseline->interop   = false;
 
+  opencl_device[selected_device]->query ();                                                         // Getting detailed properties of the selected device...
   baseline->device_id = opencl_device[selected_device]->id;                                         // Setting neutrino OpenCL device ID...
+  baseline->device_list.clear ();                                                                   // Resetting context device list...
+  baseline->device_list.push_back (baseline->device_id);                                            // Setting primary device...
+
+  for(i = 0; (i < devices_number) && loc_multi_device; i++)                                         // Adding all other devices (multi-device mode)...
+  {
+    if((i != selected_device) && opencl_device[i]->available)                                       // Checking for available device...
+    {
+      baseline->device_list.push_back (opencl_device[i]->id);                                       // Adding device...
+    }
+  }
+
+  if((loc_partition != NU_PARTITION_NONE) &&
+     (opencl_device[selected_device]->partition (loc_partition, loc_units) > 1))                    // Partitioning selected device...
+  {
+    baseline->device_list = opencl_device[selected_device]->sub_device;                             // Setting sub-devices as context devices...
+    baseline->device_id   = baseline->device_list[0];                                               // Setting 1st sub-device as the primary one...
+    shared_memory         = true;                                                                   // Setting shared memory flag (sub-devices of the same device)...
+  }
 
   ////////////////////////////////////////////////////////////////////////////////////////////////////
   ////////////////////////////////////////// IDENTIFYING OS //////////////////////////////////////////
   ////////////////////////////////////////////////////////////////////////////////////////////////////
   baseline->action ("identifying operating system...");                                             // Printing message...
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
 
   #ifdef __APPLE__                                                                                  // Checking for APPLE system...
     baseline->done ();
@@ -494,9 +856,17 @@ void opencl::init
     }
     else
     {
-      baseline->warning ("could not find OpenCL/GL interoperability!");                             // Printing message...
-      baseline->unfulfilled ();                                                                     // Printing message...
-      baseline->action ("switching to non-interoperability modality...");                           // Printing message...
+      if(baseline->headless)                                                                        // Checking for headless mode...
+      {
+        baseline->done ();                                                                          // Printing message...
+        baseline->action ("switching to headless (compute-only) modality...");                      // Printing message...
+      }
+      else
+      {
+        baseline->warning ("could not find OpenCL/GL interoperability!");                           // Printing message...
+        baseline->unfulfilled ();                                                                   // Printing message...
+        baseline->action ("switching to non-interoperability modality...");                         // Printing message...
+      }
 
       properties[0] = CL_CONTEXT_PLATFORM;                                                          // Setting APPLE without CL-GL interop...
       properties[1] = (cl_context_properties)baseline->platform_id;
@@ -530,9 +900,17 @@ void opencl::init
     }
     else
     {
-      baseline->warning ("could not find OpenCL/GL interoperability!");                             // Printing message...
-      baseline->unfulfilled ();                                                                     // Printing message...
-      baseline->action ("switching to non-interoperability modality...");                           // Printing message...
+      if(baseline->headless)                                                                        // Checking for headless mode...
+      {
+        baseline->done ();                                                                          // Printing message...
+        baseline->action ("switching to headless (compute-only) modality...");                      // Printing message...
+      }
+      else
+      {
+        baseline->warning ("could not find OpenCL/GL interoperability!");                           // Printing message...
+        baseline->unfulfilled ();                                                                   // Printing message...
+        baseline->action ("switching to non-interoperability modality...");                         // Printing message...
+      }
 
       properties[0] = CL_CONTEXT_PLATFORM;                                                          // Setting LINUX without CL-GL interop...
       properties[1] = (cl_context_properties)baseline->platform_id;
@@ -572,9 +950,17 @@ void opencl::init
     }
     else
     {
-      baseline->warning ("could not find OpenCL/GL interoperability!");                             // Printing message...
-      baseline->unfulfilled ();                                                                     // Printing message...
-      baseline->action ("switching to non-interoperability modality...");                           // Printing message...
+      if(baseline->headless)                                                                        // Checking for headless mode...
+      {
+        baseline->done ();                                                                          // Printing message...
+        baseline->action ("switching to headless (compute-only) modality...");                      // Printing message...
+      }
+      else
+      {
+        baseline->warning ("could not find OpenCL/GL interoperability!");                           // Printing message...
+        baseline->unfulfilled ();                                                                   // Printing message...
+        baseline->action ("switching to non-interoperability modality...");                         // Printing message...
+      }
 
       properties[0] = CL_CONTEXT_PLATFORM;                                                          // Setting WINDOWS without CL-GL interop...
       properties[1] = (cl_context_properties)baseline->platform_id;
@@ -592,8 +978,8 @@ void opencl::init
   context_id = clCreateContext
                (
                 properties,                                                                         // Context properties.
-                1,                                                                                  // Number of devices on selected platform.
-                &opencl_device[selected_device]->id,                                                // Pointer to the selected device on selected platform.
+                (cl_uint)baseline->device_list.size (),                                             // Number of devices on selected platform.
+                baseline->device_list.data (),                                                      // Pointer to the selected devices on selected platform.
                 NULL,                                                                               // Context error report callback function.
                 NULL,                                                                               // Context error report callback function argument.
                 &loc_error                                                                          // Error code.
@@ -603,86 +989,714 @@ void opencl::init
   baseline->context_id = context_id;                                                                // Setting neutrino OpenCL context ID...
 
   baseline->done ();                                                                                // Printing message...
+
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  ////////////////////////////////////// CREATING DEVICE QUEUES //////////////////////////////////////
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  device_queue.assign (baseline->device_list.size (), NULL);                                        // Resetting device queues...
+  device_weight.assign (baseline->device_list.size (), 1.0);                                        // Resetting device weights...
+  device_rate.assign (baseline->device_list.size (), 0.0);                                          // Resetting measured device throughputs...
+
+  for(i = 0; (i < baseline->device_list.size ()) && (baseline->device_list.size () > 1); i++)       // Scanning context devices...
+  {
+    // Getting device nominal throughput (compute units times clock frequency):
+    clGetDeviceInfo (baseline->device_list[i], CL_DEVICE_MAX_COMPUTE_UNITS, sizeof(cl_uint), &loc_compute_units, NULL);
+    clGetDeviceInfo (baseline->device_list[i], CL_DEVICE_MAX_CLOCK_FREQUENCY, sizeof(cl_uint), &loc_clock, NULL);
+    device_weight[i] = (double)loc_compute_units*(double)loc_clock;                                 // Setting device weight...
+
+    if(i > 0)                                                                                       // Checking for secondary device (the primary one uses the application queue)...
+    {
+      device_queue[i] = new queue ();                                                               // Creating device queue...
+      device_queue[i]->init (baseline, baseline->device_list[i]);                                   // Initializing device queue...
+    }
+  }
+
+  baseline->placement.clear ();                                                                     // Resetting placement shares...
+
+  for(i = 0; (i < device_weight.size ()) && shared_memory && (loc_partition == NU_PARTITION_NUMA); i++)
+  {
+    // Setting NUMA placement share (nominal weight of the sub-device):
+    baseline->placement.push_back (device_weight[i]/std::accumulate (device_weight.begin (), device_weight.end (), 0.0));
+  }
 }
 
-void opencl::execute
+cl_int opencl::launch
 (
- kernel*     loc_kernel,                                                                            // OpenCL kernel.
- queue*      loc_queue,                                                                             // OpenCL queue.
- kernel_mode loc_kernel_mode                                                                        // Kernel mode.
+ kernel*   loc_kernel,                                                                              // OpenCL kernel.
+ queue*    loc_queue,                                                                               // OpenCL queue.
+ cl_event* loc_event                                                                                // Kernel event (NULL = none).
+)
+{
+  return launch (loc_kernel, loc_queue, loc_event, 0, 0);                                           // Enqueueing whole range...
+}
+
+cl_int opencl::launch
+(
+ kernel*   loc_kernel,                                                                              // OpenCL kernel.
+ queue*    loc_queue,                                                                               // OpenCL queue.
+ cl_event* loc_event,                                                                               // Kernel event (NULL = none).
+ size_t    loc_offset,                                                                              // Global offset along the last dimension [#].
+ size_t    loc_count                                                                                // Global size along the last dimension (0 = whole range) [#].
 )
 {
-  cl_int  loc_error;                                                                                // Error code.
   cl_uint kernel_dimension;                                                                         // Kernel dimension.
-  size_t* kernel_size;                                                                              // Kernel size array.
-  bool    kernel_valid = false;                                                                     // Validity flag.
+  size_t  kernel_size[3];                                                                           // Kernel size array.
+  size_t  kernel_local[3];                                                                          // Kernel local size array.
+  size_t  kernel_offset[3] = {0, 0, 0};                                                             // Kernel global offset array.
+
+  loc_kernel->reload ();                                                                            // Swapping in hot reloaded kernel, if any...
+  kernel_dimension = loc_kernel->get_size (kernel_size, kernel_local);                              // Getting kernel size...
+
+  if(loc_count > 0)                                                                                 // Checking for chunk...
+  {
+    kernel_offset[kernel_dimension - 1] = loc_offset;                                               // Setting chunk offset...
+    kernel_size[kernel_dimension - 1]   = loc_count;                                                // Setting chunk size...
+  }
+
+  // Enqueueing OpenCL kernel:
+  return clEnqueueNDRangeKernel
+         (
+          loc_queue->queue_id,                                                                      // Queue ID.
+          loc_kernel->kernel_id,                                                                    // Kernel ID.
+          kernel_dimension,                                                                         // Kernel dimension.
+          (loc_count > 0) ? kernel_offset : NULL,                                                   // Global work offset.
+          kernel_size,                                                                              // Global work size.
+          (loc_kernel->local_i > 0) ? kernel_local : NULL,                                          // Local work size.
+          0,                                                                                        // Number of events.
+          NULL,                                                                                     // Event list.
+          loc_event                                                                                 // Event.
+         );
+}
+
+cl_int opencl::spread
+(
+ kernel*   loc_kernel,                                                                              // OpenCL kernel.
+ queue*    loc_queue,                                                                               // OpenCL queue (primary device).
+ cl_event* loc_event                                                                                // Completion event.
+)
+{
+  cl_int                   loc_error;                                                               // Error code.
+  cl_uint                  kernel_dimension;                                                        // Kernel dimension.
+  size_t                   kernel_size[3];                                                          // Kernel size array.
+  size_t                   kernel_local[3];                                                         // Kernel local size array.
+  size_t                   kernel_offset[3] = {0, 0, 0};                                            // Kernel global offset array.
+  size_t                   loc_devices = device_queue.size ();                                      // Number of devices [#].
+  size_t                   loc_total;                                                               // Global size along the last dimension [#].
+  size_t                   loc_actual;                                                              // Kernel size along the last dimension [#].
+  size_t                   loc_unit;                                                                // Partition granularity [#].
+  size_t                   loc_replica_bytes;                                                       // Replica buffer size [bytes].
+  size_t                   loc_begin;                                                               // Partition beginning [bytes].
+  size_t                   loc_length;                                                              // Partition length [bytes].
+  double                   loc_sum = 0.0;                                                           // Weight sum.
+  bool                     loc_measured = true;                                                     // Measured throughputs flag.
+  bool                     loc_split    = true;                                                     // Partitionable outputs flag.
+  std::vector<double>      loc_weight (loc_devices);                                                // Device weights.
+  std::vector<size_t>      loc_offset (loc_devices, 0);                                             // Partition offsets [#].
+  std::vector<size_t>      loc_count (loc_devices, 0);                                              // Partition sizes [#].
+  std::vector<cl_event>    loc_launch (loc_devices, NULL);                                          // Partition events.
+  cl_event                 loc_ready    = NULL;                                                     // Primary queue marker (inputs ready).
+  std::vector<cl_event>    loc_wait;                                                                // Partition wait list.
+  cl_event                 loc_previous = NULL;                                                     // Previous partition event (shared memory).
+  std::vector<cl_kernel>   loc_kernel_id (loc_devices, NULL);                                       // Device kernels.
+  std::vector<output_structure> loc_output;                                                         // Kernel output buffers.
+  std::vector<size_t>      loc_bytes;                                                               // Output buffer sizes [bytes].
+  std::map<cl_mem, cl_mem> loc_buffer;                                                              // Device replica buffers.
+  cl_command_queue         loc_queue_id;                                                            // Device queue.
+  std::string              loc_name;                                                                // Profiling entry name.
+  size_t                   d;                                                                       // Device index.
+  size_t                   i;                                                                       // Index.
+
+  collect (false);                                                                                  // Reading the timing of the previous partitions, if completed...
+
+  loc_kernel->reload ();                                                                            // Swapping in hot reloaded kernel, if any...
+  kernel_dimension = loc_kernel->get_size (kernel_size, kernel_local);                              // Getting kernel size...
+  loc_total        = kernel_size[kernel_dimension - 1];                                             // Getting global size along the last dimension...
+  loc_actual       = (kernel_dimension == 1) ? loc_kernel->size_i :
+                     (kernel_dimension == 2) ? loc_kernel->size_j : loc_kernel->size_k;             // Getting kernel size along the last dimension...
+  loc_unit         = (loc_kernel->local_i > 0) ? kernel_local[kernel_dimension - 1] : 1;            // Getting partition granularity...
+
+  if(!shared_memory)                                                                                // Checking for replicated memory...
+  {
+    loc_output = loc_kernel->output ();                                                             // Getting output buffers...
+    loc_bytes.resize (loc_output.size ());                                                          // Resizing output buffer size array...
+
+    for(i = 0; i < loc_output.size (); i++)                                                         // Getting output layouts along the last dimension...
+    {
+      clGetMemObjectInfo (loc_output[i].buffer, CL_MEM_SIZE, sizeof(size_t), &loc_bytes[i], NULL);  // Getting buffer size...
+
+      if((loc_output[i].row == 0) && ((loc_bytes[i] % loc_actual) == 0))                            // Checking for derived layout...
+      {
+        loc_output[i].row = loc_bytes[i]/loc_actual;                                                // Getting buffer size per index along the last dimension...
+      }
+
+      loc_split = loc_split && (loc_output[i].row > 0);                                             // Checking for partitionable buffer...
+    }
+  }
+
+  if(!loc_split && (std::find (unpartitioned.begin (), unpartitioned.end (), loc_kernel) == unpartitioned.end ()))
+  {
+    baseline->warning ("output buffer not partitionable along the last kernel dimension, running on the primary device only!");
+    unpartitioned.push_back (loc_kernel);                                                           // Warning only once per kernel...
+  }
+
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  ////////////////////////////////////// PARTITIONING THE RANGE //////////////////////////////////////
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  for(d = 0; d < loc_devices; d++)                                                                  // Checking for measured throughputs...
+  {
+    loc_measured = loc_measured && (device_rate[d] > 0.0);
+  }
+
+  loc_measured = loc_measured && baseline->placement.empty ();                                      // Keeping the partitions on the NUMA placed pages...
+
+  for(d = 0; d < loc_devices; d++)                                                                  // Getting device weights...
+  {
+    loc_weight[d] = loc_measured ? device_rate[d] : device_weight[d];                               // Using nominal weights until all devices are measured...
+    loc_sum      += loc_weight[d];                                                                  // Accumulating weights...
+  }
+
+  for(d = 0; d < loc_devices; d++)                                                                  // Partitioning the range proportionally to device weights...
+  {
+    loc_offset[d] = (d == 0) ? 0 : (loc_offset[d - 1] + loc_count[d - 1]);                          // Setting partition offset...
+
+    if(d == (loc_devices - 1))                                                                      // Checking for last device...
+    {
+      loc_count[d] = loc_total - loc_offset[d];                                                     // Taking the rest of the range...
+    }
+
+    else
+    {
+      loc_count[d] = (size_t)(loc_total*loc_weight[d]/loc_sum/loc_unit + 0.5)*loc_unit;             // Rounding to the local size...
+      loc_count[d] = std::min (loc_count[d], loc_total - loc_offset[d]);                            // Clipping to the range...
+    }
+
+    if(!loc_split)                                                                                  // Checking for partitionable outputs...
+    {
+      loc_offset[d] = 0;                                                                            // Resetting partition offset...
+      loc_count[d]  = (d == 0) ? loc_total : 0;                                                     // Running the whole range on the primary device...
+    }
+  }
+
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  //////////////////////////////////// REPLICATING OUTPUT BUFFERS ////////////////////////////////////
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  // Marking the previous commands of the primary queue (the secondary devices read their results):
+  loc_error = clEnqueueMarkerWithWaitList (loc_queue->queue_id, 0, NULL, &loc_ready);
+  baseline->check_error (loc_error);                                                                // Checking error...
+
+  for(d = 0; d < loc_devices; d++)                                                                  // Scanning devices...
+  {
+    loc_kernel_id[d] = loc_kernel->kernel_id;                                                       // Setting device kernel (sub-devices write the original buffers in place)...
+  }
+
+  for(d = 1; (d < loc_devices) && !shared_memory; d++)                                              // Scanning secondary devices...
+  {
+    if(loc_count[d] == 0)                                                                           // Checking for partition...
+    {
+      continue;
+    }
+
+    loc_buffer.clear ();                                                                            // Resetting replica buffer map...
+
+    for(i = 0; i < loc_output.size (); i++)                                                         // Scanning output buffers...
+    {
+      if(replica[loc_output[i].buffer].size () != loc_devices)                                      // Checking replica array...
+      {
+        replica[loc_output[i].buffer].resize (loc_devices, NULL);                                   // Resizing replica array...
+      }
+
+      if(replica[loc_output[i].buffer][d] != NULL)                                                  // Checking for existing replica...
+      {
+        clGetMemObjectInfo (replica[loc_output[i].buffer][d], CL_MEM_SIZE, sizeof(size_t), &loc_replica_bytes, NULL);
+
+        if(loc_replica_bytes != loc_bytes[i])                                                       // Checking for stale replica...
+        {
+          clReleaseMemObject (replica[loc_output[i].buffer][d]);                                    // Releasing stale replica...
+          replica[loc_output[i].buffer][d] = NULL;                                                  // Resetting replica...
+        }
+      }
+
+      if(replica[loc_output[i].buffer][d] == NULL)                                                  // Checking for replica...
+      {
+        // Creating replica buffer:
+        replica[loc_output[i].buffer][d] = clCreateBuffer
+                                           (
+                                            context_id,                                             // OpenCL context.
+                                            CL_MEM_READ_WRITE,                                      // Memory flag.
+                                            loc_bytes[i],                                           // Data buffer size.
+                                            NULL,                                                   // Data buffer.
+                                            &loc_error                                              // Error code.
+                                           );
+        baseline->check_error (loc_error);                                                          // Checking error...
+      }
+
+      loc_begin  = loc_offset[d]*loc_output[i].row;                                                 // Getting partition beginning...
+      loc_length = (loc_begin < loc_bytes[i]) ? std::min (loc_count[d]*loc_output[i].row, loc_bytes[i] - loc_begin) : 0;
+
+      if(loc_length > 0)                                                                            // Checking for partition data...
+      {
+        // Refreshing replica partition (the kernel may also read its own output), after the previous
+        // commands of the primary queue and ahead of the partition launch on the same in-order
+        // device queue:
+        loc_error = clEnqueueCopyBuffer
+                    (
+                     device_queue[d]->queue_id,                                                     // Device queue.
+                     loc_output[i].buffer,                                                          // Source buffer.
+                     replica[loc_output[i].buffer][d],                                              // Destination buffer.
+                     loc_begin,                                                                     // Source offset.
+                     loc_begin,                                                                     // Destination offset.
+                     loc_length,                                                                    // Size [bytes].
+                     1,                                                                             // Number of events.
+                     &loc_ready,                                                                    // Event list.
+                     NULL                                                                           // Event.
+                    );
+        baseline->check_error (loc_error);                                                          // Checking error...
+      }
+
+      loc_buffer[loc_output[i].buffer] = replica[loc_output[i].buffer][d];                          // Mapping replica buffer...
+    }
+
+    loc_kernel_id[d] = loc_kernel->replica (d, loc_buffer);                                         // Getting device kernel...
+  }
+
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  //////////////////////////////////////// LAUNCHING PARTITIONS //////////////////////////////////////
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  for(d = 0; d < loc_devices; d++)                                                                  // Scanning devices...
+  {
+    if(loc_count[d] == 0)                                                                           // Checking for partition...
+    {
+      continue;
+    }
+
+    loc_queue_id                        = (d == 0) ? loc_queue->queue_id : device_queue[d]->queue_id; // Getting device queue...
+    kernel_offset[kernel_dimension - 1] = loc_offset[d];                                            // Setting partition offset...
+    kernel_size[kernel_dimension - 1]   = loc_count[d];                                             // Setting partition size...
+    loc_wait.clear ();                                                                              // Resetting wait list...
+
+    if(d > 0)                                                                                       // Checking for secondary device...
+    {
+      loc_wait.push_back (loc_ready);                                                               // Waiting for the previous commands of the primary queue...
+    }
+
+    if(loc_previous != NULL)                                                                        // Checking for previous partition (shared memory)...
+    {
+      loc_wait.push_back (loc_previous);                                                            // Waiting for the previous partition...
+    }
+
+    // Enqueueing OpenCL kernel partition:
+    loc_error = clEnqueueNDRangeKernel
+                (
+                 loc_queue_id,                                                                      // Queue ID.
+                 loc_kernel_id[d],                                                                  // Kernel ID.
+                 kernel_dimension,                                                                  // Kernel dimension.
+                 kernel_offset,                                                                     // Global work offset.
+                 kernel_size,                                                                       // Global work size.
+                 (loc_kernel->local_i > 0) ? kernel_local : NULL,                                   // Local work size.
+                 (cl_uint)loc_wait.size (),                                                         // Number of events.
+                 loc_wait.empty () ? NULL : loc_wait.data (),                                       // Event list.
+                 &loc_launch[d]                                                                     // Event.
+                );
+    baseline->check_error (loc_error);                                                              // Checking error...
+    clFlush (loc_queue_id);                                                                         // Submitting partition...
+
+    if(shared_memory)                                                                               // Checking for shared memory...
+    {
+      // Ordering partitions (sub-devices write the same buffers from different queues):
+      loc_previous = loc_launch[d];
+    }
+  }
+
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  //////////////////////////////////// RECORDING DEVICE PARTITIONS ///////////////////////////////////
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  for(d = 0; d < loc_devices; d++)                                                                  // Scanning devices...
+  {
+    if(loc_launch[d] == NULL)                                                                       // Checking for partition...
+    {
+      continue;
+    }
+
+    clRetainEvent (loc_launch[d]);                                                                  // Retaining partition event for the throughput measurement...
+    pending.push_back ({loc_launch[d], d, loc_count[d]});                                           // Deferring throughput measurement...
+
+    loc_name = loc_kernel->kernel_file_name.back () + ":" + loc_kernel->kernel_name + " (device #" + std::to_string (d) + ")";
+
+    if(d == 0)                                                                                      // Checking for primary device...
+    {
+      clRetainEvent (loc_launch[d]);                                                                // Retaining partition event for the profiler...
+      baseline->record (loc_launch[d], loc_name, 0);                                                // Recording partition (released here in case of no profiling)...
+    }
+
+    else if(baseline->profiling != NULL)                                                            // Checking for profiling...
+    {
+      // Recording partition on the profiler only (the tracer timeline is on the primary device clock):
+      clRetainEvent (loc_launch[d]);                                                                // Retaining partition event for the profiler...
+      baseline->profiling->record (loc_launch[d], loc_name, 0);                                     // Recording partition...
+    }
+  }
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  ////////////////////////////////////////// MERGING RESULTS /////////////////////////////////////////
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  for(d = 1; (d < loc_devices) && !shared_memory; d++)                                              // Scanning secondary devices...
+  {
+    if(loc_count[d] == 0)                                                                           // Checking for partition...
+    {
+      continue;
+    }
+
+    for(i = 0; i < loc_output.size (); i++)                                                         // Scanning output buffers...
+    {
+      loc_begin  = loc_offset[d]*loc_output[i].row;                                                 // Getting partition beginning...
+      loc_length = (loc_begin < loc_bytes[i]) ? std::min (loc_count[d]*loc_output[i].row, loc_bytes[i] - loc_begin) : 0;
+
+      if(loc_length == 0)                                                                           // Checking for padding work-items only...
+      {
+        continue;
+      }
+
+      // Copying partition from replica to original buffer, after the device partition:
+      loc_error = clEnqueueCopyBuffer
+                  (
+                   loc_queue->queue_id,                                                             // Primary queue.
+                   replica[loc_output[i].buffer][d],                                                // Source buffer.
+                   loc_output[i].buffer,                                                            // Destination buffer.
+                   loc_begin,                                                                       // Source offset.
+                   loc_begin,                                                                       // Destination offset.
+                   loc_length,                                                                      // Size [bytes].
+                   1,                                                                               // Number of events.
+                   &loc_launch[d],                                                                  // Event list.
+                   NULL                                                                             // Event.
+                  );
+      baseline->check_error (loc_error);                                                            // Checking error...
+    }
+  }
+
+  loc_wait.clear ();                                                                                // Resetting wait list...
+
+  for(d = 0; d < loc_devices; d++)                                                                  // Scanning devices...
+  {
+    if(loc_launch[d] != NULL)                                                                       // Checking for partition...
+    {
+      loc_wait.push_back (loc_launch[d]);                                                           // Waiting for partition (written in place in shared memory)...
+    }
+  }
+
+  // Marking completion (the following commands of the primary queue wait for all the partitions):
+  loc_error = clEnqueueMarkerWithWaitList
+              (
+               loc_queue->queue_id,                                                                 // Primary queue.
+               (cl_uint)loc_wait.size (),                                                           // Number of events.
+               loc_wait.empty () ? NULL : loc_wait.data (),                                         // Event list.
+               loc_event                                                                            // Event.
+              );
+
+  for(d = 0; d < loc_devices; d++)                                                                  // Scanning devices...
+  {
+    if(loc_launch[d] != NULL)                                                                       // Checking for partition...
+    {
+      clReleaseEvent (loc_launch[d]);                                                               // Releasing partition event...
+    }
+  }
+
+  clReleaseEvent (loc_ready);                                                                       // Releasing primary queue marker...
+
+  return loc_error;                                                                                 // Returning error code...
+}
+
+void opencl::collect
+(
+ bool loc_wait                                                                                      // Wait flag.
+)
+{
+  cl_int   loc_status;                                                                              // Partition execution status.
+  cl_ulong loc_start;                                                                               // Kernel start time [ns].
+  cl_ulong loc_end;                                                                                 // Kernel end time [ns].
+  double   loc_rate;                                                                                // Measured throughput [work-items/ns].
+  size_t   i = 0;                                                                                   // Index.
+
+  while(i < pending.size ())                                                                        // Scanning pending partitions...
+  {
+    loc_status = CL_COMPLETE;                                                                       // Resetting status...
+
+    if(loc_wait)                                                                                    // Checking wait flag...
+    {
+      clWaitForEvents (1, &pending[i].event);                                                       // Waiting for partition...
+    }
+
+    clGetEventInfo (pending[i].event, CL_EVENT_COMMAND_EXECUTION_STATUS, sizeof(cl_int), &loc_status, NULL);
+
+    if(loc_status > CL_COMPLETE)                                                                    // Checking for running partition...
+    {
+      i++;                                                                                          // Leaving it for the next call...
+      continue;
+    }
+
+    loc_start = 0;                                                                                  // Resetting start time...
+    loc_end   = 0;                                                                                  // Resetting end time...
+    clGetEventProfilingInfo (pending[i].event, CL_PROFILING_COMMAND_START, sizeof(cl_ulong), &loc_start, NULL);
+    clGetEventProfilingInfo (pending[i].event, CL_PROFILING_COMMAND_END, sizeof(cl_ulong), &loc_end, NULL);
+
+    if((loc_status == CL_COMPLETE) && (loc_end > loc_start))                                        // Checking for valid time...
+    {
+      loc_rate                        = (double)pending[i].count/(double)(loc_end - loc_start);     // Getting throughput...
+      device_rate[pending[i].device]  = (device_rate[pending[i].device] > 0.0) ?
+                                        (NU_SPREAD_WEIGHT*loc_rate + (1.0 - NU_SPREAD_WEIGHT)*device_rate[pending[i].device]) :
+                                        loc_rate;                                                   // Smoothing throughput...
+    }
+
+    clReleaseEvent (pending[i].event);                                                              // Releasing partition event...
+    pending.erase (pending.begin () + i);                                                           // Removing partition...
+  }
+}
+
+double opencl::benchmark
+(
+ kernel* loc_kernel,                                                                                // OpenCL kernel.
+ queue*  loc_queue                                                                                  // OpenCL queue.
+)
+{
+  size_t                                i;                                                          // Index.
+  cl_int                                loc_error;                                                  // Error code.
+  std::chrono::steady_clock::time_point loc_begin;                                                  // Benchmark beginning time.
+
+  loc_error = launch (loc_kernel, loc_queue, NULL);                                                 // Warming up...
   clFinish (loc_queue->queue_id);                                                                   // Waiting for OpenCL to finish...
 
-  // Selecting kernel size:
-  if(
-     (loc_kernel->size_i > 0) &&
-     (loc_kernel->size_j == 0) &&
-     (loc_kernel->size_k == 0)
-    )
+  if(loc_error != CL_SUCCESS)                                                                       // Checking for candidate rejected by the driver...
   {
-    kernel_dimension = 1;
-    kernel_size      = new size_t[kernel_dimension];
-    kernel_size[0]   = loc_kernel->size_i;
-    kernel_valid     = true;
+    return -1.0;                                                                                    // Returning invalid time...
   }
 
-  if(
-     (loc_kernel->size_i > 0) &&
-     (loc_kernel->size_j > 0) &&
-     (loc_kernel->size_k == 0)
-    )
+  loc_begin = std::chrono::steady_clock::now ();                                                    // Getting beginning time...
+
+  for(i = 0; i < NU_TUNE_RUNS; i++)                                                                 // Timing candidate...
+  {
+    launch (loc_kernel, loc_queue, NULL);                                                           // Enqueueing OpenCL kernel...
+  }
+
+  clFinish (loc_queue->queue_id);                                                                   // Waiting for OpenCL to finish...
+
+  return std::chrono::duration<double>(std::chrono::steady_clock::now () - loc_begin).count ();     // Returning time...
+}
+
+void opencl::tune
+(
+ kernel* loc_kernel,                                                                                // OpenCL kernel.
+ queue*  loc_queue                                                                                  // OpenCL queue.
+)
+{
+  cl_int                   loc_error;                                                               // Error code.
+  cl_uint                  kernel_dimension;                                                        // Kernel dimension.
+  size_t                   kernel_size[3];                                                          // Kernel size array.
+  size_t                   kernel_local[3];                                                         // Kernel local size array.
+  size_t                   loc_group_size;                                                          // Maximum work-group size for the kernel [#].
+  size_t                   loc_multiple;                                                            // Preferred work-group size multiple [#].
+  size_t                   loc_item_size[3];                                                        // Maximum work-item sizes of the device [#].
+  size_t                   loc_limit[3];                                                            // Candidate local size limits [#].
+  std::vector<size_t>      loc_divisor[3];                                                          // Candidate local sizes (divisors of the global size) [#].
+  size_t                   loc_best[3];                                                             // Best local size [#].
+  double                   loc_best_time;                                                           // Best execution time [s].
+  double                   loc_time;                                                                // Execution time [s].
+  std::string              loc_key;                                                                 // Autotuner cache key.
+  std::string              loc_file_name;                                                           // Autotuner cache file name.
+  std::ifstream            loc_input;                                                               // Autotuner cache input file.
+  std::ofstream            loc_output;                                                              // Autotuner cache output file.
+  size_t                   i;                                                                       // Index.
+  size_t                   j;                                                                       // Index.
+  size_t                   k;                                                                       // Index.
+  std::map<std::string, std::string>::iterator loc_constant;                                        // Specialization constant.
+
+  baseline->action ("tuning kernel local size...");                                                 // Printing message...
+
+  kernel_dimension = loc_kernel->get_size (kernel_size, kernel_local);                              // Getting kernel dimension...
+
+  // Building autotuner cache key:
+  for(i = 0; i < loc_kernel->kernel_source.size (); i++)
   {
-    kernel_dimension = 2;
-    kernel_size      = new size_t[kernel_dimension];
-    kernel_size[0]   = loc_kernel->size_i;
-    kernel_size[1]   = loc_kernel->size_j;
-    kernel_valid     = true;
+    loc_key += loc_kernel->kernel_source[i] + '\0';                                                 // Appending kernel source...
   }
 
-  if(
-     (loc_kernel->size_i > 0) &&
-     (loc_kernel->size_j > 0) &&
-     (loc_kernel->size_k > 0)
-    )
+  for(loc_constant = loc_kernel->constant.begin (); loc_constant != loc_kernel->constant.end (); loc_constant++)
   {
-    kernel_dimension = 3;
-    kernel_size      = new size_t[kernel_dimension];
-    kernel_size[0]   = loc_kernel->size_i;
-    kernel_size[1]   = loc_kernel->size_j;
-    kernel_size[2]   = loc_kernel->size_k;
-    kernel_valid     = true;
+    loc_key += loc_constant->first + "=" + loc_constant->second + '\0';                             // Appending specialization constant...
   }
 
-  if(!kernel_valid)
+  loc_key += loc_kernel->compiler_options + '\0' +                                                  // Appending compiler options...
+             loc_kernel->kernel_name + '\0' +                                                       // Appending kernel entry point name...
+             std::to_string (loc_kernel->size_i) + " " +                                            // Appending kernel size (i-index)...
+             std::to_string (loc_kernel->size_j) + " " +                                            // Appending kernel size (j-index)...
+             std::to_string (loc_kernel->size_k);                                                   // Appending kernel size (k-index)...
+
+  if(baseline->cache)                                                                               // Checking for autotuner cache...
   {
-    baseline->error ("invalid kernel size!");
-    exit (EXIT_FAILURE);
+    loc_file_name = baseline->cache_file (loc_kernel->kernel_home, loc_key, NU_TUNE_EXTENSION);     // Getting cache file name...
+    loc_input.open (loc_file_name);                                                                 // Opening cache file...
+
+    if(loc_input >> loc_kernel->local_i >> loc_kernel->local_j >> loc_kernel->local_k)              // Reading cached local size...
+    {
+      loc_input.close ();                                                                           // Closing cache file...
+      baseline->done ();                                                                            // Printing message...
+      return;                                                                                       // Local size already tuned on this device...
+    }
   }
 
-  // Enqueueing OpenCL kernel (as a single task):
-  loc_error = clEnqueueNDRangeKernel
+  // Getting work-group limits:
+  loc_error = clGetKernelWorkGroupInfo
+              (
+               loc_kernel->kernel_id,                                                               // Kernel ID.
+               baseline->device_id,                                                                 // Device ID.
+               CL_KERNEL_WORK_GROUP_SIZE,                                                           // Parameter name.
+               sizeof(size_t),                                                                      // Parameter size.
+               &loc_group_size,                                                                     // Parameter value.
+               NULL                                                                                 // Returned parameter size.
+              );
+  baseline->check_error (loc_error);                                                                // Checking error...
+
+  loc_error = clGetKernelWorkGroupInfo
               (
-               loc_queue->queue_id,                                                                 // Queue ID.
                loc_kernel->kernel_id,                                                               // Kernel ID.
-               kernel_dimension,                                                                    // Kernel dimension.
-               NULL,                                                                                // Global work offset.
-               kernel_size,                                                                         // Global work size.
-               NULL,                                                                                // Local work size.
-               0,                                                                                   // Number of events.
-               NULL,                                                                                // Event list.
-               &loc_kernel->event                                                                   // Event.
+               baseline->device_id,                                                                 // Device ID.
+               CL_KERNEL_PREFERRED_WORK_GROUP_SIZE_MULTIPLE,                                        // Parameter name.
+               sizeof(size_t),                                                                      // Parameter size.
+               &loc_multiple,                                                                       // Parameter value.
+               NULL                                                                                 // Returned parameter size.
               );
+  baseline->check_error (loc_error);                                                                // Checking error...
 
+  loc_error = clGetDeviceInfo
+              (
+               baseline->device_id,                                                                 // Device ID.
+               CL_DEVICE_MAX_WORK_ITEM_SIZES,                                                       // Parameter name.
+               sizeof(loc_item_size),                                                               // Parameter size.
+               loc_item_size,                                                                       // Parameter value.
+               NULL                                                                                 // Returned parameter size.
+              );
   baseline->check_error (loc_error);                                                                // Checking error...
 
-  clFinish (loc_queue->queue_id);                                                                   // Waiting for OpenCL to finish...
+  loc_multiple = std::min (std::max (loc_multiple, (size_t)1), loc_group_size);                     // Constraining preferred multiple...
+
+  for(i = 0; i < 3; i++)                                                                            // Setting candidate limits (a local size never exceeds the global one)...
+  {
+    loc_limit[i] = (i < kernel_dimension) ? std::min (loc_item_size[i], kernel_size[i]) : 1;
+  }
+
+  // Benchmarking driver choice (reference):
+  loc_kernel->local_i = 0;                                                                          // Resetting local size (i-index)...
+  loc_kernel->local_j = 0;                                                                          // Resetting local size (j-index)...
+  loc_kernel->local_k = 0;                                                                          // Resetting local size (k-index)...
+  loc_best[0]         = 0;                                                                          // Setting best local size (i-index)...
+  loc_best[1]         = 0;                                                                          // Setting best local size (j-index)...
+  loc_best[2]         = 0;                                                                          // Setting best local size (k-index)...
+  loc_best_time       = benchmark (loc_kernel, loc_queue);                                          // Setting best time...
+
+  // Getting candidate local sizes (divisors of the global size, not to pad it):
+  for(i = 0; i < 3; i++)
+  {
+    for(j = 1; j <= loc_limit[i]; j++)
+    {
+      if((kernel_size[i] == 0) || ((kernel_size[i] % j) == 0))                                      // Checking divisor...
+      {
+        loc_divisor[i].push_back (j);                                                               // Adding candidate...
+      }
+    }
+  }
+
+  // Scanning candidates:
+  for(i = 0; i < loc_divisor[0].size (); i++)
+  {
+    for(j = 0; j < loc_divisor[1].size (); j++)
+    {
+      for(k = 0; k < loc_divisor[2].size (); k++)
+      {
+        loc_kernel->local_i = loc_divisor[0][i];                                                    // Setting candidate local size (i-index)...
+        loc_kernel->local_j = loc_divisor[1][j];                                                    // Setting candidate local size (j-index)...
+        loc_kernel->local_k = loc_divisor[2][k];                                                    // Setting candidate local size (k-index)...
+
+        if(
+           ((loc_kernel->local_i*loc_kernel->local_j*loc_kernel->local_k) > loc_group_size) ||
+           ((loc_kernel->local_i*loc_kernel->local_j*loc_kernel->local_k) < loc_multiple)
+          )                                                                                         // Checking work-group limits...
+        {
+          continue;                                                                                 // Skipping candidate...
+        }
+
+        loc_time = benchmark (loc_kernel, loc_queue);                                               // Benchmarking candidate...
+
+        if((loc_time >= 0.0) && ((loc_best_time < 0.0) || (loc_time < loc_best_time)))              // Checking for best candidate...
+        {
+          loc_best_time = loc_time;                                                                 // Setting best time...
+          loc_best[0]   = loc_kernel->local_i;                                                      // Setting best local size (i-index)...
+          loc_best[1]   = loc_kernel->local_j;                                                      // Setting best local size (j-index)...
+          loc_best[2]   = loc_kernel->local_k;                                                      // Setting best local size (k-index)...
+        }
+      }
+    }
+  }
+
+  loc_kernel->local_i = loc_best[0];                                                                // Setting best local size (i-index)...
+  loc_kernel->local_j = loc_best[1];                                                                // Setting best local size (j-index)...
+  loc_kernel->local_k = loc_best[2];                                                                // Setting best local size (k-index)...
+
+  if(baseline->cache)                                                                               // Checking for autotuner cache...
+  {
+    loc_output.open (loc_file_name);                                                                // Opening cache file...
+    loc_output << loc_best[0] << " " << loc_best[1] << " " << loc_best[2] << std::endl;             // Writing best local size...
+    loc_output.close ();                                                                            // Closing cache file...
+  }
+
+  baseline->done ();                                                                                // Printing message...
+}
+
+void opencl::execute
+(
+ kernel*     loc_kernel,                                                                            // OpenCL kernel.
+ queue*      loc_queue,                                                                             // OpenCL queue.
+ kernel_mode loc_kernel_mode                                                                        // Kernel mode.
+)
+{
+  cl_int   loc_error;                                                                               // Error code.
+  size_t   loc_bytes    = 0;                                                                        // Kernel argument size [bytes].
+  size_t   i;                                                                                       // Index.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
+
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
+
+  if(loc_kernel->event != NULL)                                                                     // Checking for previous kernel event...
+  {
+    loc_error = clReleaseEvent (loc_kernel->event);                                                 // Releasing previous kernel event...
+    baseline->check_error (loc_error);                                                              // Checking error...
+    loc_kernel->event = NULL;                                                                       // Resetting kernel event...
+  }
+
+  if(device_queue.size () > 1)                                                                      // Checking for multi-device mode...
+  {
+    loc_error = spread (loc_kernel, loc_queue, &loc_kernel->event);                                 // Enqueueing OpenCL kernel on all devices...
+  }
+
+  else
+  {
+    loc_error = launch (loc_kernel, loc_queue, &loc_kernel->event);                                 // Enqueueing OpenCL kernel...
+  }
+
+  baseline->check_error (loc_error);                                                                // Checking error...
+
+  if(((baseline->profiling != NULL) || (baseline->tracing != NULL)) && (device_queue.size () <= 1)) // Checking for profiling or tracing (single device)...
+  {
+    for(i = 0; i < loc_kernel->argument_bytes.size (); i++)                                         // Scanning kernel arguments...
+    {
+      loc_bytes += loc_kernel->argument_bytes[i];                                                   // Accumulating argument size...
+    }
+
+    clRetainEvent (loc_kernel->event);                                                              // Retaining kernel event for the profiler...
+    baseline->record
+    (
+     loc_kernel->event,                                                                             // Profiling event.
+     loc_kernel->kernel_file_name.back () + ":" + loc_kernel->kernel_name,                          // Profiling entry name.
+     loc_bytes                                                                                      // Transferred data [bytes].
+    );
+  }
 
   // Selecting kernel mode:
   switch(loc_kernel_mode)
@@ -693,7 +1707,7 @@ void opencl::execute
       break;
 
     case NU_DONT_WAIT:
-      // Doing nothing, without waiting!
+      clFlush (loc_queue->queue_id);                                                                // Submitting execution to the device, without waiting...
       break;
 
     default:
@@ -701,13 +1715,260 @@ void opencl::execute
       baseline->check_error (loc_error);                                                            // Checking error...
       break;
   }
+
+  baseline->trace_end ("execute", loc_span);                                                        // Appending trace span...
+}
+
+void CL_CALLBACK opencl::completion
+(
+ cl_event loc_event,                                                                                // Kernel event.
+ cl_int   loc_status,                                                                               // Kernel event execution status.
+ void*    loc_data                                                                                  // Host function.
+)
+{
+  std::function<void (cl_int)>* loc_callback = (std::function<void (cl_int)>*)loc_data;             // Host function.
+
+  (void)loc_event;                                                                                  // Unused (required by the OpenCL callback signature)...
+  (*loc_callback)(loc_status);                                                                      // Calling host function...
+  delete loc_callback;                                                                              // Deleting host function...
+}
+
+void opencl::execute
+(
+ kernel*                      loc_kernel,                                                           // OpenCL kernel.
+ queue*                       loc_queue,                                                            // OpenCL queue.
+ std::function<void (cl_int)> loc_callback                                                          // Completion host function.
+)
+{
+  cl_int                        loc_error;                                                          // Error code.
+  std::function<void (cl_int)>* loc_data;                                                           // Host function (owned by the callback).
+
+  execute (loc_kernel, loc_queue, NU_DONT_WAIT);                                                    // Enqueueing OpenCL kernel, without waiting...
+
+  loc_data  = new std::function<void (cl_int)>(loc_callback);                                       // Copying host function...
+  loc_error = clSetEventCallback (loc_kernel->event, CL_COMPLETE, completion, loc_data);            // Registering completion callback...
+
+  if(loc_error != CL_SUCCESS)                                                                       // Checking error...
+  {
+    delete loc_data;                                                                                // Deleting host function...
+    baseline->check_error (loc_error);                                                              // Checking error...
+  }
+}
+
+void opencl::wait
+(
+ kernel* loc_kernel                                                                                 // OpenCL kernel.
+)
+{
+  if(loc_kernel->event != NULL)                                                                     // Checking for kernel event...
+  {
+    baseline->check_error (clWaitForEvents (1, &loc_kernel->event));                                // Waiting for kernel to be completed (host blocking)...
+  }
+}
+
+void opencl::execute
+(
+ kernel*     loc_kernel,                                                                            // OpenCL kernel.
+ queue*      loc_queue,                                                                             // OpenCL queue.
+ kernel_mode loc_kernel_mode,                                                                       // Kernel mode.
+ size_t      loc_steps,                                                                             // Number of executions [#].
+ pingpong*   loc_pingpong                                                                           // Pingpong swapped after each execution (NULL = none).
+)
+{
+  cl_int    loc_error;                                                                              // Error code.
+  cl_event  loc_event;                                                                              // Profiling event.
+  cl_event* loc_step_event;                                                                         // Step event.
+  size_t    loc_bytes    = 0;                                                                       // Kernel argument size [bytes].
+  size_t    i;                                                                                      // Index.
+  cl_ulong  loc_span = baseline->trace_begin ();                                                    // Trace span beginning [ns].
+
+  if(loc_steps == 0)                                                                                // Checking number of executions...
+  {
+    return;
+  }
+
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish (once)...
+
+  if(loc_kernel->event != NULL)                                                                     // Checking for previous kernel event...
+  {
+    loc_error = clReleaseEvent (loc_kernel->event);                                                 // Releasing previous kernel event...
+    baseline->check_error (loc_error);                                                              // Checking error...
+    loc_kernel->event = NULL;                                                                       // Resetting kernel event...
+  }
+
+  for(i = 0; i < loc_kernel->argument_bytes.size (); i++)                                           // Scanning kernel arguments...
+  {
+    loc_bytes += loc_kernel->argument_bytes[i];                                                     // Accumulating argument size...
+  }
+
+  for(i = 0; i < loc_steps; i++)                                                                    // Enqueueing executions back-to-back...
+  {
+    loc_event      = NULL;                                                                          // Resetting profiling event...
+    loc_step_event = (i == (loc_steps - 1)) ? &loc_kernel->event : baseline->profile (&loc_event); // Keeping the last event on the kernel...
+    loc_error      = (device_queue.size () > 1) ?
+                     spread (loc_kernel, loc_queue, loc_step_event) :                               // Enqueueing OpenCL kernel on all devices...
+                     launch (loc_kernel, loc_queue, loc_step_event);                                // Enqueueing OpenCL kernel...
+
+    baseline->check_error (loc_error);                                                              // Checking error...
+
+    if(((baseline->profiling != NULL) || (baseline->tracing != NULL)) && (device_queue.size () <= 1)) // Checking for profiling or tracing (single device)...
+    {
+      if(i == (loc_steps - 1))
+      {
+        clRetainEvent (loc_kernel->event);                                                          // Retaining kernel event for the profiler...
+      }
+
+      baseline->record
+      (
+       *loc_step_event,                                                                             // Profiling event.
+       loc_kernel->kernel_file_name.back () + ":" + loc_kernel->kernel_name,                        // Profiling entry name.
+       loc_bytes                                                                                    // Transferred data [bytes].
+      );
+    }
+
+    if(loc_pingpong != NULL)                                                                        // Checking for pingpong...
+    {
+      loc_pingpong->swap ();                                                                        // Swapping states for the next execution...
+    }
+  }
+
+  // Selecting kernel mode:
+  switch(loc_kernel_mode)
+  {
+    case NU_WAIT:
+      loc_error = clWaitForEvents (1, &loc_kernel->event);                                          // Waiting for last execution to be completed (host blocking)...
+      baseline->check_error (loc_error);                                                            // Checking error...
+      break;
+
+    case NU_DONT_WAIT:
+      clFlush (loc_queue->queue_id);                                                                // Submitting executions to the device, without waiting...
+      break;
+
+    default:
+      loc_error = clWaitForEvents (1, &loc_kernel->event);                                          // Waiting for last execution to be completed (host blocking)...
+      baseline->check_error (loc_error);                                                            // Checking error...
+      break;
+  }
+
+  baseline->trace_end ("execute", loc_span);                                                        // Appending trace span...
+}
+
+bool opencl::advance
+(
+ kernel* loc_kernel,                                                                                // OpenCL kernel.
+ queue*  loc_queue,                                                                                 // OpenCL queue.
+ size_t  loc_chunk                                                                                  // Chunk size along the last dimension [#].
+)
+{
+  cl_int   loc_error;                                                                               // Error code.
+  cl_uint  kernel_dimension;                                                                        // Kernel dimension.
+  size_t   kernel_size[3];                                                                          // Kernel size array.
+  size_t   kernel_local[3];                                                                         // Kernel local size array.
+  size_t   loc_total;                                                                               // Range size along the last dimension [#].
+  size_t   loc_count;                                                                               // Chunk size along the last dimension [#].
+  size_t   loc_bytes    = 0;                                                                        // Kernel argument size [bytes].
+  size_t   i;                                                                                       // Index.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
+
+  if(device_queue.size () > 1)                                                                      // Checking for multi-device mode...
+  {
+    baseline->error ("chunked execution not available in multi-device mode!");                      // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  kernel_dimension = loc_kernel->get_size (kernel_size, kernel_local);                              // Getting kernel size...
+  loc_total        = kernel_size[kernel_dimension - 1];                                             // Getting range size along the last dimension...
+
+  if(loc_kernel->local_i > 0)                                                                       // Checking for explicit local size...
+  {
+    loc_chunk = ((loc_chunk + kernel_local[kernel_dimension - 1] - 1)/kernel_local[kernel_dimension - 1])*
+                kernel_local[kernel_dimension - 1];                                                 // Rounding chunk up to a multiple of the local size...
+  }
+
+  if(loc_chunk == 0)
+  {
+    baseline->error ("invalid chunk size!");                                                        // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  if(loc_kernel->chunk_offset >= loc_total)                                                         // Checking chunk offset (e.g. after a kernel resize)...
+  {
+    loc_kernel->chunk_offset = 0;                                                                   // Restarting from the beginning of the range...
+  }
+
+  loc_count = std::min (loc_chunk, loc_total - loc_kernel->chunk_offset);                           // Getting chunk size...
+
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
+
+  if(loc_kernel->event != NULL)                                                                     // Checking for previous kernel event...
+  {
+    loc_error = clReleaseEvent (loc_kernel->event);                                                 // Releasing previous kernel event...
+    baseline->check_error (loc_error);                                                              // Checking error...
+    loc_kernel->event = NULL;                                                                       // Resetting kernel event...
+  }
+
+  // Enqueueing OpenCL kernel chunk:
+  loc_error = launch (loc_kernel, loc_queue, &loc_kernel->event, loc_kernel->chunk_offset, loc_count);
+
+  baseline->check_error (loc_error);                                                                // Checking error...
+
+  if((baseline->profiling != NULL) || (baseline->tracing != NULL))                                  // Checking for profiling or tracing...
+  {
+    for(i = 0; i < loc_kernel->argument_bytes.size (); i++)                                         // Scanning kernel arguments...
+    {
+      loc_bytes += loc_kernel->argument_bytes[i];                                                   // Accumulating argument size...
+    }
+
+    clRetainEvent (loc_kernel->event);                                                              // Retaining kernel event for the profiler...
+    baseline->record
+    (
+     loc_kernel->event,                                                                             // Profiling event.
+     loc_kernel->kernel_file_name.back () + ":" + loc_kernel->kernel_name + " (chunk)",             // Profiling entry name.
+     (loc_bytes*loc_count)/loc_total                                                                // Transferred data (chunk share) [bytes].
+    );
+  }
+
+  loc_error = clWaitForEvents (1, &loc_kernel->event);                                              // Waiting for chunk to be completed (host blocking)...
+  baseline->check_error (loc_error);                                                                // Checking error...
+
+  loc_kernel->chunk_offset += loc_count;                                                            // Advancing chunk offset...
+
+  baseline->trace_end ("advance", loc_span);                                                        // Appending trace span...
+
+  if(loc_kernel->chunk_offset >= loc_total)                                                         // Checking for last chunk...
+  {
+    loc_kernel->chunk_offset = 0;                                                                   // Restarting from the beginning of the range...
+    return true;                                                                                    // Range completed...
+  }
+
+  return false;                                                                                     // Range not completed yet...
 }
 
 opencl::~opencl()
 {
   cl_int loc_error;                                                                                 // Error code.
+  size_t i;                                                                                         // Index.
+  std::map<cl_mem, std::vector<cl_mem>>::iterator loc_replica;                                      // Replica buffers.
+
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
+  collect (true);                                                                                   // Releasing pending partitions...
+  baseline->placement.clear ();                                                                     // Resetting placement shares...
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  for(i = 0; i < device_queue.size (); i++)                                                         // Scanning device queues...
+  {
+    delete device_queue[i];                                                                         // Deleting device queue...
+  }
+
+  for(loc_replica = replica.begin (); loc_replica != replica.end (); loc_replica++)                 // Scanning replica buffers...
+  {
+    for(i = 0; i < loc_replica->second.size (); i++)
+    {
+      if(loc_replica->second[i] != NULL)
+      {
+        clReleaseMemObject (loc_replica->second[i]);                                                // Releasing replica buffer...
+      }
+    }
+  }
 
   baseline->action ("releasing OpenCL context...");                                                 // Printing message...
 
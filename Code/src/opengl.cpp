@@ -868,6 +868,8 @@ void opengl::plot
  shader* loc_shader                                                                                 // OpenGL shader.
 )
 {
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
+
   switch(PR_mode)
   {
     case NU_MODE_MONO:
@@ -929,6 +931,8 @@ void opengl::plot
       glFinish ();                                                                                  // Waiting for OpenGL to finish...
       break;
   }
+
+  baseline->trace_end ("plot", loc_span);                                                           // Appending trace span...
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
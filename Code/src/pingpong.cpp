@@ -0,0 +1,458 @@
+/// @file     pingpong.cpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Definition of the "pingpong" class.
+
+#include "pingpong.hpp"
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// "pingpong" class //////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+pingpong::pingpong()
+{
+  baseline = NULL;                                                                                  // Initializing Neutrino baseline...
+}
+
+void pingpong::add
+(
+ bool     loc_ready,                                                                                // Data object "ready" flag.
+ cl_mem*  loc_buffer,                                                                               // Data buffer.
+ GLuint*  loc_vao,                                                                                  // OpenGL VAO (NULL = none).
+ GLuint*  loc_vbo,                                                                                  // OpenGL VBO (NULL = none).
+ cl_uint  loc_layout_index                                                                          // Layout index.
+)
+{
+  if(!loc_ready)                                                                                    // Checking for OpenCL buffer...
+  {
+    baseline->error ("Pingpong data object not set as kernel argument!");                           // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  buffer.push_back (loc_buffer);                                                                    // Adding data buffer...
+  vao.push_back (loc_vao);                                                                          // Adding OpenGL VAO...
+  vbo.push_back (loc_vbo);                                                                          // Adding OpenGL VBO...
+  layout.push_back (loc_layout_index);                                                              // Adding layout index...
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////// "init" int1 overload /////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+void pingpong::init
+(
+ neutrino*          loc_baseline,                                                                   // Neutrino baseline.
+ std::vector<int1*> loc_data                                                                        // int1 objects.
+)
+{
+  size_t i;                                                                                         // Index.
+
+  baseline = loc_baseline;                                                                          // Getting Neutrino baseline...
+  baseline->action ("initializing pingpong...");                                                    // Printing message...
+
+  if(loc_data.size () < 2)                                                                          // Checking number of data objects...
+  {
+    baseline->error ("Pingpong needs at least 2 data objects!");                                    // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  for(i = 0; i < loc_data.size (); i++)                                                             // Scanning data objects...
+  {
+    if(loc_data[i]->size != loc_data[0]->size)                                                      // Checking data size...
+    {
+      baseline->error ("Pingpong data objects must have the same size!");                           // Printing message...
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
+
+    add (loc_data[i]->ready, &loc_data[i]->buffer, NULL, NULL, loc_data[i]->layout);                // Adding data object...
+  }
+
+  baseline->done ();                                                                                // Printing message...
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////// "init" int2 overload /////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+void pingpong::init
+(
+ neutrino*          loc_baseline,                                                                   // Neutrino baseline.
+ std::vector<int2*> loc_data                                                                        // int2 objects.
+)
+{
+  size_t i;                                                                                         // Index.
+
+  baseline = loc_baseline;                                                                          // Getting Neutrino baseline...
+  baseline->action ("initializing pingpong...");                                                    // Printing message...
+
+  if(loc_data.size () < 2)                                                                          // Checking number of data objects...
+  {
+    baseline->error ("Pingpong needs at least 2 data objects!");                                    // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  for(i = 0; i < loc_data.size (); i++)                                                             // Scanning data objects...
+  {
+    if(loc_data[i]->size != loc_data[0]->size)                                                      // Checking data size...
+    {
+      baseline->error ("Pingpong data objects must have the same size!");                           // Printing message...
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
+
+    add (loc_data[i]->ready, &loc_data[i]->buffer, NULL, NULL, loc_data[i]->layout);                // Adding data object...
+  }
+
+  baseline->done ();                                                                                // Printing message...
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////// "init" int3 overload /////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+void pingpong::init
+(
+ neutrino*          loc_baseline,                                                                   // Neutrino baseline.
+ std::vector<int3*> loc_data                                                                        // int3 objects.
+)
+{
+  size_t i;                                                                                         // Index.
+
+  baseline = loc_baseline;                                                                          // Getting Neutrino baseline...
+  baseline->action ("initializing pingpong...");                                                    // Printing message...
+
+  if(loc_data.size () < 2)                                                                          // Checking number of data objects...
+  {
+    baseline->error ("Pingpong needs at least 2 data objects!");                                    // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  for(i = 0; i < loc_data.size (); i++)                                                             // Scanning data objects...
+  {
+    if(loc_data[i]->size != loc_data[0]->size)                                                      // Checking data size...
+    {
+      baseline->error ("Pingpong data objects must have the same size!");                           // Printing message...
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
+
+    add (loc_data[i]->ready, &loc_data[i]->buffer, NULL, NULL, loc_data[i]->layout);                // Adding data object...
+  }
+
+  baseline->done ();                                                                                // Printing message...
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////// "init" int4 overload /////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+void pingpong::init
+(
+ neutrino*          loc_baseline,                                                                   // Neutrino baseline.
+ std::vector<int4*> loc_data                                                                        // int4 objects.
+)
+{
+  size_t i;                                                                                         // Index.
+
+  baseline = loc_baseline;                                                                          // Getting Neutrino baseline...
+  baseline->action ("initializing pingpong...");                                                    // Printing message...
+
+  if(loc_data.size () < 2)                                                                          // Checking number of data objects...
+  {
+    baseline->error ("Pingpong needs at least 2 data objects!");                                    // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  for(i = 0; i < loc_data.size (); i++)                                                             // Scanning data objects...
+  {
+    if(loc_data[i]->size != loc_data[0]->size)                                                      // Checking data size...
+    {
+      baseline->error ("Pingpong data objects must have the same size!");                           // Printing message...
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
+
+    add (loc_data[i]->ready, &loc_data[i]->buffer, NULL, NULL, loc_data[i]->layout);                // Adding data object...
+  }
+
+  baseline->done ();                                                                                // Printing message...
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////// "init" float1 overload ////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+void pingpong::init
+(
+ neutrino*            loc_baseline,                                                                 // Neutrino baseline.
+ std::vector<float1*> loc_data                                                                      // float1 objects.
+)
+{
+  size_t i;                                                                                         // Index.
+
+  baseline = loc_baseline;                                                                          // Getting Neutrino baseline...
+  baseline->action ("initializing pingpong...");                                                    // Printing message...
+
+  if(loc_data.size () < 2)                                                                          // Checking number of data objects...
+  {
+    baseline->error ("Pingpong needs at least 2 data objects!");                                    // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  for(i = 0; i < loc_data.size (); i++)                                                             // Scanning data objects...
+  {
+    if(loc_data[i]->size != loc_data[0]->size)                                                      // Checking data size...
+    {
+      baseline->error ("Pingpong data objects must have the same size!");                           // Printing message...
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
+
+    add (loc_data[i]->ready, &loc_data[i]->buffer, NULL, NULL, loc_data[i]->layout);                // Adding data object...
+  }
+
+  baseline->done ();                                                                                // Printing message...
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////// "init" float1G overload ///////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+void pingpong::init
+(
+ neutrino*             loc_baseline,                                                                // Neutrino baseline.
+ std::vector<float1G*> loc_data                                                                     // float1G objects.
+)
+{
+  size_t i;                                                                                         // Index.
+
+  baseline = loc_baseline;                                                                          // Getting Neutrino baseline...
+  baseline->action ("initializing pingpong...");                                                    // Printing message...
+
+  if(loc_data.size () < 2)                                                                          // Checking number of data objects...
+  {
+    baseline->error ("Pingpong needs at least 2 data objects!");                                    // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  for(i = 0; i < loc_data.size (); i++)                                                             // Scanning data objects...
+  {
+    if(loc_data[i]->size != loc_data[0]->size)                                                      // Checking data size...
+    {
+      baseline->error ("Pingpong data objects must have the same size!");                           // Printing message...
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
+
+    add (loc_data[i]->ready, &loc_data[i]->buffer, &loc_data[i]->vao, &loc_data[i]->vbo, (cl_uint)loc_data[i]->layout); // Adding data object...
+  }
+
+  baseline->done ();                                                                                // Printing message...
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////// "init" float2 overload ////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+void pingpong::init
+(
+ neutrino*            loc_baseline,                                                                 // Neutrino baseline.
+ std::vector<float2*> loc_data                                                                      // float2 objects.
+)
+{
+  size_t i;                                                                                         // Index.
+
+  baseline = loc_baseline;                                                                          // Getting Neutrino baseline...
+  baseline->action ("initializing pingpong...");                                                    // Printing message...
+
+  if(loc_data.size () < 2)                                                                          // Checking number of data objects...
+  {
+    baseline->error ("Pingpong needs at least 2 data objects!");                                    // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  for(i = 0; i < loc_data.size (); i++)                                                             // Scanning data objects...
+  {
+    if(loc_data[i]->size != loc_data[0]->size)                                                      // Checking data size...
+    {
+      baseline->error ("Pingpong data objects must have the same size!");                           // Printing message...
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
+
+    add (loc_data[i]->ready, &loc_data[i]->buffer, NULL, NULL, loc_data[i]->layout);                // Adding data object...
+  }
+
+  baseline->done ();                                                                                // Printing message...
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////// "init" float3 overload ////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+void pingpong::init
+(
+ neutrino*            loc_baseline,                                                                 // Neutrino baseline.
+ std::vector<float3*> loc_data                                                                      // float3 objects.
+)
+{
+  size_t i;                                                                                         // Index.
+
+  baseline = loc_baseline;                                                                          // Getting Neutrino baseline...
+  baseline->action ("initializing pingpong...");                                                    // Printing message...
+
+  if(loc_data.size () < 2)                                                                          // Checking number of data objects...
+  {
+    baseline->error ("Pingpong needs at least 2 data objects!");                                    // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  for(i = 0; i < loc_data.size (); i++)                                                             // Scanning data objects...
+  {
+    if(loc_data[i]->size != loc_data[0]->size)                                                      // Checking data size...
+    {
+      baseline->error ("Pingpong data objects must have the same size!");                           // Printing message...
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
+
+    add (loc_data[i]->ready, &loc_data[i]->buffer, NULL, NULL, loc_data[i]->layout);                // Adding data object...
+  }
+
+  baseline->done ();                                                                                // Printing message...
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////// "init" float4 overload ////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+void pingpong::init
+(
+ neutrino*            loc_baseline,                                                                 // Neutrino baseline.
+ std::vector<float4*> loc_data                                                                      // float4 objects.
+)
+{
+  size_t i;                                                                                         // Index.
+
+  baseline = loc_baseline;                                                                          // Getting Neutrino baseline...
+  baseline->action ("initializing pingpong...");                                                    // Printing message...
+
+  if(loc_data.size () < 2)                                                                          // Checking number of data objects...
+  {
+    baseline->error ("Pingpong needs at least 2 data objects!");                                    // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  for(i = 0; i < loc_data.size (); i++)                                                             // Scanning data objects...
+  {
+    if(loc_data[i]->size != loc_data[0]->size)                                                      // Checking data size...
+    {
+      baseline->error ("Pingpong data objects must have the same size!");                           // Printing message...
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
+
+    add (loc_data[i]->ready, &loc_data[i]->buffer, NULL, NULL, loc_data[i]->layout);                // Adding data object...
+  }
+
+  baseline->done ();                                                                                // Printing message...
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////// "init" float4G overload ///////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+void pingpong::init
+(
+ neutrino*             loc_baseline,                                                                // Neutrino baseline.
+ std::vector<float4G*> loc_data                                                                     // float4G objects.
+)
+{
+  size_t i;                                                                                         // Index.
+
+  baseline = loc_baseline;                                                                          // Getting Neutrino baseline...
+  baseline->action ("initializing pingpong...");                                                    // Printing message...
+
+  if(loc_data.size () < 2)                                                                          // Checking number of data objects...
+  {
+    baseline->error ("Pingpong needs at least 2 data objects!");                                    // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  for(i = 0; i < loc_data.size (); i++)                                                             // Scanning data objects...
+  {
+    if(loc_data[i]->size != loc_data[0]->size)                                                      // Checking data size...
+    {
+      baseline->error ("Pingpong data objects must have the same size!");                           // Printing message...
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
+
+    add (loc_data[i]->ready, &loc_data[i]->buffer, &loc_data[i]->vao, &loc_data[i]->vbo, (cl_uint)loc_data[i]->layout); // Adding data object...
+  }
+
+  baseline->done ();                                                                                // Printing message...
+}
+
+void pingpong::bind
+(
+ kernel* loc_kernel                                                                                 // OpenCL kernel.
+)
+{
+  size_t i;                                                                                         // Index.
+  cl_int loc_error;                                                                                 // Error code.
+
+  bound.push_back (loc_kernel);                                                                     // Adding kernel...
+
+  for(i = 0; i < buffer.size (); i++)                                                               // Scanning data objects...
+  {
+    // Binding data buffer:
+    loc_error = loc_kernel->bind
+                (
+                 layout[i],                                                                         // Layout index.
+                 sizeof(cl_mem),                                                                    // Data size.
+                 buffer[i]                                                                          // Data value.
+                );
+
+    baseline->check_error (loc_error);                                                              // Checking error...
+  }
+}
+
+void pingpong::swap ()
+{
+  size_t i;                                                                                         // Index.
+  size_t j;                                                                                         // Index.
+  size_t n;                                                                                         // Number of data objects.
+  cl_int loc_error;                                                                                 // Error code.
+  cl_mem loc_buffer;                                                                                // Data buffer.
+  GLuint loc_vao;                                                                                   // OpenGL VAO.
+  GLuint loc_vbo;                                                                                   // OpenGL VBO.
+
+  n          = buffer.size ();                                                                      // Getting number of data objects...
+  loc_buffer = *buffer[0];                                                                          // Saving first data buffer...
+
+  // Rotating data buffers:
+  for(i = 0; i < (n - 1); i++)
+  {
+    *buffer[i] = *buffer[i + 1];                                                                    // Taking next data buffer...
+  }
+
+  *buffer[n - 1] = loc_buffer;                                                                      // Wrapping first data buffer...
+
+  if(vao[0] != NULL)                                                                                // Checking for OpenGL objects...
+  {
+    loc_vao = *vao[0];                                                                              // Saving first OpenGL VAO...
+    loc_vbo = *vbo[0];                                                                              // Saving first OpenGL VBO...
+
+    // Rotating OpenGL objects:
+    for(i = 0; i < (n - 1); i++)
+    {
+      *vao[i] = *vao[i + 1];                                                                        // Taking next OpenGL VAO...
+      *vbo[i] = *vbo[i + 1];                                                                        // Taking next OpenGL VBO...
+    }
+
+    *vao[n - 1] = loc_vao;                                                                          // Wrapping first OpenGL VAO...
+    *vbo[n - 1] = loc_vbo;                                                                          // Wrapping first OpenGL VBO...
+  }
+
+  // Rebinding data buffers:
+  for(j = 0; j < bound.size (); j++)
+  {
+    for(i = 0; i < n; i++)
+    {
+      loc_error = bound[j]->bind
+                  (
+                   layout[i],                                                                       // Layout index.
+                   sizeof(cl_mem),                                                                  // Data size.
+                   buffer[i]                                                                        // Data value.
+                  );
+
+      baseline->check_error (loc_error);                                                            // Checking error...
+    }
+  }
+}
+
+pingpong::~pingpong()
+{
+  // Nothing to release: buffers belong to the data objects.
+}
@@ -0,0 +1,345 @@
+/// @file     pipeline.cpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Definition of the "pipeline" class.
+
+#include "pipeline.hpp"
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// "pipeline" class //////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+pipeline::pipeline()
+{
+  baseline       = NULL;                                                                            // Initializing Neutrino baseline...
+  pipeline_queue = NULL;                                                                            // Initializing pipeline queue...
+  shared         = false;                                                                           // Initializing OpenCL/GL shared objects flag...
+}
+
+void pipeline::init
+(
+ neutrino* loc_baseline,                                                                            // Neutrino baseline.
+ queue*    loc_queue                                                                                // OpenCL queue.
+)
+{
+  baseline       = loc_baseline;                                                                    // Getting Neutrino baseline...
+  baseline->action ("initializing pipeline...");                                                    // Printing message...
+  pipeline_queue = loc_queue;                                                                       // Getting pipeline queue...
+  baseline->done ();                                                                                // Printing message...
+}
+
+void pipeline::execute
+(
+ kernel* loc_kernel                                                                                 // OpenCL kernel.
+)
+{
+  step_structure loc_step;                                                                          // Recorded step.
+  cl_uint        i;                                                                                 // Index.
+
+  if(baseline->device_list.size () > 1)                                                             // Checking for multi-device context...
+  {
+    baseline->error ("pipeline kernel steps not available in multi-device mode!");                  // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  loc_step.type           = NU_STEP_KERNEL;                                                         // Setting step type...
+  loc_step.step_kernel    = loc_kernel;                                                             // Setting step kernel...
+  loc_step.dimension      = 0;                                                                      // Resetting kernel dimension...
+  loc_step.data1G         = NULL;                                                                   // Resetting float1G object...
+  loc_step.data4G         = NULL;                                                                   // Resetting float4G object...
+  loc_step.buffer         = NULL;                                                                   // Resetting shared buffer...
+  loc_step.vbo            = NULL;                                                                   // Resetting shared VBO...
+  loc_step.components     = 0;                                                                      // Resetting number of components...
+  loc_step.layout         = 0;                                                                      // Resetting layout index...
+  loc_step.bytes          = 0;                                                                      // Resetting transferred data...
+  loc_step.name           = loc_kernel->kernel_file_name.back () + ":" + loc_kernel->kernel_name; // Setting profiling entry name...
+
+  loc_step.local[0]       = 0;                                                                      // Resetting local size (i-index)...
+  loc_step.local[1]       = 1;                                                                      // Resetting local size (j-index)...
+  loc_step.local[2]       = 1;                                                                      // Resetting local size (k-index)...
+  loc_step.dimension      = loc_kernel->get_size (loc_step.global, loc_step.local);                 // Getting kernel dimension, global and local sizes...
+  loc_step.explicit_local = (loc_kernel->local_i > 0);                                              // Setting explicit local size flag...
+
+  for(i = 0; i < loc_kernel->argument_bytes.size (); i++)                                           // Scanning kernel arguments...
+  {
+    loc_step.bytes += loc_kernel->argument_bytes[i];                                                // Accumulating argument size...
+  }
+
+  step.push_back (loc_step);                                                                        // Recording step...
+}
+
+void pipeline::add_shared
+(
+ step_type loc_type,                                                                                // Step type.
+ float1G*  loc_data1G,                                                                              // float1G object (NULL = none).
+ float4G*  loc_data4G,                                                                              // float4G object (NULL = none).
+ GLuint    loc_layout_index                                                                         // OpenGL shader layout index.
+)
+{
+  step_structure loc_step;                                                                          // Recorded step.
+
+  loc_step.type           = loc_type;                                                               // Setting step type...
+  loc_step.step_kernel    = NULL;                                                                   // Resetting step kernel...
+  loc_step.dimension      = 0;                                                                      // Resetting kernel dimension...
+  loc_step.explicit_local = false;                                                                  // Resetting explicit local size flag...
+  loc_step.data1G         = loc_data1G;                                                             // Setting float1G object...
+  loc_step.data4G         = loc_data4G;                                                             // Setting float4G object...
+  loc_step.layout         = loc_layout_index;                                                       // Setting layout index...
+  loc_step.bytes          = 0;                                                                      // Resetting transferred data...
+
+  if(loc_data1G != NULL)                                                                            // Checking for float1G object...
+  {
+    if(loc_layout_index != loc_data1G->layout)                                                      // Checking layout index...
+    {
+      baseline->error ("Layout index mismatch!");                                                   // Printing message...
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
+
+    loc_step.buffer     = &loc_data1G->buffer;                                                      // Setting shared buffer...
+    loc_step.vbo        = &loc_data1G->vbo;                                                         // Setting shared VBO...
+    loc_step.components = 1;                                                                        // Setting number of components...
+    loc_step.name       = std::string ((loc_type == NU_STEP_ACQUIRE) ? "acquire" : "release") +
+                          " float1G #" + std::to_string (loc_layout_index);                         // Setting profiling entry name...
+  }
+
+  else
+  {
+    if(loc_layout_index != loc_data4G->layout)                                                      // Checking layout index...
+    {
+      baseline->error ("Layout index mismatch!");                                                   // Printing message...
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
+
+    loc_step.buffer     = &loc_data4G->buffer;                                                      // Setting shared buffer...
+    loc_step.vbo        = &loc_data4G->vbo;                                                         // Setting shared VBO...
+    loc_step.components = 4;                                                                        // Setting number of components...
+    loc_step.name       = std::string ((loc_type == NU_STEP_ACQUIRE) ? "acquire" : "release") +
+                          " float4G #" + std::to_string (loc_layout_index);                         // Setting profiling entry name...
+  }
+
+  shared = true;                                                                                    // Setting OpenCL/GL shared objects flag...
+  step.push_back (loc_step);                                                                        // Recording step...
+}
+
+void pipeline::acquire
+(
+ float1G* loc_data,                                                                                 // Data object.
+ GLuint   loc_layout_index                                                                          // OpenGL shader layout index.
+)
+{
+  add_shared (NU_STEP_ACQUIRE, loc_data, NULL, loc_layout_index);                                   // Recording acquire step...
+}
+
+void pipeline::acquire
+(
+ float4G* loc_data,                                                                                 // Data object.
+ GLuint   loc_layout_index                                                                          // OpenGL shader layout index.
+)
+{
+  add_shared (NU_STEP_ACQUIRE, NULL, loc_data, loc_layout_index);                                   // Recording acquire step...
+}
+
+void pipeline::release
+(
+ float1G* loc_data,                                                                                 // Data object.
+ GLuint   loc_layout_index                                                                          // OpenGL shader layout index.
+)
+{
+  add_shared (NU_STEP_RELEASE, loc_data, NULL, loc_layout_index);                                   // Recording release step...
+}
+
+void pipeline::release
+(
+ float4G* loc_data,                                                                                 // Data object.
+ GLuint   loc_layout_index                                                                          // OpenGL shader layout index.
+)
+{
+  add_shared (NU_STEP_RELEASE, NULL, loc_data, loc_layout_index);                                   // Recording release step...
+}
+
+void pipeline::enqueue
+(
+ step_structure& loc_step                                                                           // Recorded step.
+)
+{
+  cl_int   loc_error = CL_SUCCESS;                                                                  // Error code.
+  cl_event loc_event = NULL;                                                                        // Profiling event.
+
+  switch(loc_step.type)
+  {
+    case NU_STEP_KERNEL:
+      loc_step.step_kernel->reload ();                                                              // Swapping in hot reloaded kernel, if any...
+
+      // Enqueueing OpenCL kernel:
+      loc_error = clEnqueueNDRangeKernel
+                  (
+                   pipeline_queue->queue_id,                                                        // Queue ID.
+                   loc_step.step_kernel->kernel_id,                                                 // Kernel ID.
+                   loc_step.dimension,                                                              // Kernel dimension.
+                   NULL,                                                                            // Global work offset.
+                   loc_step.global,                                                                 // Global work size.
+                   loc_step.explicit_local ? loc_step.local : NULL,                                 // Local work size.
+                   0,                                                                               // Number of events.
+                   NULL,                                                                            // Event list.
+                   baseline->profile (&loc_event)                                                   // Event.
+                  );
+      break;
+
+    case NU_STEP_ACQUIRE:
+      if(!baseline->interop)                                                                        // Checking for interoperability...
+      {
+        if(loc_step.data1G != NULL)
+        {
+          pipeline_queue->acquire (loc_step.data1G, loc_step.layout);                               // Acquiring through host memory...
+        }
+
+        else
+        {
+          pipeline_queue->acquire (loc_step.data4G, loc_step.layout);                               // Acquiring through host memory...
+        }
+
+        return;
+      }
+
+      // Acquiring OpenCL buffer:
+      loc_error = clEnqueueAcquireGLObjects
+                  (
+                   pipeline_queue->queue_id,                                                        // Queue.
+                   1,                                                                               // Number of memory objects.
+                   loc_step.buffer,                                                                 // Memory object array.
+                   0,                                                                               // Number of events in event list.
+                   NULL,                                                                            // Event list.
+                   baseline->profile (&loc_event)                                                   // Event.
+                  );
+      break;
+
+    case NU_STEP_RELEASE:
+      if(!baseline->interop)                                                                        // Checking for interoperability...
+      {
+        if(loc_step.data1G != NULL)
+        {
+          pipeline_queue->release (loc_step.data1G, loc_step.layout);                               // Releasing through host memory...
+        }
+
+        else
+        {
+          pipeline_queue->release (loc_step.data4G, loc_step.layout);                               // Releasing through host memory...
+        }
+
+        return;
+      }
+
+      // Releasing OpenCL buffer:
+      loc_error = clEnqueueReleaseGLObjects
+                  (
+                   pipeline_queue->queue_id,                                                        // Queue.
+                   1,                                                                               // Number of memory objects.
+                   loc_step.buffer,                                                                 // Memory object array.
+                   0,                                                                               // Number of events in event list.
+                   NULL,                                                                            // Event list.
+                   baseline->profile (&loc_event)                                                   // Event.
+                  );
+      break;
+  }
+
+  baseline->check_error (loc_error);                                                                // Checking error...
+
+  if(loc_event != NULL)                                                                             // Checking for profiling...
+  {
+    baseline->record (loc_event, loc_step.name, loc_step.bytes);                                    // Recording profiling event...
+  }
+}
+
+void pipeline::run
+(
+ kernel_mode loc_kernel_mode                                                                        // OpenCL kernel mode.
+)
+{
+  run (loc_kernel_mode, 1, NULL);                                                                   // Replaying recorded steps once...
+}
+
+void pipeline::run
+(
+ kernel_mode loc_kernel_mode,                                                                       // OpenCL kernel mode.
+ size_t      loc_steps,                                                                             // Number of replays [#].
+ pingpong*   loc_pingpong                                                                           // Pingpong swapped after each replay (NULL = none).
+)
+{
+  size_t   i;                                                                                       // Index.
+  size_t   n;                                                                                       // Replay index.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
+
+  if(shared && baseline->interop)                                                                   // Checking for OpenCL/GL shared objects...
+  {
+    for(i = 0; i < step.size (); i++)                                                               // Unbinding acquired data arrays...
+    {
+      if(step[i].type == NU_STEP_ACQUIRE)
+      {
+        glDisableVertexAttribArray (step[i].layout);                                                // Unbinding data array...
+      }
+    }
+
+    baseline->gl_finish ();                                                                         // Waiting for OpenGL to finish (once)...
+  }
+
+  for(n = 0; n < loc_steps; n++)                                                                    // Replaying recorded sequence back-to-back...
+  {
+    for(i = 0; i < step.size (); i++)                                                               // Replaying recorded steps...
+    {
+      enqueue (step[i]);                                                                            // Enqueueing step...
+    }
+
+    if(loc_pingpong != NULL)                                                                        // Checking for pingpong...
+    {
+      loc_pingpong->swap ();                                                                        // Swapping states for the next replay...
+    }
+  }
+
+  if(shared && baseline->interop)                                                                   // Checking for OpenCL/GL shared objects...
+  {
+    clFinish (pipeline_queue->queue_id);                                                            // Waiting for OpenCL to finish (once)...
+
+    for(i = 0; i < step.size (); i++)                                                               // Rebinding released data arrays...
+    {
+      if(step[i].type == NU_STEP_RELEASE)
+      {
+        glEnableVertexAttribArray (step[i].layout);                                                 // Binding data array...
+        glBindBuffer (GL_ARRAY_BUFFER, *step[i].vbo);                                               // Binding VBO...
+        glVertexAttribPointer
+        (
+         step[i].layout,                                                                            // VAO index.
+         step[i].components,                                                                        // Number of components of data vector.
+         GL_FLOAT,                                                                                  // Data type.
+         GL_FALSE,                                                                                  // Fixed-point data normalization.
+         0,                                                                                         // Data stride.
+         0                                                                                          // Data offset.
+        );
+      }
+    }
+  }
+
+  else
+  {
+    // Selecting kernel mode:
+    switch(loc_kernel_mode)
+    {
+      case NU_WAIT:
+        clFinish (pipeline_queue->queue_id);                                                        // Waiting for OpenCL to finish...
+        break;
+
+      case NU_DONT_WAIT:
+        clFlush (pipeline_queue->queue_id);                                                         // Submitting commands to the device, without waiting...
+        break;
+
+      default:
+        clFinish (pipeline_queue->queue_id);                                                        // Waiting for OpenCL to finish...
+        break;
+    }
+  }
+
+  baseline->trace_end ("pipeline", loc_span);                                                       // Appending trace span...
+}
+
+pipeline::~pipeline()
+{
+  step.clear ();                                                                                    // Clearing recorded steps...
+}
@@ -22,8 +22,6 @@ size_t platform::get_info_size
   cl_int loc_error;                                                                                 // Error code.
   size_t loc_parameter_size;                                                                        // Parameter size.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-
   // Getting platform information:
   loc_error = clGetPlatformInfo
               (
@@ -50,8 +48,6 @@ std::string platform::get_info_value
   std::string loc_parameter;
   char*       loc_parameter_buffer = new char[loc_parameter_size]();                                // Parameter value.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-
   // Getting platform information:
   loc_error = clGetPlatformInfo
               (
@@ -71,10 +67,13 @@ std::string platform::get_info_value
 
 void platform::init
 (
+ neutrino*      loc_baseline,                                                                       // Neutrino baseline.
  cl_platform_id loc_platform_id                                                                     // Platform ID.
 )
 {
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline = loc_baseline;                                                                          // Getting Neutrino baseline...
+
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
 
   // Profile info:
   profile = get_info_value
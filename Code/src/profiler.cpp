@@ -0,0 +1,300 @@
+/// @file     profiler.cpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Definition of the "profiler" class.
+
+#include "profiler.hpp"
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// "profiler" class //////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+profiler::profiler()
+{
+  baseline = NULL;                                                                                  // Initializing Neutrino baseline...
+  seed     = 88172645463325252ULL;                                                                  // Initializing reservoir sampling random state...
+}
+
+void profiler::init
+(
+ neutrino* loc_baseline                                                                             // Neutrino baseline.
+)
+{
+  baseline = loc_baseline;                                                                          // Getting Neutrino baseline...
+  baseline->action ("initializing OpenCL event profiler...");                                       // Printing message...
+
+  baseline->profiling = this;                                                                       // Registering profiler in Neutrino baseline...
+
+  baseline->done ();                                                                                // Printing message...
+}
+
+void profiler::resolve
+(
+ bool loc_wait                                                                                      // Wait for completion flag.
+)
+{
+  size_t   i;                                                                                       // Index.
+  size_t   j;                                                                                       // Index.
+  cl_int   loc_status;                                                                              // Event execution status.
+  cl_ulong loc_queued;                                                                              // QUEUED timestamp [ns].
+  cl_ulong loc_submit;                                                                              // SUBMIT timestamp [ns].
+  cl_ulong loc_start;                                                                               // START timestamp [ns].
+  cl_ulong loc_end;                                                                                 // END timestamp [ns].
+
+  if(loc_wait && !pending_event.empty ())                                                           // Checking for events to be waited for...
+  {
+    clWaitForEvents ((cl_uint)pending_event.size (), pending_event.data ());                        // Waiting for all pending events...
+  }
+
+  j = 0;                                                                                            // Resetting index of events still pending...
+
+  for(i = 0; i < pending_event.size (); i++)                                                        // Scanning pending events...
+  {
+    // Getting event execution status:
+    clGetEventInfo
+    (
+     pending_event[i],                                                                              // OpenCL event.
+     CL_EVENT_COMMAND_EXECUTION_STATUS,                                                             // Parameter name.
+     sizeof(cl_int),                                                                                // Parameter size.
+     &loc_status,                                                                                   // Parameter value.
+     NULL                                                                                           // Returned parameter size.
+    );
+
+    if(loc_status == CL_COMPLETE)                                                                   // Checking for completed event...
+    {
+      // Getting event timestamps:
+      loc_submit = 0;                                                                               // Resetting SUBMIT timestamp (not reported by some drivers)...
+      clGetEventProfilingInfo (pending_event[i], CL_PROFILING_COMMAND_QUEUED, sizeof(cl_ulong), &loc_queued, NULL);
+      clGetEventProfilingInfo (pending_event[i], CL_PROFILING_COMMAND_SUBMIT, sizeof(cl_ulong), &loc_submit, NULL);
+      clGetEventProfilingInfo (pending_event[i], CL_PROFILING_COMMAND_START, sizeof(cl_ulong), &loc_start, NULL);
+      clGetEventProfilingInfo (pending_event[i], CL_PROFILING_COMMAND_END, sizeof(cl_ulong), &loc_end, NULL);
+
+      add (pending_entry[i], loc_queued, loc_submit, loc_start, loc_end, pending_bytes[i]);         // Adding sample...
+      clReleaseEvent (pending_event[i]);                                                            // Releasing event...
+    }
+
+    else
+    {
+      pending_event[j] = pending_event[i];                                                          // Keeping event...
+      pending_entry[j] = pending_entry[i];                                                          // Keeping entry index...
+      pending_bytes[j] = pending_bytes[i];                                                          // Keeping transferred data...
+      j++;                                                                                          // Advancing index of events still pending...
+    }
+  }
+
+  pending_event.resize (j);                                                                         // Dropping resolved events...
+  pending_entry.resize (j);                                                                         // Dropping resolved entry indexes...
+  pending_bytes.resize (j);                                                                         // Dropping resolved transferred data...
+}
+
+double profiler::percentile
+(
+ std::vector<double>& loc_sorted,                                                                   // Sorted durations [ns].
+ double               loc_percentile                                                                // Percentile [0...1].
+)
+{
+  size_t loc_rank;                                                                                  // Nearest rank [#].
+
+  if(loc_sorted.empty ())                                                                           // Checking for samples...
+  {
+    return 0.0;                                                                                     // Returning null percentile...
+  }
+
+  loc_rank = (size_t)ceil (loc_percentile*loc_sorted.size ());                                      // Computing nearest rank...
+  loc_rank = std::max (loc_rank, (size_t)1);                                                        // Constraining nearest rank...
+
+  return loc_sorted[loc_rank - 1];                                                                  // Returning percentile...
+}
+
+void profiler::add
+(
+ size_t   loc_entry,                                                                                // Statistics entry index [#].
+ cl_ulong loc_queued,                                                                               // QUEUED timestamp [ns].
+ cl_ulong loc_submit,                                                                               // SUBMIT timestamp [ns].
+ cl_ulong loc_start,                                                                                // START timestamp [ns].
+ cl_ulong loc_end,                                                                                  // END timestamp [ns].
+ size_t   loc_bytes                                                                                 // Transferred data [bytes].
+)
+{
+  entry_structure& loc_aggregate = entry[loc_entry];                                                // Statistics entry.
+  double           loc_duration  = (double)(loc_end - loc_start);                                   // Device time [ns].
+  size_t           loc_slot;                                                                        // Reservoir slot.
+
+  loc_submit = std::min (std::max (loc_submit, loc_queued), loc_start);                             // Clamping SUBMIT timestamp...
+
+  loc_aggregate.count++;                                                                            // Counting sample...
+  loc_aggregate.total     += loc_duration;                                                          // Accumulating device time...
+  loc_aggregate.queued    += (double)(loc_submit - loc_queued);                                     // Accumulating host latency...
+  loc_aggregate.submitted += (double)(loc_start - loc_submit);                                      // Accumulating device latency...
+  loc_aggregate.bytes     += (double)loc_bytes;                                                     // Accumulating transferred data...
+
+  if(loc_aggregate.reservoir.size () < NU_PROFILER_RESERVOIR)                                       // Checking reservoir size...
+  {
+    loc_aggregate.reservoir.push_back (loc_duration);                                               // Keeping sample...
+    return;
+  }
+
+  // Advancing random state (xorshift64):
+  seed    ^= seed << 13;
+  seed    ^= seed >> 7;
+  seed    ^= seed << 17;
+  loc_slot = (size_t)(seed % loc_aggregate.count);                                                  // Getting random slot...
+
+  if(loc_slot < NU_PROFILER_RESERVOIR)                                                              // Checking for replacement...
+  {
+    loc_aggregate.reservoir[loc_slot] = loc_duration;                                               // Replacing kept sample...
+  }
+}
+
+void profiler::statistics
+(
+ size_t  loc_entry,                                                                                 // Statistics entry index [#].
+ size_t& loc_count,                                                                                 // Number of samples [#].
+ double& loc_mean,                                                                                  // Mean device time [ns].
+ double& loc_p50,                                                                                   // Median device time [ns].
+ double& loc_p99,                                                                                   // 99th percentile device time [ns].
+ double& loc_queued,                                                                                // Mean host latency (QUEUED to SUBMIT) [ns].
+ double& loc_submitted,                                                                             // Mean device latency (SUBMIT to START) [ns].
+ double& loc_bandwidth                                                                              // Achieved bandwidth [GB/s].
+)
+{
+  std::vector<double> loc_duration = entry[loc_entry].reservoir;                                    // Device times [ns].
+  double              loc_total    = entry[loc_entry].total;                                        // Total device time [ns].
+
+  std::sort (loc_duration.begin (), loc_duration.end ());                                           // Sorting device times...
+
+  loc_count     = entry[loc_entry].count;                                                           // Getting number of samples...
+  loc_mean      = (loc_count > 0) ? loc_total/loc_count : 0.0;                                      // Computing mean device time...
+  loc_queued    = (loc_count > 0) ? entry[loc_entry].queued/loc_count : 0.0;                        // Computing mean host latency...
+  loc_submitted = (loc_count > 0) ? entry[loc_entry].submitted/loc_count : 0.0;                     // Computing mean device latency...
+  loc_p50       = percentile (loc_duration, 0.50);                                                  // Computing median device time...
+  loc_p99       = percentile (loc_duration, 0.99);                                                  // Computing 99th percentile device time...
+  loc_bandwidth = (loc_total > 0.0) ? entry[loc_entry].bytes/loc_total : 0.0;                       // Computing bandwidth (bytes/ns = GB/s)...
+}
+
+void profiler::record
+(
+ cl_event    loc_event,                                                                             // OpenCL event.
+ std::string loc_name,                                                                              // Statistics entry name.
+ size_t      loc_bytes                                                                              // Transferred data [bytes].
+)
+{
+  std::map<std::string, size_t>::iterator loc_entry;                                                // Statistics entry.
+
+  loc_entry = entry_index.find (loc_name);                                                          // Looking for statistics entry...
+
+  if(loc_entry == entry_index.end ())                                                               // Checking for new entry...
+  {
+    loc_entry = entry_index.insert (std::make_pair (loc_name, entry_name.size ())).first;           // Adding entry...
+    entry_name.push_back (loc_name);                                                                // Adding entry name...
+    entry.push_back ({0, 0.0, 0.0, 0.0, 0.0, std::vector<double> ()});                              // Adding entry aggregates...
+  }
+
+  pending_event.push_back (loc_event);                                                              // Storing event...
+  pending_entry.push_back (loc_entry->second);                                                      // Storing entry index...
+  pending_bytes.push_back (loc_bytes);                                                              // Storing transferred data...
+
+  if(pending_event.size () >= NU_PROFILER_PENDING)                                                  // Checking number of pending events...
+  {
+    resolve (false);                                                                                // Resolving completed events (not blocking)...
+  }
+}
+
+void profiler::report ()
+{
+  size_t i;                                                                                         // Index.
+  size_t loc_count;                                                                                 // Number of samples [#].
+  double loc_mean;                                                                                  // Mean device time [ns].
+  double loc_p50;                                                                                   // Median device time [ns].
+  double loc_p99;                                                                                   // 99th percentile device time [ns].
+  double loc_queued;                                                                                // Mean host latency [ns].
+  double loc_submitted;                                                                             // Mean device latency [ns].
+  double loc_bandwidth;                                                                             // Achieved bandwidth [GB/s].
+  char   loc_line[NU_MAX_TEXT_SIZE*2];                                                              // Text line.
+
+  resolve (true);                                                                                   // Resolving all pending events...
+
+  std::cout << std::endl;                                                                           // Printing message...
+  snprintf (loc_line, sizeof(loc_line), "%-40s %10s %12s %12s %12s %12s %12s %10s",
+            "name", "count", "mean [us]", "p50 [us]", "p99 [us]", "queue [us]", "submit [us]", "BW [GB/s]");
+  std::cout << NU_COLOR_CYAN << loc_line << NU_COLOR_NORMAL << std::endl;                           // Printing table header...
+
+  for(i = 0; i < entry_name.size (); i++)                                                           // Scanning statistics entries...
+  {
+    statistics (i, loc_count, loc_mean, loc_p50, loc_p99, loc_queued, loc_submitted, loc_bandwidth); // Computing statistics...
+    snprintf (loc_line, sizeof(loc_line), "%-40.40s %10zu %12.3f %12.3f %12.3f %12.3f %12.3f %10.3f",
+              entry_name[i].c_str (), loc_count, loc_mean/1000.0, loc_p50/1000.0, loc_p99/1000.0,
+              loc_queued/1000.0, loc_submitted/1000.0, loc_bandwidth);
+    std::cout << loc_line << std::endl;                                                             // Printing table line...
+  }
+}
+
+void profiler::save
+(
+ std::string loc_file_directory,                                                                    // File directory.
+ std::string loc_file_name                                                                          // File name.
+)
+{
+  size_t        i;                                                                                  // Index.
+  size_t        loc_count;                                                                          // Number of samples [#].
+  double        loc_mean;                                                                           // Mean device time [ns].
+  double        loc_p50;                                                                            // Median device time [ns].
+  double        loc_p99;                                                                            // 99th percentile device time [ns].
+  double        loc_queued;                                                                         // Mean host latency [ns].
+  double        loc_submitted;                                                                      // Mean device latency [ns].
+  double        loc_bandwidth;                                                                      // Achieved bandwidth [GB/s].
+  std::string   loc_full_name;                                                                      // Full file name.
+  std::ofstream loc_file;                                                                           // File.
+
+  baseline->action ("saving profiling statistics...");                                              // Printing message...
+
+  #ifdef __linux__
+    loc_full_name = loc_file_directory +                                                            // Data directory.
+                    std::string ("/") +                                                             // Slash.
+                    loc_file_name;                                                                  // Data file name.
+  #endif
+
+  #ifdef __APPLE__
+    loc_full_name = loc_file_directory +                                                            // Data directory.
+                    std::string ("/") +                                                             // Slash.
+                    loc_file_name;                                                                  // Data file name.
+  #endif
+
+  #ifdef WIN32
+    loc_full_name = loc_file_directory +                                                            // Data directory.
+                    std::string ("\\") +                                                            // Backslash.
+                    loc_file_name;                                                                  // Data file name.
+  #endif
+
+  resolve (true);                                                                                   // Resolving all pending events...
+
+  loc_file.open (loc_full_name);                                                                    // Opening file...
+
+  if(!loc_file)                                                                                     // Checking file...
+  {
+    baseline->error ("Cannot open profiling statistics file!");                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  loc_file << "name,count,mean_ns,p50_ns,p99_ns,queue_ns,submit_ns,bandwidth_GBps" << std::endl;    // Writing CSV header...
+
+  for(i = 0; i < entry_name.size (); i++)                                                           // Scanning statistics entries...
+  {
+    statistics (i, loc_count, loc_mean, loc_p50, loc_p99, loc_queued, loc_submitted, loc_bandwidth); // Computing statistics...
+    loc_file << "\"" << entry_name[i] << "\"," << loc_count << "," << loc_mean << "," << loc_p50 << ","
+             << loc_p99 << "," << loc_queued << "," << loc_submitted << "," << loc_bandwidth << std::endl; // Writing CSV line...
+  }
+
+  loc_file.close ();                                                                                // Closing file...
+
+  baseline->done ();                                                                                // Printing message...
+}
+
+profiler::~profiler()
+{
+  if(baseline != NULL)                                                                              // Checking initialization...
+  {
+    report ();                                                                                      // Printing statistics...
+
+    baseline->profiling = NULL;                                                                     // Unregistering profiler from Neutrino baseline...
+  }
+}
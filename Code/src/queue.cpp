@@ -19,23 +19,34 @@ void queue::init
 (
  neutrino* loc_baseline
 )
+{
+  init (loc_baseline, loc_baseline->device_id);                                                     // Creating queue on the selected device...
+}
+
+void queue::init
+(
+ neutrino*    loc_baseline,                                                                         // Neutrino baseline.
+ cl_device_id loc_device_id                                                                         // Device ID.
+)
 {
   cl_int loc_error;                                                                                 // Local error code.
 
   baseline   = loc_baseline;                                                                        // Getting Neutrino baseline...
   baseline->action ("creating OpenCL command queue...");                                            // Printing message...
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
 
   context_id = baseline->context_id;                                                                // Initializing context id...
-  device_id  = baseline->device_id;                                                                 // Initializing device id...
+  device_id  = loc_device_id;                                                                       // Initializing device id...
 
   // Creating OpenCL queue:
   queue_id   = clCreateCommandQueue
                (
                 context_id,                                                                         // OpenCL context ID.
                 device_id,                                                                          // Device ID.
-                0,                                                                                  // Queue properties (con be used for enabling profiling).
+                ((baseline->profiling != NULL) ||                                                   // Checking for profiling...
+                 (baseline->tracing != NULL) ||                                                     // Checking for tracing...
+                 (baseline->device_list.size () > 1)) ? CL_QUEUE_PROFILING_ENABLE : 0,              // Queue properties (enabling profiling, if requested or for multi-device balancing).
                 &loc_error
                );                                                                                   // Error code.
 
@@ -55,9 +66,11 @@ void queue::read
  cl_uint loc_layout_index                                                                           // Layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Local error code.
+  cl_int   loc_error;                                                                               // Local error code.
+  cl_event loc_event = NULL;                                                                        // Profiling event.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 
   // Checking layout index:
@@ -78,12 +91,26 @@ void queue::read
                loc_data->data,                                                                      // Data buffer.
                0,                                                                                   // Number of events in the list.
                NULL,                                                                                // Event list.
-               NULL                                                                                 // Event.
+               baseline->profile (&loc_event)                                                       // Event.
               );
 
   baseline->check_error (loc_error);
 
+  if(loc_event != NULL)                                                                             // Checking for profiling...
+  {
+    baseline->record
+    (
+     loc_event,                                                                                     // Profiling event.
+     "read int1 #" + std::to_string (loc_layout_index),                                             // Profiling entry name.
+     sizeof(cl_long)*loc_data->size                                                                 // Transferred data [bytes].
+    );
+
+    loc_event = NULL;                                                                               // Resetting profiling event...
+  }
+
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+
+  baseline->trace_end ("read", loc_span);                                                           // Appending trace span...
 };
 
 void queue::read
@@ -92,9 +119,11 @@ void queue::read
  cl_uint loc_layout_index                                                                           // Layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Local error code.
+  cl_int   loc_error;                                                                               // Local error code.
+  cl_event loc_event = NULL;                                                                        // Profiling event.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 
   // Checking layout index:
@@ -115,12 +144,26 @@ void queue::read
                loc_data->data,                                                                      // Data buffer.
                0,                                                                                   // Number of events in the list.
                NULL,                                                                                // Event list.
-               NULL                                                                                 // Event.
+               baseline->profile (&loc_event)                                                       // Event.
               );
 
   baseline->check_error (loc_error);
 
+  if(loc_event != NULL)                                                                             // Checking for profiling...
+  {
+    baseline->record
+    (
+     loc_event,                                                                                     // Profiling event.
+     "read int2 #" + std::to_string (loc_layout_index),                                             // Profiling entry name.
+     sizeof(int2_structure)*loc_data->size                                                          // Transferred data [bytes].
+    );
+
+    loc_event = NULL;                                                                               // Resetting profiling event...
+  }
+
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+
+  baseline->trace_end ("read", loc_span);                                                           // Appending trace span...
 };
 
 void queue::read
@@ -129,9 +172,11 @@ void queue::read
  cl_uint loc_layout_index                                                                           // Layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Local error code.
+  cl_int   loc_error;                                                                               // Local error code.
+  cl_event loc_event = NULL;                                                                        // Profiling event.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 
   // Checking layout index:
@@ -152,12 +197,26 @@ void queue::read
                loc_data->data,                                                                      // Data buffer.
                0,                                                                                   // Number of events in the list.
                NULL,                                                                                // Event list.
-               NULL                                                                                 // Event.
+               baseline->profile (&loc_event)                                                       // Event.
               );
 
   baseline->check_error (loc_error);
 
+  if(loc_event != NULL)                                                                             // Checking for profiling...
+  {
+    baseline->record
+    (
+     loc_event,                                                                                     // Profiling event.
+     "read int3 #" + std::to_string (loc_layout_index),                                             // Profiling entry name.
+     sizeof(int3_structure)*loc_data->size                                                          // Transferred data [bytes].
+    );
+
+    loc_event = NULL;                                                                               // Resetting profiling event...
+  }
+
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+
+  baseline->trace_end ("read", loc_span);                                                           // Appending trace span...
 };
 
 void queue::read
@@ -166,9 +225,11 @@ void queue::read
  cl_uint loc_layout_index                                                                           // Layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Local error code.
+  cl_int   loc_error;                                                                               // Local error code.
+  cl_event loc_event = NULL;                                                                        // Profiling event.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 
   // Checking layout index:
@@ -189,12 +250,26 @@ void queue::read
                loc_data->data,                                                                      // Data buffer.
                0,                                                                                   // Number of events in the list.
                NULL,                                                                                // Event list.
-               NULL                                                                                 // Event.
+               baseline->profile (&loc_event)                                                       // Event.
               );
 
   baseline->check_error (loc_error);
 
+  if(loc_event != NULL)                                                                             // Checking for profiling...
+  {
+    baseline->record
+    (
+     loc_event,                                                                                     // Profiling event.
+     "read int4 #" + std::to_string (loc_layout_index),                                             // Profiling entry name.
+     sizeof(int4_structure)*loc_data->size                                                          // Transferred data [bytes].
+    );
+
+    loc_event = NULL;                                                                               // Resetting profiling event...
+  }
+
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+
+  baseline->trace_end ("read", loc_span);                                                           // Appending trace span...
 };
 
 void queue::read
@@ -203,9 +278,11 @@ void queue::read
  cl_uint loc_layout_index                                                                           // Layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Local error code.
+  cl_int   loc_error;                                                                               // Local error code.
+  cl_event loc_event = NULL;                                                                        // Profiling event.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 
   // Checking layout index:
@@ -226,12 +303,26 @@ void queue::read
                loc_data->data,                                                                      // Data buffer.
                0,                                                                                   // Number of events in the list.
                NULL,                                                                                // Event list.
-               NULL                                                                                 // Event.
+               baseline->profile (&loc_event)                                                       // Event.
               );
 
   baseline->check_error (loc_error);
 
+  if(loc_event != NULL)                                                                             // Checking for profiling...
+  {
+    baseline->record
+    (
+     loc_event,                                                                                     // Profiling event.
+     "read float1 #" + std::to_string (loc_layout_index),                                           // Profiling entry name.
+     sizeof(cl_float)*loc_data->size                                                                // Transferred data [bytes].
+    );
+
+    loc_event = NULL;                                                                               // Resetting profiling event...
+  }
+
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+
+  baseline->trace_end ("read", loc_span);                                                           // Appending trace span...
 };
 
 void queue::read
@@ -240,9 +331,11 @@ void queue::read
  cl_uint  loc_layout_index                                                                          // Layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Local error code.
+  cl_int   loc_error;                                                                               // Local error code.
+  cl_event loc_event = NULL;                                                                        // Profiling event.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 
   // Checking layout index:
@@ -272,11 +365,23 @@ void queue::read
                loc_data->data,                                                                      // Data buffer.
                0,                                                                                   // Number of events in the list.
                NULL,                                                                                // Event list.
-               NULL                                                                                 // Event.
+               baseline->profile (&loc_event)                                                       // Event.
               );
 
   baseline->check_error (loc_error);                                                                // Checking error...
 
+  if(loc_event != NULL)                                                                             // Checking for profiling...
+  {
+    baseline->record
+    (
+     loc_event,                                                                                     // Profiling event.
+     "read float1G #" + std::to_string (loc_layout_index),                                          // Profiling entry name.
+     sizeof(GLfloat)*loc_data->size                                                                 // Transferred data [bytes].
+    );
+
+    loc_event = NULL;                                                                               // Resetting profiling event...
+  }
+
   if(baseline->interop)                                                                             // Checking for interoperability...
   {
     // Releasing OpenGL buffer:
@@ -288,6 +393,8 @@ void queue::read
   }
 
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+
+  baseline->trace_end ("read", loc_span);                                                           // Appending trace span...
 };
 
 void queue::read
@@ -296,9 +403,11 @@ void queue::read
  cl_uint loc_layout_index                                                                           // Layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Local error code.
+  cl_int   loc_error;                                                                               // Local error code.
+  cl_event loc_event = NULL;                                                                        // Profiling event.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 
   // Checking layout index:
@@ -319,12 +428,26 @@ void queue::read
                loc_data->data,                                                                      // Data buffer.
                0,                                                                                   // Number of events in the list.
                NULL,                                                                                // Event list.
-               NULL                                                                                 // Event.
+               baseline->profile (&loc_event)                                                       // Event.
               );
 
   baseline->check_error (loc_error);
 
+  if(loc_event != NULL)                                                                             // Checking for profiling...
+  {
+    baseline->record
+    (
+     loc_event,                                                                                     // Profiling event.
+     "read float2 #" + std::to_string (loc_layout_index),                                           // Profiling entry name.
+     sizeof(float2_structure)*loc_data->size                                                        // Transferred data [bytes].
+    );
+
+    loc_event = NULL;                                                                               // Resetting profiling event...
+  }
+
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+
+  baseline->trace_end ("read", loc_span);                                                           // Appending trace span...
 };
 
 void queue::read
@@ -333,9 +456,11 @@ void queue::read
  cl_uint loc_layout_index                                                                           // Layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Local error code.
+  cl_int   loc_error;                                                                               // Local error code.
+  cl_event loc_event = NULL;                                                                        // Profiling event.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 
   // Checking layout index:
@@ -356,12 +481,26 @@ void queue::read
                loc_data->data,                                                                      // Data buffer.
                0,                                                                                   // Number of events in the list.
                NULL,                                                                                // Event list.
-               NULL                                                                                 // Event.
+               baseline->profile (&loc_event)                                                       // Event.
               );
 
   baseline->check_error (loc_error);
 
+  if(loc_event != NULL)                                                                             // Checking for profiling...
+  {
+    baseline->record
+    (
+     loc_event,                                                                                     // Profiling event.
+     "read float3 #" + std::to_string (loc_layout_index),                                           // Profiling entry name.
+     sizeof(float3_structure)*loc_data->size                                                        // Transferred data [bytes].
+    );
+
+    loc_event = NULL;                                                                               // Resetting profiling event...
+  }
+
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+
+  baseline->trace_end ("read", loc_span);                                                           // Appending trace span...
 };
 
 void queue::read
@@ -370,9 +509,11 @@ void queue::read
  cl_uint loc_layout_index                                                                           // Layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Local error code.
+  cl_int   loc_error;                                                                               // Local error code.
+  cl_event loc_event = NULL;                                                                        // Profiling event.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 
   // Checking layout index:
@@ -393,12 +534,26 @@ void queue::read
                loc_data->data,                                                                      // Data buffer.
                0,                                                                                   // Number of events in the list.
                NULL,                                                                                // Event list.
-               NULL                                                                                 // Event.
+               baseline->profile (&loc_event)                                                       // Event.
               );
 
   baseline->check_error (loc_error);
 
+  if(loc_event != NULL)                                                                             // Checking for profiling...
+  {
+    baseline->record
+    (
+     loc_event,                                                                                     // Profiling event.
+     "read float4 #" + std::to_string (loc_layout_index),                                           // Profiling entry name.
+     sizeof(float4_structure)*loc_data->size                                                        // Transferred data [bytes].
+    );
+
+    loc_event = NULL;                                                                               // Resetting profiling event...
+  }
+
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+
+  baseline->trace_end ("read", loc_span);                                                           // Appending trace span...
 };
 
 void queue::read
@@ -407,9 +562,11 @@ void queue::read
  cl_uint  loc_layout_index                                                                          // Layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Local error code.
+  cl_int   loc_error;                                                                               // Local error code.
+  cl_event loc_event = NULL;                                                                        // Profiling event.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 
   // Checking layout index:
@@ -439,11 +596,23 @@ void queue::read
                loc_data->data,                                                                      // Data buffer.
                0,                                                                                   // Number of events in the list.
                NULL,                                                                                // Event list.
-               NULL                                                                                 // Event.
+               baseline->profile (&loc_event)                                                       // Event.
               );
 
   baseline->check_error (loc_error);                                                                // Checking error...
 
+  if(loc_event != NULL)                                                                             // Checking for profiling...
+  {
+    baseline->record
+    (
+     loc_event,                                                                                     // Profiling event.
+     "read float4G #" + std::to_string (loc_layout_index),                                          // Profiling entry name.
+     sizeof(float4G_structure)*loc_data->size                                                       // Transferred data [bytes].
+    );
+
+    loc_event = NULL;                                                                               // Resetting profiling event...
+  }
+
   if(baseline->interop)                                                                             // Checking for interoperability...
   {
     // Releasing OpenGL buffer:
@@ -455,6 +624,8 @@ void queue::read
   }
 
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+
+  baseline->trace_end ("read", loc_span);                                                           // Appending trace span...
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -466,9 +637,11 @@ void queue::write
  cl_uint loc_layout_index                                                                           // Layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Local error code.
+  cl_int   loc_error;                                                                               // Local error code.
+  cl_event loc_event = NULL;                                                                        // Profiling event.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 
   // Checking layout index:
@@ -489,12 +662,28 @@ void queue::write
                loc_data->data,                                                                      // Data buffer.
                0,                                                                                   // Number of events in the list.
                NULL,                                                                                // Event list.
-               NULL                                                                                 // Event.
+               baseline->profile (&loc_event)                                                       // Event.
               );
 
   baseline->check_error (loc_error);
 
+  if(loc_event != NULL)                                                                             // Checking for profiling...
+  {
+    baseline->record
+    (
+     loc_event,                                                                                     // Profiling event.
+     "write int1 #" + std::to_string (loc_layout_index),                                            // Profiling entry name.
+     sizeof(cl_long)*loc_data->size                                                                 // Transferred data [bytes].
+    );
+
+    loc_event = NULL;                                                                               // Resetting profiling event...
+  }
+
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+
+  loc_data->dirty.clear ();                                                                         // Clearing dirty ranges (whole data uploaded)...
+
+  baseline->trace_end ("write", loc_span);                                                          // Appending trace span...
 };
 
 void queue::write
@@ -503,9 +692,11 @@ void queue::write
  cl_uint loc_layout_index                                                                           // Layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Local error code.
+  cl_int   loc_error;                                                                               // Local error code.
+  cl_event loc_event = NULL;                                                                        // Profiling event.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 
   // Checking layout index:
@@ -526,12 +717,28 @@ void queue::write
                loc_data->data,                                                                      // Data buffer.
                0,                                                                                   // Number of events in the list.
                NULL,                                                                                // Event list.
-               NULL                                                                                 // Event.
+               baseline->profile (&loc_event)                                                       // Event.
               );
 
   baseline->check_error (loc_error);
 
+  if(loc_event != NULL)                                                                             // Checking for profiling...
+  {
+    baseline->record
+    (
+     loc_event,                                                                                     // Profiling event.
+     "write int2 #" + std::to_string (loc_layout_index),                                            // Profiling entry name.
+     sizeof(int2_structure)*loc_data->size                                                          // Transferred data [bytes].
+    );
+
+    loc_event = NULL;                                                                               // Resetting profiling event...
+  }
+
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+
+  loc_data->dirty.clear ();                                                                         // Clearing dirty ranges (whole data uploaded)...
+
+  baseline->trace_end ("write", loc_span);                                                          // Appending trace span...
 };
 
 void queue::write
@@ -540,9 +747,11 @@ void queue::write
  cl_uint loc_layout_index                                                                           // Layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Local error code.
+  cl_int   loc_error;                                                                               // Local error code.
+  cl_event loc_event = NULL;                                                                        // Profiling event.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 
   // Checking layout index:
@@ -563,12 +772,28 @@ void queue::write
                loc_data->data,                                                                      // Data buffer.
                0,                                                                                   // Number of events in the list.
                NULL,                                                                                // Event list.
-               NULL                                                                                 // Event.
+               baseline->profile (&loc_event)                                                       // Event.
               );
 
   baseline->check_error (loc_error);
 
+  if(loc_event != NULL)                                                                             // Checking for profiling...
+  {
+    baseline->record
+    (
+     loc_event,                                                                                     // Profiling event.
+     "write int3 #" + std::to_string (loc_layout_index),                                            // Profiling entry name.
+     sizeof(int3_structure)*loc_data->size                                                          // Transferred data [bytes].
+    );
+
+    loc_event = NULL;                                                                               // Resetting profiling event...
+  }
+
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+
+  loc_data->dirty.clear ();                                                                         // Clearing dirty ranges (whole data uploaded)...
+
+  baseline->trace_end ("write", loc_span);                                                          // Appending trace span...
 };
 
 void queue::write
@@ -577,9 +802,11 @@ void queue::write
  cl_uint loc_layout_index                                                                           // Layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Local error code.
+  cl_int   loc_error;                                                                               // Local error code.
+  cl_event loc_event = NULL;                                                                        // Profiling event.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 
   // Checking layout index:
@@ -600,12 +827,28 @@ void queue::write
                loc_data->data,                                                                      // Data buffer.
                0,                                                                                   // Number of events in the list.
                NULL,                                                                                // Event list.
-               NULL                                                                                 // Event.
+               baseline->profile (&loc_event)                                                       // Event.
               );
 
   baseline->check_error (loc_error);
 
+  if(loc_event != NULL)                                                                             // Checking for profiling...
+  {
+    baseline->record
+    (
+     loc_event,                                                                                     // Profiling event.
+     "write int4 #" + std::to_string (loc_layout_index),                                            // Profiling entry name.
+     sizeof(int4_structure)*loc_data->size                                                          // Transferred data [bytes].
+    );
+
+    loc_event = NULL;                                                                               // Resetting profiling event...
+  }
+
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+
+  loc_data->dirty.clear ();                                                                         // Clearing dirty ranges (whole data uploaded)...
+
+  baseline->trace_end ("write", loc_span);                                                          // Appending trace span...
 };
 
 void queue::write
@@ -614,9 +857,11 @@ void queue::write
  cl_uint loc_layout_index                                                                           // Layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Local error code.
+  cl_int   loc_error;                                                                               // Local error code.
+  cl_event loc_event = NULL;                                                                        // Profiling event.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 
   // Checking layout index:
@@ -637,12 +882,28 @@ void queue::write
                loc_data->data,                                                                      // Data buffer.
                0,                                                                                   // Number of events in the list.
                NULL,                                                                                // Event list.
-               NULL                                                                                 // Event.
+               baseline->profile (&loc_event)                                                       // Event.
               );
 
   baseline->check_error (loc_error);
 
+  if(loc_event != NULL)                                                                             // Checking for profiling...
+  {
+    baseline->record
+    (
+     loc_event,                                                                                     // Profiling event.
+     "write float1 #" + std::to_string (loc_layout_index),                                          // Profiling entry name.
+     sizeof(cl_float)*loc_data->size                                                                // Transferred data [bytes].
+    );
+
+    loc_event = NULL;                                                                               // Resetting profiling event...
+  }
+
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+
+  loc_data->dirty.clear ();                                                                         // Clearing dirty ranges (whole data uploaded)...
+
+  baseline->trace_end ("write", loc_span);                                                          // Appending trace span...
 };
 
 void queue::write
@@ -651,9 +912,11 @@ void queue::write
  cl_uint  loc_layout_index                                                                          // Layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Local error code.
+  cl_int   loc_error;                                                                               // Local error code.
+  cl_event loc_event = NULL;                                                                        // Profiling event.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 
   // Checking layout index:
@@ -683,11 +946,23 @@ void queue::write
                loc_data->data,                                                                      // Data buffer.
                0,                                                                                   // Number of events in the list.
                NULL,                                                                                // Event list.
-               NULL                                                                                 // Event.
+               baseline->profile (&loc_event)                                                       // Event.
               );
 
   baseline->check_error (loc_error);                                                                // Checking error...
 
+  if(loc_event != NULL)                                                                             // Checking for profiling...
+  {
+    baseline->record
+    (
+     loc_event,                                                                                     // Profiling event.
+     "write float1G #" + std::to_string (loc_layout_index),                                         // Profiling entry name.
+     sizeof(GLfloat)*loc_data->size                                                                 // Transferred data [bytes].
+    );
+
+    loc_event = NULL;                                                                               // Resetting profiling event...
+  }
+
   if(baseline->interop)                                                                             // Checking for interoperability...
   {
     // Releasing OpenGL buffer:
@@ -699,6 +974,10 @@ void queue::write
   }
 
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+
+  loc_data->dirty.clear ();                                                                         // Clearing dirty ranges (whole data uploaded)...
+
+  baseline->trace_end ("write", loc_span);                                                          // Appending trace span...
 };
 
 void queue::write
@@ -707,9 +986,11 @@ void queue::write
  cl_uint loc_layout_index                                                                           // Layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Local error code.
+  cl_int   loc_error;                                                                               // Local error code.
+  cl_event loc_event = NULL;                                                                        // Profiling event.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 
   // Checking layout index:
@@ -730,12 +1011,28 @@ void queue::write
                loc_data->data,                                                                      // Data buffer.
                0,                                                                                   // Number of events in the list.
                NULL,                                                                                // Event list.
-               NULL                                                                                 // Event.
+               baseline->profile (&loc_event)                                                       // Event.
               );
 
   baseline->check_error (loc_error);
 
+  if(loc_event != NULL)                                                                             // Checking for profiling...
+  {
+    baseline->record
+    (
+     loc_event,                                                                                     // Profiling event.
+     "write float2 #" + std::to_string (loc_layout_index),                                          // Profiling entry name.
+     sizeof(float2_structure)*loc_data->size                                                        // Transferred data [bytes].
+    );
+
+    loc_event = NULL;                                                                               // Resetting profiling event...
+  }
+
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+
+  loc_data->dirty.clear ();                                                                         // Clearing dirty ranges (whole data uploaded)...
+
+  baseline->trace_end ("write", loc_span);                                                          // Appending trace span...
 };
 
 void queue::write
@@ -744,9 +1041,11 @@ void queue::write
  cl_uint loc_layout_index                                                                           // Layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Local error code.
+  cl_int   loc_error;                                                                               // Local error code.
+  cl_event loc_event = NULL;                                                                        // Profiling event.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 
   // Checking layout index:
@@ -767,12 +1066,28 @@ void queue::write
                loc_data->data,                                                                      // Data buffer.
                0,                                                                                   // Number of events in the list.
                NULL,                                                                                // Event list.
-               NULL                                                                                 // Event.
+               baseline->profile (&loc_event)                                                       // Event.
               );
 
   baseline->check_error (loc_error);
 
+  if(loc_event != NULL)                                                                             // Checking for profiling...
+  {
+    baseline->record
+    (
+     loc_event,                                                                                     // Profiling event.
+     "write float3 #" + std::to_string (loc_layout_index),                                          // Profiling entry name.
+     sizeof(float3_structure)*loc_data->size                                                        // Transferred data [bytes].
+    );
+
+    loc_event = NULL;                                                                               // Resetting profiling event...
+  }
+
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+
+  loc_data->dirty.clear ();                                                                         // Clearing dirty ranges (whole data uploaded)...
+
+  baseline->trace_end ("write", loc_span);                                                          // Appending trace span...
 };
 
 void queue::write
@@ -781,9 +1096,11 @@ void queue::write
  cl_uint loc_layout_index                                                                           // Layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Local error code.
+  cl_int   loc_error;                                                                               // Local error code.
+  cl_event loc_event = NULL;                                                                        // Profiling event.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 
   // Checking layout index:
@@ -804,12 +1121,28 @@ void queue::write
                loc_data->data,                                                                      // Data buffer.
                0,                                                                                   // Number of events in the list.
                NULL,                                                                                // Event list.
-               NULL                                                                                 // Event.
+               baseline->profile (&loc_event)                                                       // Event.
               );
 
   baseline->check_error (loc_error);
 
+  if(loc_event != NULL)                                                                             // Checking for profiling...
+  {
+    baseline->record
+    (
+     loc_event,                                                                                     // Profiling event.
+     "write float4 #" + std::to_string (loc_layout_index),                                          // Profiling entry name.
+     sizeof(float4_structure)*loc_data->size                                                        // Transferred data [bytes].
+    );
+
+    loc_event = NULL;                                                                               // Resetting profiling event...
+  }
+
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+
+  loc_data->dirty.clear ();                                                                         // Clearing dirty ranges (whole data uploaded)...
+
+  baseline->trace_end ("write", loc_span);                                                          // Appending trace span...
 };
 
 void queue::write
@@ -818,9 +1151,11 @@ void queue::write
  cl_uint  loc_layout_index                                                                          // Layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Local error code.
+  cl_int   loc_error;                                                                               // Local error code.
+  cl_event loc_event = NULL;                                                                        // Profiling event.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 
   // Checking layout index:
@@ -850,11 +1185,23 @@ void queue::write
                loc_data->data,                                                                      // Data buffer.
                0,                                                                                   // Number of events in the list.
                NULL,                                                                                // Event list.
-               NULL                                                                                 // Event.
+               baseline->profile (&loc_event)                                                       // Event.
               );
 
   baseline->check_error (loc_error);                                                                // Checking error...
 
+  if(loc_event != NULL)                                                                             // Checking for profiling...
+  {
+    baseline->record
+    (
+     loc_event,                                                                                     // Profiling event.
+     "write float4G #" + std::to_string (loc_layout_index),                                         // Profiling entry name.
+     sizeof(float4G_structure)*loc_data->size                                                       // Transferred data [bytes].
+    );
+
+    loc_event = NULL;                                                                               // Resetting profiling event...
+  }
+
   if(baseline->interop)                                                                             // Checking for interoperability...
   {
     // Releasing OpenGL buffer:
@@ -866,19 +1213,73 @@ void queue::write
   }
 
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+
+  loc_data->dirty.clear ();                                                                         // Clearing dirty ranges (whole data uploaded)...
+
+  baseline->trace_end ("write", loc_span);                                                          // Appending trace span...
 };
 
-void queue::acquire
+/////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// "flush" functions /////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////////////////
+void queue::write_ranges
 (
- float1G* loc_data,                                                                                 // Data object.
- GLuint   loc_layout_index                                                                          // OpenGL shader layout index.
+ cl_mem       loc_buffer,                                                                           // Data buffer.
+ void*        loc_data,                                                                             // Data storage.
+ size_t       loc_element_size,                                                                     // Data element size [bytes].
+ dirty_range* loc_dirty                                                                             // Dirty ranges.
 )
 {
-  cl_int loc_error;                                                                                 // Local error code.
+  size_t   i;                                                                                       // Index.
+  cl_int   loc_error;                                                                               // Local error code.
+  cl_event loc_event = NULL;                                                                        // Profiling event.
+
+  loc_dirty->coalesce (NU_DIRTY_GAP);                                                               // Coalescing dirty ranges...
+
+  for(i = 0; i < loc_dirty->range.size (); i++)                                                     // Scanning dirty ranges...
+  {
+    // Writing OpenCL buffer range:
+    loc_error = clEnqueueWriteBuffer
+                (
+                 queue_id,                                                                          // OpenCL queue ID.
+                 loc_buffer,                                                                        // Data buffer.
+                 CL_FALSE,                                                                          // Non-blocking write flag.
+                 loc_element_size*loc_dirty->range[i].begin,                                        // Data buffer offset.
+                 loc_element_size*(loc_dirty->range[i].end - loc_dirty->range[i].begin),            // Data buffer size.
+                 (char*)loc_data + loc_element_size*loc_dirty->range[i].begin,                      // Data buffer.
+                 0,                                                                                 // Number of events in the list.
+                 NULL,                                                                              // Event list.
+                 baseline->profile (&loc_event)                                                     // Event.
+                );
+
+    baseline->check_error (loc_error);                                                              // Checking error...
+
+    if(loc_event != NULL)                                                                           // Checking for profiling...
+    {
+      baseline->record
+      (
+       loc_event,                                                                                   // Profiling event.
+       "flush",                                                                                     // Profiling entry name.
+       loc_element_size*(loc_dirty->range[i].end - loc_dirty->range[i].begin)                       // Transferred data [bytes].
+      );
+
+      loc_event = NULL;                                                                             // Resetting profiling event...
+    }
+  }
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 
+  loc_dirty->clear ();                                                                              // Clearing dirty ranges...
+}
+
+void queue::flush
+(
+ int1*   loc_data,                                                                                  // Data object.
+ cl_uint loc_layout_index                                                                           // Layout index.
+)
+{
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
+
   // Checking layout index:
   if(loc_layout_index != loc_data->layout)
   {
@@ -886,48 +1287,489 @@ void queue::acquire
     exit (EXIT_FAILURE);                                                                            // Exiting...
   }
 
-  // Setting layout index in vertex shader...
-  glDisableVertexAttribArray (loc_layout_index);                                                    // Unbinding data array...
-
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  if(loc_data->dirty.empty ())                                                                      // Checking for modified data...
+  {
+    return;                                                                                         // Nothing to upload...
+  }
 
-  if(baseline->interop)                                                                             // Checking for interoperability...
+  if(!loc_data->ready)                                                                              // Checking for buffer (it copies the whole data when created)...
   {
-    // Acquiring OpenCL buffer:
-    loc_error = clEnqueueAcquireGLObjects
-                (
-                 queue_id,                                                                          // Queue.
-                 1,                                                                                 // Number of memory objects.
-                 &loc_data->buffer,                                                                 // Memory object array.
-                 0,                                                                                 // Number of events in event list.
-                 NULL,                                                                              // Event list.
-                 NULL                                                                               // Event.
-                );
+    loc_data->dirty.clear ();                                                                       // Clearing dirty ranges...
+    return;                                                                                         // Nothing to upload...
+  }
 
-    baseline->check_error (loc_error);                                                              // Checking returned error code...
+  // Writing modified ranges:
+  write_ranges
+  (
+   loc_data->buffer,                                                                                // Data buffer.
+   loc_data->data,                                                                                  // Data storage.
+   sizeof(cl_long),                                                                                 // Data element size.
+   &loc_data->dirty                                                                                 // Dirty ranges.
+  );
 
-    clFinish (queue_id);                                                                            // Waiting for OpenCL to finish...
+  baseline->trace_end ("flush", loc_span);                                                          // Appending trace span...
+};
+
+void queue::flush
+(
+ int2*   loc_data,                                                                                  // Data object.
+ cl_uint loc_layout_index                                                                           // Layout index.
+)
+{
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    baseline->error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
   }
-  else
+
+  if(loc_data->dirty.empty ())                                                                      // Checking for modified data...
   {
-    // Binding node VAO...
-    glBindVertexArray
-    (
-     loc_data->vao                                                                                  // VAOs array.
-    );
+    return;                                                                                         // Nothing to upload...
+  }
 
-    // Binding VBO:
-    glBindBuffer
-    (
-     GL_ARRAY_BUFFER,                                                                               // VBO target.
-     loc_data->vbo                                                                                  // VBO to bind.
-    );
+  if(!loc_data->ready)                                                                              // Checking for buffer (it copies the whole data when created)...
+  {
+    loc_data->dirty.clear ();                                                                       // Clearing dirty ranges...
+    return;                                                                                         // Nothing to upload...
+  }
 
-    // Creating and initializing a buffer object's data store:
-    glBufferSubData
-    (
-     GL_ARRAY_BUFFER,                                                                               // VBO target.
-     0,                                                                                             // VBO Offset.
+  // Writing modified ranges:
+  write_ranges
+  (
+   loc_data->buffer,                                                                                // Data buffer.
+   loc_data->data,                                                                                  // Data storage.
+   sizeof(int2_structure),                                                                          // Data element size.
+   &loc_data->dirty                                                                                 // Dirty ranges.
+  );
+
+  baseline->trace_end ("flush", loc_span);                                                          // Appending trace span...
+};
+
+void queue::flush
+(
+ int3*   loc_data,                                                                                  // Data object.
+ cl_uint loc_layout_index                                                                           // Layout index.
+)
+{
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    baseline->error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  if(loc_data->dirty.empty ())                                                                      // Checking for modified data...
+  {
+    return;                                                                                         // Nothing to upload...
+  }
+
+  if(!loc_data->ready)                                                                              // Checking for buffer (it copies the whole data when created)...
+  {
+    loc_data->dirty.clear ();                                                                       // Clearing dirty ranges...
+    return;                                                                                         // Nothing to upload...
+  }
+
+  // Writing modified ranges:
+  write_ranges
+  (
+   loc_data->buffer,                                                                                // Data buffer.
+   loc_data->data,                                                                                  // Data storage.
+   sizeof(int3_structure),                                                                          // Data element size.
+   &loc_data->dirty                                                                                 // Dirty ranges.
+  );
+
+  baseline->trace_end ("flush", loc_span);                                                          // Appending trace span...
+};
+
+void queue::flush
+(
+ int4*   loc_data,                                                                                  // Data object.
+ cl_uint loc_layout_index                                                                           // Layout index.
+)
+{
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    baseline->error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  if(loc_data->dirty.empty ())                                                                      // Checking for modified data...
+  {
+    return;                                                                                         // Nothing to upload...
+  }
+
+  if(!loc_data->ready)                                                                              // Checking for buffer (it copies the whole data when created)...
+  {
+    loc_data->dirty.clear ();                                                                       // Clearing dirty ranges...
+    return;                                                                                         // Nothing to upload...
+  }
+
+  // Writing modified ranges:
+  write_ranges
+  (
+   loc_data->buffer,                                                                                // Data buffer.
+   loc_data->data,                                                                                  // Data storage.
+   sizeof(int4_structure),                                                                          // Data element size.
+   &loc_data->dirty                                                                                 // Dirty ranges.
+  );
+
+  baseline->trace_end ("flush", loc_span);                                                          // Appending trace span...
+};
+
+void queue::flush
+(
+ float1* loc_data,                                                                                  // Data object.
+ cl_uint loc_layout_index                                                                           // Layout index.
+)
+{
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    baseline->error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  if(loc_data->dirty.empty ())                                                                      // Checking for modified data...
+  {
+    return;                                                                                         // Nothing to upload...
+  }
+
+  if(!loc_data->ready)                                                                              // Checking for buffer (it copies the whole data when created)...
+  {
+    loc_data->dirty.clear ();                                                                       // Clearing dirty ranges...
+    return;                                                                                         // Nothing to upload...
+  }
+
+  // Writing modified ranges:
+  write_ranges
+  (
+   loc_data->buffer,                                                                                // Data buffer.
+   loc_data->data,                                                                                  // Data storage.
+   sizeof(cl_float),                                                                                // Data element size.
+   &loc_data->dirty                                                                                 // Dirty ranges.
+  );
+
+  baseline->trace_end ("flush", loc_span);                                                          // Appending trace span...
+};
+
+void queue::flush
+(
+ float1G* loc_data,                                                                                 // Data object.
+ GLuint   loc_layout_index                                                                          // Layout index.
+)
+{
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    baseline->error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  if(loc_data->dirty.empty ())                                                                      // Checking for modified data...
+  {
+    return;                                                                                         // Nothing to upload...
+  }
+
+  if(!loc_data->ready)                                                                              // Checking for buffer (it copies the whole data when created)...
+  {
+    loc_data->dirty.clear ();                                                                       // Clearing dirty ranges...
+    return;                                                                                         // Nothing to upload...
+  }
+
+  if(baseline->interop)                                                                             // Checking for interoperability...
+  {
+    // Acquiring OpenGL buffer:
+    acquire (
+             loc_data,                                                                              // Data object.
+             loc_layout_index                                                                       // OpenGL shader layout index.
+            );
+  }
+
+  // Writing modified ranges:
+  write_ranges
+  (
+   loc_data->buffer,                                                                                // Data buffer.
+   loc_data->data,                                                                                  // Data storage.
+   sizeof(GLfloat),                                                                                 // Data element size.
+   &loc_data->dirty                                                                                 // Dirty ranges.
+  );
+
+  if(baseline->interop)                                                                             // Checking for interoperability...
+  {
+    // Releasing OpenGL buffer:
+    release
+    (
+     loc_data,                                                                                      // Data object.
+     loc_layout_index                                                                               // OpenGL shader layout index.
+    );
+  }
+
+  baseline->trace_end ("flush", loc_span);                                                          // Appending trace span...
+};
+
+void queue::flush
+(
+ float2* loc_data,                                                                                  // Data object.
+ cl_uint loc_layout_index                                                                           // Layout index.
+)
+{
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    baseline->error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  if(loc_data->dirty.empty ())                                                                      // Checking for modified data...
+  {
+    return;                                                                                         // Nothing to upload...
+  }
+
+  if(!loc_data->ready)                                                                              // Checking for buffer (it copies the whole data when created)...
+  {
+    loc_data->dirty.clear ();                                                                       // Clearing dirty ranges...
+    return;                                                                                         // Nothing to upload...
+  }
+
+  // Writing modified ranges:
+  write_ranges
+  (
+   loc_data->buffer,                                                                                // Data buffer.
+   loc_data->data,                                                                                  // Data storage.
+   sizeof(float2_structure),                                                                        // Data element size.
+   &loc_data->dirty                                                                                 // Dirty ranges.
+  );
+
+  baseline->trace_end ("flush", loc_span);                                                          // Appending trace span...
+};
+
+void queue::flush
+(
+ float3* loc_data,                                                                                  // Data object.
+ cl_uint loc_layout_index                                                                           // Layout index.
+)
+{
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    baseline->error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  if(loc_data->dirty.empty ())                                                                      // Checking for modified data...
+  {
+    return;                                                                                         // Nothing to upload...
+  }
+
+  if(!loc_data->ready)                                                                              // Checking for buffer (it copies the whole data when created)...
+  {
+    loc_data->dirty.clear ();                                                                       // Clearing dirty ranges...
+    return;                                                                                         // Nothing to upload...
+  }
+
+  // Writing modified ranges:
+  write_ranges
+  (
+   loc_data->buffer,                                                                                // Data buffer.
+   loc_data->data,                                                                                  // Data storage.
+   sizeof(float3_structure),                                                                        // Data element size.
+   &loc_data->dirty                                                                                 // Dirty ranges.
+  );
+
+  baseline->trace_end ("flush", loc_span);                                                          // Appending trace span...
+};
+
+void queue::flush
+(
+ float4* loc_data,                                                                                  // Data object.
+ cl_uint loc_layout_index                                                                           // Layout index.
+)
+{
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    baseline->error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  if(loc_data->dirty.empty ())                                                                      // Checking for modified data...
+  {
+    return;                                                                                         // Nothing to upload...
+  }
+
+  if(!loc_data->ready)                                                                              // Checking for buffer (it copies the whole data when created)...
+  {
+    loc_data->dirty.clear ();                                                                       // Clearing dirty ranges...
+    return;                                                                                         // Nothing to upload...
+  }
+
+  // Writing modified ranges:
+  write_ranges
+  (
+   loc_data->buffer,                                                                                // Data buffer.
+   loc_data->data,                                                                                  // Data storage.
+   sizeof(float4_structure),                                                                        // Data element size.
+   &loc_data->dirty                                                                                 // Dirty ranges.
+  );
+
+  baseline->trace_end ("flush", loc_span);                                                          // Appending trace span...
+};
+
+void queue::flush
+(
+ float4G* loc_data,                                                                                 // Data object.
+ GLuint   loc_layout_index                                                                          // Layout index.
+)
+{
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    baseline->error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  if(loc_data->dirty.empty ())                                                                      // Checking for modified data...
+  {
+    return;                                                                                         // Nothing to upload...
+  }
+
+  if(!loc_data->ready)                                                                              // Checking for buffer (it copies the whole data when created)...
+  {
+    loc_data->dirty.clear ();                                                                       // Clearing dirty ranges...
+    return;                                                                                         // Nothing to upload...
+  }
+
+  if(baseline->interop)                                                                             // Checking for interoperability...
+  {
+    // Acquiring OpenGL buffer:
+    acquire (
+             loc_data,                                                                              // Data object.
+             loc_layout_index                                                                       // OpenGL shader layout index.
+            );
+  }
+
+  // Writing modified ranges:
+  write_ranges
+  (
+   loc_data->buffer,                                                                                // Data buffer.
+   loc_data->data,                                                                                  // Data storage.
+   sizeof(float4G_structure),                                                                       // Data element size.
+   &loc_data->dirty                                                                                 // Dirty ranges.
+  );
+
+  if(baseline->interop)                                                                             // Checking for interoperability...
+  {
+    // Releasing OpenGL buffer:
+    release
+    (
+     loc_data,                                                                                      // Data object.
+     loc_layout_index                                                                               // OpenGL shader layout index.
+    );
+  }
+
+  baseline->trace_end ("flush", loc_span);                                                          // Appending trace span...
+};
+
+void queue::acquire
+(
+ float1G* loc_data,                                                                                 // Data object.
+ GLuint   loc_layout_index                                                                          // OpenGL shader layout index.
+)
+{
+  cl_int   loc_error;                                                                               // Local error code.
+  cl_event loc_event = NULL;                                                                        // Profiling event.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
+
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
+  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    baseline->error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  if(baseline->headless)                                                                            // Checking for headless mode...
+  {
+    baseline->trace_end ("acquire", loc_span);                                                      // Appending trace span...
+    return;                                                                                         // Plain OpenCL buffer: nothing to acquire...
+  }
+
+  // Setting layout index in vertex shader...
+  glDisableVertexAttribArray (loc_layout_index);                                                    // Unbinding data array...
+
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
+
+  if(baseline->interop)                                                                             // Checking for interoperability...
+  {
+    // Acquiring OpenCL buffer:
+    loc_error = clEnqueueAcquireGLObjects
+                (
+                 queue_id,                                                                          // Queue.
+                 1,                                                                                 // Number of memory objects.
+                 &loc_data->buffer,                                                                 // Memory object array.
+                 0,                                                                                 // Number of events in event list.
+                 NULL,                                                                              // Event list.
+                 baseline->profile (&loc_event)                                                     // Event.
+                );
+
+    baseline->check_error (loc_error);                                                              // Checking returned error code...
+
+    if(loc_event != NULL)                                                                           // Checking for profiling...
+    {
+      baseline->record
+      (
+       loc_event,                                                                                   // Profiling event.
+       "acquire float1G #" + std::to_string (loc_layout_index),                                     // Profiling entry name.
+       0                                                                                            // Transferred data [bytes].
+      );
+
+      loc_event = NULL;                                                                             // Resetting profiling event...
+    }
+
+    clFinish (queue_id);                                                                            // Waiting for OpenCL to finish...
+  }
+  else
+  {
+    // Binding node VAO...
+    glBindVertexArray
+    (
+     loc_data->vao                                                                                  // VAOs array.
+    );
+
+    // Binding VBO:
+    glBindBuffer
+    (
+     GL_ARRAY_BUFFER,                                                                               // VBO target.
+     loc_data->vbo                                                                                  // VBO to bind.
+    );
+
+    // Creating and initializing a buffer object's data store:
+    glBufferSubData
+    (
+     GL_ARRAY_BUFFER,                                                                               // VBO target.
+     0,                                                                                             // VBO Offset.
      sizeof(GLfloat)*loc_data->size,                                                                // VBO size.
      loc_data->data                                                                                 // VBO data.
     );
@@ -959,7 +1801,7 @@ void queue::acquire
     // Setting layout index in vertex shader...
     glDisableVertexAttribArray (loc_layout_index);                                                  // Unbinding data array...
 
-    glFinish ();                                                                                    // Waiting for OpenGL to finish...
+    baseline->gl_finish ();                                                                         // Waiting for OpenGL to finish...
 
     // Writing OpenCL buffer:
     loc_error = clEnqueueWriteBuffer
@@ -972,12 +1814,26 @@ void queue::acquire
                  loc_data->data,                                                                    // Data buffer.
                  0,                                                                                 // Number of events in the list.
                  NULL,                                                                              // Event list.
-                 NULL                                                                               // Event.
+                 baseline->profile (&loc_event)                                                     // Event.
                 );
     baseline->check_error (loc_error);
 
+    if(loc_event != NULL)                                                                           // Checking for profiling...
+    {
+      baseline->record
+      (
+       loc_event,                                                                                   // Profiling event.
+       "acquire write float1G #" + std::to_string (loc_layout_index),                               // Profiling entry name.
+       sizeof(GLfloat)*loc_data->size                                                               // Transferred data [bytes].
+      );
+
+      loc_event = NULL;                                                                             // Resetting profiling event...
+    }
+
     clFinish (queue_id);                                                                            // Waiting for OpenCL to finish...
   }
+
+  baseline->trace_end ("acquire", loc_span);                                                        // Appending trace span...
 };
 
 void queue::acquire
@@ -986,9 +1842,11 @@ void queue::acquire
  GLuint   loc_layout_index                                                                          // OpenGL shader layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Local error code.
+  cl_int   loc_error;                                                                               // Local error code.
+  cl_event loc_event = NULL;                                                                        // Profiling event.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 
   // Checking layout index:
@@ -998,10 +1856,16 @@ void queue::acquire
     exit (EXIT_FAILURE);                                                                            // Exiting...
   }
 
+  if(baseline->headless)                                                                            // Checking for headless mode...
+  {
+    baseline->trace_end ("acquire", loc_span);                                                      // Appending trace span...
+    return;                                                                                         // Plain OpenCL buffer: nothing to acquire...
+  }
+
   // Setting layout index in vertex shader...
   glDisableVertexAttribArray (loc_layout_index);                                                    // Unbinding data array...
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
 
   if(baseline->interop)                                                                             // Checking for interoperability...
   {
@@ -1013,8 +1877,20 @@ void queue::acquire
                  &loc_data->buffer,                                                                 // Memory object array.
                  0,                                                                                 // Number of events in event list.
                  NULL,                                                                              // Event list.
-                 NULL                                                                               // Event.
+                 baseline->profile (&loc_event)                                                     // Event.
                 );
+
+    if(loc_event != NULL)                                                                           // Checking for profiling...
+    {
+      baseline->record
+      (
+       loc_event,                                                                                   // Profiling event.
+       "acquire float4G #" + std::to_string (loc_layout_index),                                     // Profiling entry name.
+       0                                                                                            // Transferred data [bytes].
+      );
+
+      loc_event = NULL;                                                                             // Resetting profiling event...
+    }
   }
 
   else
@@ -1068,7 +1944,7 @@ void queue::acquire
     // Setting layout index in vertex shader...
     glDisableVertexAttribArray (loc_layout_index);                                                  // Unbinding data array...
 
-    glFinish ();                                                                                    // Waiting for OpenGL to finish...
+    baseline->gl_finish ();                                                                         // Waiting for OpenGL to finish...
 
     // Writing OpenCL buffer:
     loc_error = clEnqueueWriteBuffer
@@ -1081,13 +1957,27 @@ void queue::acquire
                  loc_data->data,                                                                    // Data buffer.
                  0,                                                                                 // Number of events in the list.
                  NULL,                                                                              // Event list.
-                 NULL                                                                               // Event.
+                 baseline->profile (&loc_event)                                                     // Event.
                 );
   }
 
   baseline->check_error (loc_error);                                                                // Checking returned error code...
 
+  if(loc_event != NULL)                                                                             // Checking for profiling...
+  {
+    baseline->record
+    (
+     loc_event,                                                                                     // Profiling event.
+     "acquire write float4G #" + std::to_string (loc_layout_index),                                 // Profiling entry name.
+     sizeof(float4G_structure)*loc_data->size                                                       // Transferred data [bytes].
+    );
+
+    loc_event = NULL;                                                                               // Resetting profiling event...
+  }
+
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+
+  baseline->trace_end ("acquire", loc_span);                                                        // Appending trace span...
 };
 
 void queue::release
@@ -1096,11 +1986,19 @@ void queue::release
  GLuint   loc_layout_index                                                                          // OpenGL shader layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Local error code.
+  cl_int   loc_error;                                                                               // Local error code.
+  cl_event loc_event = NULL;                                                                        // Profiling event.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
+
+  if(baseline->headless)                                                                            // Checking for headless mode...
+  {
+    baseline->trace_end ("release", loc_span);                                                      // Appending trace span...
+    return;                                                                                         // Plain OpenCL buffer: nothing to release...
+  }
 
   if(baseline->interop)                                                                             // Checking for interoperability...
   {
-    glFinish ();                                                                                    // Waiting for OpenGL to finish...
+    baseline->gl_finish ();                                                                         // Waiting for OpenGL to finish...
     clFinish (queue_id);                                                                            // Waiting for OpenCL to finish...
 
     // Releasing openCL buffer:
@@ -1111,7 +2009,7 @@ void queue::release
                  &loc_data->buffer,                                                                 // Memory object array.
                  0,                                                                                 // Number of events in event list.
                  NULL,                                                                              // Event list.
-                 NULL                                                                               // Event.
+                 baseline->profile (&loc_event)                                                     // Event.
                 );
 
     clFinish (queue_id);                                                                            // Waiting for OpenCL to finish...
@@ -1120,6 +2018,18 @@ void queue::release
 
     baseline->check_error (loc_error);                                                              // Checking returned error code...
 
+    if(loc_event != NULL)                                                                           // Checking for profiling...
+    {
+      baseline->record
+      (
+       loc_event,                                                                                   // Profiling event.
+       "release float1G #" + std::to_string (loc_layout_index),                                     // Profiling entry name.
+       0                                                                                            // Transferred data [bytes].
+      );
+
+      loc_event = NULL;                                                                             // Resetting profiling event...
+    }
+
     // Binding data:
     glBindBuffer (GL_ARRAY_BUFFER, loc_data->vbo);                                                  // Binding VBO...
     glVertexAttribPointer
@@ -1132,11 +2042,11 @@ void queue::release
      0                                                                                              // Data offset.
     );
 
-    glFinish ();                                                                                    // Waiting for OpenGL to finish...
+    baseline->gl_finish ();                                                                         // Waiting for OpenGL to finish...
   }
   else
   {
-    glFinish ();                                                                                    // Waiting for OpenGL to finish...
+    baseline->gl_finish ();                                                                         // Waiting for OpenGL to finish...
     clFinish (queue_id);                                                                            // Waiting for OpenCL to finish...
 
     // Checking layout index:
@@ -1157,13 +2067,27 @@ void queue::release
                  loc_data->data,                                                                    // Data buffer.
                  0,                                                                                 // Number of events in the list.
                  NULL,                                                                              // Event list.
-                 NULL                                                                               // Event.
+                 baseline->profile (&loc_event)                                                     // Event.
                 );
 
     baseline->check_error (loc_error);
 
+    if(loc_event != NULL)                                                                           // Checking for profiling...
+    {
+      baseline->record
+      (
+       loc_event,                                                                                   // Profiling event.
+       "release read float1G #" + std::to_string (loc_layout_index),                                // Profiling entry name.
+       sizeof(GLfloat)*loc_data->size                                                               // Transferred data [bytes].
+      );
+
+      loc_event = NULL;                                                                             // Resetting profiling event...
+    }
+
     clFinish (queue_id);                                                                            // Waiting for OpenCL to finish...
   }
+
+  baseline->trace_end ("release", loc_span);                                                        // Appending trace span...
 };
 
 void queue::release
@@ -1172,9 +2096,11 @@ void queue::release
  GLuint   loc_layout_index                                                                          // OpenGL shader layout index.
 )
 {
-  cl_int loc_error;                                                                                 // Local error code.
+  cl_int   loc_error;                                                                               // Local error code.
+  cl_event loc_event = NULL;                                                                        // Profiling event.
+  cl_ulong loc_span = baseline->trace_begin ();                                                     // Trace span beginning [ns].
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 
   // Checking layout index:
@@ -1184,6 +2110,12 @@ void queue::release
     exit (EXIT_FAILURE);                                                                            // Exiting...
   }
 
+  if(baseline->headless)                                                                            // Checking for headless mode...
+  {
+    baseline->trace_end ("release", loc_span);                                                      // Appending trace span...
+    return;                                                                                         // Plain OpenCL buffer: nothing to release...
+  }
+
   if(baseline->interop)                                                                             // Checking for interoperability...
   {
     // Releasing openCL buffer:
@@ -1194,8 +2126,20 @@ void queue::release
                  &loc_data->buffer,                                                                 // Memory object array.
                  0,                                                                                 // Number of events in event list.
                  NULL,                                                                              // Event list.
-                 NULL                                                                               // Event.
+                 baseline->profile (&loc_event)                                                     // Event.
                 );
+
+    if(loc_event != NULL)                                                                           // Checking for profiling...
+    {
+      baseline->record
+      (
+       loc_event,                                                                                   // Profiling event.
+       "release float4G #" + std::to_string (loc_layout_index),                                     // Profiling entry name.
+       0                                                                                            // Transferred data [bytes].
+      );
+
+      loc_event = NULL;                                                                             // Resetting profiling event...
+    }
   }
 
   else
@@ -1211,12 +2155,24 @@ void queue::release
                  loc_data->data,                                                                    // Data buffer.
                  0,                                                                                 // Number of events in the list.
                  NULL,                                                                              // Event list.
-                 NULL                                                                               // Event.
+                 baseline->profile (&loc_event)                                                     // Event.
                 );
   }
 
   baseline->check_error (loc_error);                                                                // Checking returned error code...
 
+  if(loc_event != NULL)                                                                             // Checking for profiling...
+  {
+    baseline->record
+    (
+     loc_event,                                                                                     // Profiling event.
+     "release read float4G #" + std::to_string (loc_layout_index),                                  // Profiling entry name.
+     sizeof(float4G_structure)*loc_data->size                                                       // Transferred data [bytes].
+    );
+
+    loc_event = NULL;                                                                               // Resetting profiling event...
+  }
+
   clFinish (queue_id);                                                                              // Ensuring that all OpenCL has completed all operations...
 
   glEnableVertexAttribArray (loc_layout_index);
@@ -1233,14 +2189,16 @@ void queue::release
    0                                                                                                // Data offset.
   );
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
+
+  baseline->trace_end ("release", loc_span);                                                        // Appending trace span...
 };
 
 queue::~queue()
 {
   cl_int loc_error;                                                                                 // Local error code.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  baseline->gl_finish ();                                                                           // Waiting for OpenGL to finish...
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 
   baseline->action ("releasing OpenCL command queue...");                                           // Printing message...
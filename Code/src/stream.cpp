@@ -0,0 +1,628 @@
+/// @file     stream.cpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Definition of the "stream" class.
+
+#include "stream.hpp"
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////// "stream" class ///////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+stream::stream()
+{
+  baseline = NULL;                                                                                  // Initializing Neutrino baseline...
+  slots    = 0;                                                                                     // Initializing number of staging buffers...
+  head     = 0;                                                                                     // Initializing next staging buffer index...
+  staging  = NULL;                                                                                  // Initializing staging buffer array...
+  pointer  = NULL;                                                                                  // Initializing mapped staging buffer array...
+  capacity = NULL;                                                                                  // Initializing staging buffer capacity array...
+  owner    = NULL;                                                                                  // Initializing staging buffer mapping queue array...
+  event    = NULL;                                                                                  // Initializing staging buffer read event array...
+  snapshot = NULL;                                                                                  // Initializing staging buffer snapshot header array...
+  busy     = NULL;                                                                                  // Initializing staging buffer "busy" flag array...
+  stop     = false;                                                                                 // Initializing writer thread "stop" flag...
+  offset   = 0;                                                                                     // Initializing data file write offset...
+  period   = 1;                                                                                     // Initializing snapshot period...
+}
+
+void stream::init
+(
+ neutrino*   loc_baseline,                                                                          // Neutrino baseline.
+ std::string loc_file_directory,                                                                    // File directory.
+ std::string loc_file_name,                                                                         // File name.
+ size_t      loc_period,                                                                            // Snapshot period [steps].
+ size_t      loc_slots                                                                              // Number of staging buffers [#].
+)
+{
+  size_t                  i;                                                                        // Index.
+  std::string             loc_full_name;                                                            // Full file name.
+  stream_header_structure loc_header;                                                               // Data file header.
+
+  baseline = loc_baseline;                                                                          // Getting Neutrino baseline...
+  baseline->action ("initializing snapshot stream...");                                             // Printing message...
+
+  #ifdef __linux__
+    loc_full_name = loc_file_directory +                                                            // Data directory.
+                    std::string ("/") +                                                             // Slash.
+                    loc_file_name;                                                                  // Data file name.
+  #endif
+
+  #ifdef __APPLE__
+    loc_full_name = loc_file_directory +                                                            // Data directory.
+                    std::string ("/") +                                                             // Slash.
+                    loc_file_name;                                                                  // Data file name.
+  #endif
+
+  #ifdef WIN32
+    loc_full_name = loc_file_directory +                                                            // Data directory.
+                    std::string ("\\") +                                                            // Backslash.
+                    loc_file_name;                                                                  // Data file name.
+  #endif
+
+  data_file.open (loc_full_name, std::ios::out | std::ios::binary | std::ios::trunc);               // Opening data file...
+  index_file.open (loc_full_name + ".idx", std::ios::out | std::ios::binary | std::ios::trunc);     // Opening index file...
+
+  if(!data_file || !index_file)                                                                     // Checking files...
+  {
+    baseline->error ("Cannot open snapshot stream files!");                                         // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Writing data file header:
+  std::copy (NU_STREAM_MAGIC, NU_STREAM_MAGIC + 8, loc_header.magic);                               // Setting file signature...
+  loc_header.version = NU_STREAM_VERSION;                                                           // Setting file format version...
+  loc_header.reserved = 0;                                                                          // Resetting reserved field...
+  data_file.write ((char*)&loc_header, sizeof(stream_header_structure));                            // Writing header...
+  offset   = sizeof(stream_header_structure);                                                       // Setting data file write offset...
+
+  period   = std::max (loc_period, (size_t)1);                                                      // Setting snapshot period...
+  slots    = std::max (loc_slots, (size_t)1);                                                       // Setting number of staging buffers...
+  head     = 0;                                                                                     // Resetting next staging buffer index...
+  staging  = new cl_mem[slots];                                                                     // Creating staging buffer array...
+  pointer  = new void*[slots];                                                                      // Creating mapped staging buffer array...
+  capacity = new size_t[slots];                                                                     // Creating staging buffer capacity array...
+  owner    = new cl_command_queue[slots];                                                           // Creating staging buffer mapping queue array...
+  event    = new cl_event[slots];                                                                   // Creating staging buffer read event array...
+  snapshot = new snapshot_structure[slots];                                                         // Creating staging buffer snapshot header array...
+  busy     = new bool[slots];                                                                       // Creating staging buffer "busy" flag array...
+
+  for(i = 0; i < slots; i++)                                                                        // Scanning staging buffers...
+  {
+    staging[i]  = NULL;                                                                             // Resetting staging buffer (lazily allocated)...
+    pointer[i]  = NULL;                                                                             // Resetting mapped staging buffer...
+    capacity[i] = 0;                                                                                // Resetting staging buffer capacity...
+    owner[i]    = NULL;                                                                             // Resetting staging buffer mapping queue...
+    event[i]    = NULL;                                                                             // Resetting staging buffer read event...
+    busy[i]     = false;                                                                            // Resetting staging buffer "busy" flag...
+  }
+
+  stop   = false;                                                                                   // Resetting writer thread "stop" flag...
+  writer = std::thread (&stream::write_loop, this);                                                 // Starting writer thread...
+
+  baseline->done ();                                                                                // Printing message...
+}
+
+void stream::snap
+(
+ queue*   loc_queue,                                                                                // OpenCL queue.
+ cl_mem   loc_buffer,                                                                               // Data buffer.
+ cl_ulong loc_step,                                                                                 // Application step number [#].
+ cl_uint  loc_layout_index,                                                                         // Layout index.
+ cl_uint  loc_type,                                                                                 // Data type.
+ size_t   loc_size,                                                                                 // Data size [#].
+ size_t   loc_bytes                                                                                 // Data size [bytes].
+)
+{
+  cl_int                       loc_error;                                                           // Local error code.
+  size_t                       loc_slot;                                                            // Staging buffer index.
+  std::unique_lock<std::mutex> loc_lock (lock);                                                     // Staging buffer lock.
+
+  loc_slot = head;                                                                                  // Getting next staging buffer...
+
+  // Waiting for the staging buffer to be written (back-pressure when the disk is too slow):
+  wakeup.wait (loc_lock, [this, loc_slot] {return !busy[loc_slot];});
+
+  if(capacity[loc_slot] < loc_bytes)                                                                // Checking staging buffer capacity...
+  {
+    if(staging[loc_slot] != NULL)                                                                   // Checking for a previous staging buffer...
+    {
+      clEnqueueUnmapMemObject (owner[loc_slot], staging[loc_slot], pointer[loc_slot], 0, NULL, NULL); // Unmapping staging buffer...
+      clFinish (owner[loc_slot]);                                                                   // Waiting for OpenCL to finish...
+      clReleaseMemObject (staging[loc_slot]);                                                       // Releasing staging buffer...
+    }
+
+    // Creating pinned staging buffer:
+    staging[loc_slot]  = clCreateBuffer
+                         (
+                          loc_queue->context_id,                                                    // OpenCL context.
+                          CL_MEM_READ_WRITE | CL_MEM_ALLOC_HOST_PTR,                                // Memory flags (pinned host memory).
+                          loc_bytes,                                                                // Data buffer size.
+                          NULL,                                                                     // Host pointer.
+                          &loc_error                                                                // Error code.
+                         );
+
+    baseline->check_error (loc_error);                                                              // Checking error...
+
+    // Mapping pinned staging buffer on the host:
+    pointer[loc_slot]  = clEnqueueMapBuffer
+                         (
+                          loc_queue->queue_id,                                                      // OpenCL queue ID.
+                          staging[loc_slot],                                                        // Staging buffer.
+                          CL_TRUE,                                                                  // Blocking map flag.
+                          CL_MAP_READ | CL_MAP_WRITE,                                               // Map flags.
+                          0,                                                                        // Map offset.
+                          loc_bytes,                                                                // Map size.
+                          0,                                                                        // Number of events in the list.
+                          NULL,                                                                     // Event list.
+                          NULL,                                                                     // Event.
+                          &loc_error                                                                // Error code.
+                         );
+
+    baseline->check_error (loc_error);                                                              // Checking error...
+
+    capacity[loc_slot] = loc_bytes;                                                                 // Setting staging buffer capacity...
+    owner[loc_slot]    = loc_queue->queue_id;                                                       // Setting staging buffer mapping queue...
+  }
+
+  // Reading OpenCL buffer into the pinned staging buffer (non-blocking):
+  loc_error = clEnqueueReadBuffer
+              (
+               loc_queue->queue_id,                                                                 // OpenCL queue ID.
+               loc_buffer,                                                                          // Data buffer.
+               CL_FALSE,                                                                            // Non-blocking read flag.
+               0,                                                                                   // Data buffer offset.
+               loc_bytes,                                                                           // Data buffer size.
+               pointer[loc_slot],                                                                   // Staging buffer.
+               0,                                                                                   // Number of events in the list.
+               NULL,                                                                                // Event list.
+               &event[loc_slot]                                                                     // Event.
+              );
+
+  baseline->check_error (loc_error);                                                                // Checking error...
+
+  clFlush (loc_queue->queue_id);                                                                    // Submitting read to the device...
+
+  snapshot[loc_slot].step   = loc_step;                                                             // Setting step number...
+  snapshot[loc_slot].layout = loc_layout_index;                                                     // Setting layout index...
+  snapshot[loc_slot].type   = loc_type;                                                             // Setting data type...
+  snapshot[loc_slot].size   = loc_size;                                                             // Setting data size...
+  snapshot[loc_slot].bytes  = loc_bytes;                                                            // Setting data size [bytes]...
+
+  busy[loc_slot] = true;                                                                            // Setting staging buffer as busy...
+  pending.push_back (loc_slot);                                                                     // Handing staging buffer to the writer thread...
+  head           = (head + 1)%slots;                                                                // Advancing ring...
+
+  loc_lock.unlock ();                                                                               // Unlocking staging buffers...
+  wakeup.notify_all ();                                                                             // Waking up writer thread...
+}
+
+void stream::write_loop ()
+{
+  size_t                       loc_slot;                                                            // Staging buffer index.
+  snapshot_index_structure     loc_index;                                                           // Index entry.
+  std::unique_lock<std::mutex> loc_lock (lock);                                                     // Staging buffer lock.
+
+  while(true)
+  {
+    // Waiting for a staging buffer to be handed over:
+    wakeup.wait (loc_lock, [this] {return stop || !pending.empty ();});
+
+    if(pending.empty ())                                                                            // Checking for pending snapshots...
+    {
+      break;                                                                                        // Stopping writer thread...
+    }
+
+    loc_slot = pending.front ();                                                                    // Getting staging buffer...
+    pending.pop_front ();                                                                           // Removing staging buffer from pending list...
+    loc_lock.unlock ();                                                                             // Unlocking staging buffers while writing...
+
+    clWaitForEvents (1, &event[loc_slot]);                                                          // Waiting for OpenCL read to complete...
+    clReleaseEvent (event[loc_slot]);                                                               // Releasing read event...
+
+    // Writing snapshot chunk:
+    data_file.write ((char*)&snapshot[loc_slot], sizeof(snapshot_structure));                       // Writing chunk header...
+    data_file.write ((char*)pointer[loc_slot], snapshot[loc_slot].bytes);                           // Writing chunk data...
+
+    // Writing index entry:
+    loc_index.step   = snapshot[loc_slot].step;                                                     // Setting step number...
+    loc_index.layout = snapshot[loc_slot].layout;                                                   // Setting layout index...
+    loc_index.type   = snapshot[loc_slot].type;                                                     // Setting data type...
+    loc_index.offset = offset;                                                                      // Setting chunk offset...
+    loc_index.bytes  = snapshot[loc_slot].bytes;                                                    // Setting data size [bytes]...
+    index_file.write ((char*)&loc_index, sizeof(snapshot_index_structure));                         // Writing index entry...
+
+    offset += sizeof(snapshot_structure) + snapshot[loc_slot].bytes;                                // Advancing data file write offset...
+
+    loc_lock.lock ();                                                                               // Locking staging buffers...
+    busy[loc_slot] = false;                                                                         // Freeing staging buffer...
+    wakeup.notify_all ();                                                                           // Waking up application thread...
+  }
+}
+
+void stream::write
+(
+ queue*   loc_queue,                                                                                // OpenCL queue.
+ int1*    loc_data,                                                                                 // Data object.
+ cl_uint  loc_layout_index,                                                                         // Layout index.
+ size_t   loc_step                                                                                  // Application step number [#].
+)
+{
+  if((loc_step%period) != 0)                                                                        // Checking snapshot period...
+  {
+    return;                                                                                         // Nothing to do...
+  }
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    baseline->error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Taking snapshot:
+  snap
+  (
+   loc_queue,                                                                                       // OpenCL queue.
+   loc_data->buffer,                                                                                // Data buffer.
+   loc_step,                                                                                        // Application step number [#].
+   loc_layout_index,                                                                                // Layout index.
+   NU_INT1,                                                                                         // Data type.
+   loc_data->size,                                                                                  // Data size [#].
+   sizeof(cl_long)*loc_data->size                                                                   // Data size [bytes].
+  );
+}
+
+void stream::write
+(
+ queue*   loc_queue,                                                                                // OpenCL queue.
+ int2*    loc_data,                                                                                 // Data object.
+ cl_uint  loc_layout_index,                                                                         // Layout index.
+ size_t   loc_step                                                                                  // Application step number [#].
+)
+{
+  if((loc_step%period) != 0)                                                                        // Checking snapshot period...
+  {
+    return;                                                                                         // Nothing to do...
+  }
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    baseline->error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Taking snapshot:
+  snap
+  (
+   loc_queue,                                                                                       // OpenCL queue.
+   loc_data->buffer,                                                                                // Data buffer.
+   loc_step,                                                                                        // Application step number [#].
+   loc_layout_index,                                                                                // Layout index.
+   NU_INT2,                                                                                         // Data type.
+   loc_data->size,                                                                                  // Data size [#].
+   sizeof(int2_structure)*loc_data->size                                                            // Data size [bytes].
+  );
+}
+
+void stream::write
+(
+ queue*   loc_queue,                                                                                // OpenCL queue.
+ int3*    loc_data,                                                                                 // Data object.
+ cl_uint  loc_layout_index,                                                                         // Layout index.
+ size_t   loc_step                                                                                  // Application step number [#].
+)
+{
+  if((loc_step%period) != 0)                                                                        // Checking snapshot period...
+  {
+    return;                                                                                         // Nothing to do...
+  }
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    baseline->error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Taking snapshot:
+  snap
+  (
+   loc_queue,                                                                                       // OpenCL queue.
+   loc_data->buffer,                                                                                // Data buffer.
+   loc_step,                                                                                        // Application step number [#].
+   loc_layout_index,                                                                                // Layout index.
+   NU_INT3,                                                                                         // Data type.
+   loc_data->size,                                                                                  // Data size [#].
+   sizeof(int3_structure)*loc_data->size                                                            // Data size [bytes].
+  );
+}
+
+void stream::write
+(
+ queue*   loc_queue,                                                                                // OpenCL queue.
+ int4*    loc_data,                                                                                 // Data object.
+ cl_uint  loc_layout_index,                                                                         // Layout index.
+ size_t   loc_step                                                                                  // Application step number [#].
+)
+{
+  if((loc_step%period) != 0)                                                                        // Checking snapshot period...
+  {
+    return;                                                                                         // Nothing to do...
+  }
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    baseline->error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Taking snapshot:
+  snap
+  (
+   loc_queue,                                                                                       // OpenCL queue.
+   loc_data->buffer,                                                                                // Data buffer.
+   loc_step,                                                                                        // Application step number [#].
+   loc_layout_index,                                                                                // Layout index.
+   NU_INT4,                                                                                         // Data type.
+   loc_data->size,                                                                                  // Data size [#].
+   sizeof(int4_structure)*loc_data->size                                                            // Data size [bytes].
+  );
+}
+
+void stream::write
+(
+ queue*   loc_queue,                                                                                // OpenCL queue.
+ float1*  loc_data,                                                                                 // Data object.
+ cl_uint  loc_layout_index,                                                                         // Layout index.
+ size_t   loc_step                                                                                  // Application step number [#].
+)
+{
+  if((loc_step%period) != 0)                                                                        // Checking snapshot period...
+  {
+    return;                                                                                         // Nothing to do...
+  }
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    baseline->error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Taking snapshot:
+  snap
+  (
+   loc_queue,                                                                                       // OpenCL queue.
+   loc_data->buffer,                                                                                // Data buffer.
+   loc_step,                                                                                        // Application step number [#].
+   loc_layout_index,                                                                                // Layout index.
+   NU_FLOAT1,                                                                                       // Data type.
+   loc_data->size,                                                                                  // Data size [#].
+   sizeof(cl_float)*loc_data->size                                                                  // Data size [bytes].
+  );
+}
+
+void stream::write
+(
+ queue*   loc_queue,                                                                                // OpenCL queue.
+ float1G* loc_data,                                                                                 // Data object.
+ GLuint   loc_layout_index,                                                                         // Layout index.
+ size_t   loc_step                                                                                  // Application step number [#].
+)
+{
+  if((loc_step%period) != 0)                                                                        // Checking snapshot period...
+  {
+    return;                                                                                         // Nothing to do...
+  }
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    baseline->error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Taking snapshot:
+  snap
+  (
+   loc_queue,                                                                                       // OpenCL queue.
+   loc_data->buffer,                                                                                // Data buffer.
+   loc_step,                                                                                        // Application step number [#].
+   loc_layout_index,                                                                                // Layout index.
+   NU_FLOAT1G,                                                                                      // Data type.
+   loc_data->size,                                                                                  // Data size [#].
+   sizeof(GLfloat)*loc_data->size                                                                   // Data size [bytes].
+  );
+}
+
+void stream::write
+(
+ queue*   loc_queue,                                                                                // OpenCL queue.
+ float2*  loc_data,                                                                                 // Data object.
+ cl_uint  loc_layout_index,                                                                         // Layout index.
+ size_t   loc_step                                                                                  // Application step number [#].
+)
+{
+  if((loc_step%period) != 0)                                                                        // Checking snapshot period...
+  {
+    return;                                                                                         // Nothing to do...
+  }
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    baseline->error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Taking snapshot:
+  snap
+  (
+   loc_queue,                                                                                       // OpenCL queue.
+   loc_data->buffer,                                                                                // Data buffer.
+   loc_step,                                                                                        // Application step number [#].
+   loc_layout_index,                                                                                // Layout index.
+   NU_FLOAT2,                                                                                       // Data type.
+   loc_data->size,                                                                                  // Data size [#].
+   sizeof(float2_structure)*loc_data->size                                                          // Data size [bytes].
+  );
+}
+
+void stream::write
+(
+ queue*   loc_queue,                                                                                // OpenCL queue.
+ float3*  loc_data,                                                                                 // Data object.
+ cl_uint  loc_layout_index,                                                                         // Layout index.
+ size_t   loc_step                                                                                  // Application step number [#].
+)
+{
+  if((loc_step%period) != 0)                                                                        // Checking snapshot period...
+  {
+    return;                                                                                         // Nothing to do...
+  }
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    baseline->error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Taking snapshot:
+  snap
+  (
+   loc_queue,                                                                                       // OpenCL queue.
+   loc_data->buffer,                                                                                // Data buffer.
+   loc_step,                                                                                        // Application step number [#].
+   loc_layout_index,                                                                                // Layout index.
+   NU_FLOAT3,                                                                                       // Data type.
+   loc_data->size,                                                                                  // Data size [#].
+   sizeof(float3_structure)*loc_data->size                                                          // Data size [bytes].
+  );
+}
+
+void stream::write
+(
+ queue*   loc_queue,                                                                                // OpenCL queue.
+ float4*  loc_data,                                                                                 // Data object.
+ cl_uint  loc_layout_index,                                                                         // Layout index.
+ size_t   loc_step                                                                                  // Application step number [#].
+)
+{
+  if((loc_step%period) != 0)                                                                        // Checking snapshot period...
+  {
+    return;                                                                                         // Nothing to do...
+  }
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    baseline->error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Taking snapshot:
+  snap
+  (
+   loc_queue,                                                                                       // OpenCL queue.
+   loc_data->buffer,                                                                                // Data buffer.
+   loc_step,                                                                                        // Application step number [#].
+   loc_layout_index,                                                                                // Layout index.
+   NU_FLOAT4,                                                                                       // Data type.
+   loc_data->size,                                                                                  // Data size [#].
+   sizeof(float4_structure)*loc_data->size                                                          // Data size [bytes].
+  );
+}
+
+void stream::write
+(
+ queue*   loc_queue,                                                                                // OpenCL queue.
+ float4G* loc_data,                                                                                 // Data object.
+ GLuint   loc_layout_index,                                                                         // Layout index.
+ size_t   loc_step                                                                                  // Application step number [#].
+)
+{
+  if((loc_step%period) != 0)                                                                        // Checking snapshot period...
+  {
+    return;                                                                                         // Nothing to do...
+  }
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    baseline->error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Taking snapshot:
+  snap
+  (
+   loc_queue,                                                                                       // OpenCL queue.
+   loc_data->buffer,                                                                                // Data buffer.
+   loc_step,                                                                                        // Application step number [#].
+   loc_layout_index,                                                                                // Layout index.
+   NU_FLOAT4G,                                                                                      // Data type.
+   loc_data->size,                                                                                  // Data size [#].
+   sizeof(float4G_structure)*loc_data->size                                                         // Data size [bytes].
+  );
+}
+
+void stream::flush ()
+{
+  std::unique_lock<std::mutex> loc_lock (lock);                                                     // Staging buffer lock.
+
+  // Waiting for all staging buffers to be written:
+  wakeup.wait (loc_lock, [this] {return pending.empty () && (std::find (busy, busy + slots, true) == busy + slots);});
+
+  data_file.flush ();                                                                               // Flushing data file...
+  index_file.flush ();                                                                              // Flushing index file...
+}
+
+stream::~stream()
+{
+  size_t i;                                                                                         // Index.
+
+  if(baseline == NULL)                                                                              // Checking initialization...
+  {
+    return;
+  }
+
+  baseline->action ("releasing snapshot stream...");                                                // Printing message...
+
+  // Stopping writer thread (after all pending snapshots are written):
+  {
+    std::lock_guard<std::mutex> loc_lock (lock);                                                    // Staging buffer lock.
+    stop = true;                                                                                    // Setting writer thread "stop" flag...
+  }
+
+  wakeup.notify_all ();                                                                             // Waking up writer thread...
+  if(writer.joinable ())                                                                            // Checking for writer thread...
+  {
+    writer.join ();                                                                                 // Waiting for writer thread to end...
+  }
+
+  for(i = 0; i < slots; i++)                                                                        // Scanning staging buffers...
+  {
+    if(staging[i] != NULL)                                                                          // Checking staging buffer...
+    {
+      clEnqueueUnmapMemObject (owner[i], staging[i], pointer[i], 0, NULL, NULL);                    // Unmapping staging buffer...
+      clFinish (owner[i]);                                                                          // Waiting for OpenCL to finish...
+      clReleaseMemObject (staging[i]);                                                              // Releasing staging buffer...
+    }
+  }
+
+  data_file.close ();                                                                               // Closing data file...
+  index_file.close ();                                                                              // Closing index file...
+
+  delete[] staging;                                                                                 // Deleting staging buffer array...
+  delete[] pointer;                                                                                 // Deleting mapped staging buffer array...
+  delete[] capacity;                                                                                // Deleting staging buffer capacity array...
+  delete[] owner;                                                                                   // Deleting staging buffer mapping queue array...
+  delete[] event;                                                                                   // Deleting staging buffer read event array...
+  delete[] snapshot;                                                                                // Deleting staging buffer snapshot header array...
+  delete[] busy;                                                                                    // Deleting staging buffer "busy" flag array...
+
+  baseline->done ();                                                                                // Printing message...
+}
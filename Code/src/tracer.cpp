@@ -0,0 +1,284 @@
+/// @file     tracer.cpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Definition of the "tracer" class.
+
+#include "tracer.hpp"
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////// "tracer" class ///////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+tracer::tracer()
+{
+  baseline   = NULL;                                                                                // Initializing Neutrino baseline...
+  origin     = 0;                                                                                   // Initializing trace origin...
+  offset     = 0;                                                                                   // Initializing clock offset...
+  calibrated = false;                                                                               // Initializing "calibrated" flag...
+}
+
+void tracer::init
+(
+ neutrino*   loc_baseline,                                                                          // Neutrino baseline.
+ std::string loc_file_directory,                                                                    // File directory.
+ std::string loc_file_name                                                                          // File name.
+)
+{
+  baseline = loc_baseline;                                                                          // Getting Neutrino baseline...
+  baseline->action ("initializing trace recorder...");                                              // Printing message...
+
+  #ifdef __linux__
+    file_name = loc_file_directory +                                                                // Data directory.
+                std::string ("/") +                                                                 // Slash.
+                loc_file_name;                                                                      // Data file name.
+  #endif
+
+  #ifdef __APPLE__
+    file_name = loc_file_directory +                                                                // Data directory.
+                std::string ("/") +                                                                 // Slash.
+                loc_file_name;                                                                      // Data file name.
+  #endif
+
+  #ifdef WIN32
+    file_name = loc_file_directory +                                                                // Data directory.
+                std::string ("\\") +                                                                // Backslash.
+                loc_file_name;                                                                      // Data file name.
+  #endif
+
+  origin            = now ();                                                                       // Setting trace origin...
+  baseline->tracing = this;                                                                         // Registering tracer in Neutrino baseline...
+
+  baseline->done ();                                                                                // Printing message...
+}
+
+cl_ulong tracer::now ()
+{
+  // Getting host monotonic clock:
+  return (cl_ulong)std::chrono::duration_cast<std::chrono::nanoseconds>
+         (
+          std::chrono::steady_clock::now ().time_since_epoch ()
+         ).count ();
+}
+
+void tracer::host
+(
+ const char* loc_name,                                                                              // Span name.
+ cl_ulong    loc_begin                                                                              // Beginning time, host clock [ns].
+)
+{
+  span_structure loc_span;                                                                          // Timeline span.
+
+  loc_span.name   = loc_name;                                                                       // Setting span name...
+  loc_span.track  = NU_TRACE_HOST;                                                                  // Setting span track...
+  loc_span.queued = loc_begin;                                                                      // Setting queueing time...
+  loc_span.begin  = loc_begin;                                                                      // Setting beginning time...
+  loc_span.end    = now ();                                                                         // Setting end time...
+
+  span.push_back (loc_span);                                                                        // Storing span...
+}
+
+void tracer::calibrate
+(
+ cl_command_queue loc_queue                                                                         // OpenCL queue ID.
+)
+{
+  cl_int   loc_error;                                                                               // Error code.
+  cl_event loc_marker;                                                                              // Marker event.
+  cl_ulong loc_host_begin;                                                                          // Host time before the marker [ns].
+  cl_ulong loc_host_end;                                                                            // Host time after the marker [ns].
+  cl_ulong loc_device;                                                                              // Device time of the marker [ns].
+
+  clFinish (loc_queue);                                                                             // Waiting for OpenCL to finish...
+
+  loc_host_begin = now ();                                                                          // Getting host time before the marker...
+
+  // Enqueueing marker:
+  loc_error      = clEnqueueMarkerWithWaitList
+                   (
+                    loc_queue,                                                                      // OpenCL queue ID.
+                    0,                                                                              // Number of events in the list.
+                    NULL,                                                                           // Event list.
+                    &loc_marker                                                                     // Event.
+                   );
+
+  baseline->check_error (loc_error);                                                                // Checking error...
+
+  clWaitForEvents (1, &loc_marker);                                                                 // Waiting for the marker...
+
+  loc_host_end   = now ();                                                                          // Getting host time after the marker...
+
+  // Getting device time of the marker:
+  loc_error      = clGetEventProfilingInfo
+                   (
+                    loc_marker,                                                                     // OpenCL event.
+                    CL_PROFILING_COMMAND_END,                                                       // Parameter name.
+                    sizeof(cl_ulong),                                                               // Parameter size.
+                    &loc_device,                                                                    // Parameter value.
+                    NULL                                                                            // Returned parameter size.
+                   );
+
+  baseline->check_error (loc_error);                                                                // Checking error...
+
+  clReleaseEvent (loc_marker);                                                                      // Releasing marker event...
+
+  offset         = (cl_long)(loc_host_begin + (loc_host_end - loc_host_begin)/2) - (cl_long)loc_device; // Computing clock offset...
+  calibrated     = true;                                                                            // Setting "calibrated" flag...
+}
+
+void tracer::resolve
+(
+ bool loc_wait                                                                                      // Wait for completion flag.
+)
+{
+  size_t         i;                                                                                 // Index.
+  size_t         j;                                                                                 // Index.
+  cl_int         loc_status;                                                                        // Event execution status.
+  cl_ulong       loc_queued;                                                                        // QUEUED timestamp, device clock [ns].
+  cl_ulong       loc_start;                                                                         // START timestamp, device clock [ns].
+  cl_ulong       loc_end;                                                                           // END timestamp, device clock [ns].
+  span_structure loc_span;                                                                          // Timeline span.
+
+  if(loc_wait && !pending_event.empty ())                                                           // Checking for events to be waited for...
+  {
+    clWaitForEvents ((cl_uint)pending_event.size (), pending_event.data ());                        // Waiting for all pending events...
+  }
+
+  j = 0;                                                                                            // Resetting index of events still pending...
+
+  for(i = 0; i < pending_event.size (); i++)                                                        // Scanning pending events...
+  {
+    // Getting event execution status:
+    clGetEventInfo
+    (
+     pending_event[i],                                                                              // OpenCL event.
+     CL_EVENT_COMMAND_EXECUTION_STATUS,                                                             // Parameter name.
+     sizeof(cl_int),                                                                                // Parameter size.
+     &loc_status,                                                                                   // Parameter value.
+     NULL                                                                                           // Returned parameter size.
+    );
+
+    if(loc_status == CL_COMPLETE)                                                                   // Checking for completed event...
+    {
+      // Getting event timestamps:
+      clGetEventProfilingInfo (pending_event[i], CL_PROFILING_COMMAND_QUEUED, sizeof(cl_ulong), &loc_queued, NULL);
+      clGetEventProfilingInfo (pending_event[i], CL_PROFILING_COMMAND_START, sizeof(cl_ulong), &loc_start, NULL);
+      clGetEventProfilingInfo (pending_event[i], CL_PROFILING_COMMAND_END, sizeof(cl_ulong), &loc_end, NULL);
+
+      loc_span.name   = pending_name[i];                                                            // Setting span name...
+      loc_span.track  = NU_TRACE_DEVICE;                                                            // Setting span track...
+      loc_span.queued = (cl_ulong)((cl_long)loc_queued + offset);                                   // Converting queueing time to host clock...
+      loc_span.begin  = (cl_ulong)((cl_long)loc_start + offset);                                    // Converting beginning time to host clock...
+      loc_span.end    = (cl_ulong)((cl_long)loc_end + offset);                                      // Converting end time to host clock...
+
+      span.push_back (loc_span);                                                                    // Storing span...
+      clReleaseEvent (pending_event[i]);                                                            // Releasing event...
+    }
+
+    else
+    {
+      pending_event[j] = pending_event[i];                                                          // Keeping event...
+      pending_name[j]  = pending_name[i];                                                           // Keeping name...
+      j++;                                                                                          // Advancing index of events still pending...
+    }
+  }
+
+  pending_event.resize (j);                                                                         // Dropping resolved events...
+  pending_name.resize (j);                                                                          // Dropping resolved names...
+}
+
+void tracer::record
+(
+ cl_event    loc_event,                                                                             // OpenCL event.
+ std::string loc_name                                                                               // Span name.
+)
+{
+  cl_command_queue loc_queue;                                                                       // OpenCL queue ID.
+
+  if(!calibrated)                                                                                   // Checking clock offset...
+  {
+    // Getting the queue of the event:
+    clGetEventInfo
+    (
+     loc_event,                                                                                     // OpenCL event.
+     CL_EVENT_COMMAND_QUEUE,                                                                        // Parameter name.
+     sizeof(cl_command_queue),                                                                      // Parameter size.
+     &loc_queue,                                                                                    // Parameter value.
+     NULL                                                                                           // Returned parameter size.
+    );
+
+    calibrate (loc_queue);                                                                          // Measuring clock offset...
+  }
+
+  pending_event.push_back (loc_event);                                                              // Storing event...
+  pending_name.push_back (loc_name);                                                                // Storing name...
+
+  if(pending_event.size () >= NU_TRACER_PENDING)                                                    // Checking number of pending events...
+  {
+    resolve (false);                                                                                // Resolving completed events (not blocking)...
+  }
+}
+
+void tracer::save ()
+{
+  size_t        i;                                                                                  // Index.
+  size_t        j;                                                                                  // Index.
+  std::string   loc_name;                                                                           // Escaped span name.
+  char          loc_line[NU_MAX_TEXT_SIZE*2];                                                       // Text line.
+  std::ofstream loc_file;                                                                           // File.
+
+  baseline->action ("saving trace...");                                                             // Printing message...
+
+  resolve (true);                                                                                   // Resolving all pending events...
+
+  loc_file.open (file_name);                                                                        // Opening file...
+
+  if(!loc_file)                                                                                     // Checking file...
+  {
+    baseline->error ("Cannot open trace file!");                                                    // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Writing track names:
+  loc_file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[" << std::endl;
+  loc_file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << NU_TRACE_HOST
+           << ",\"args\":{\"name\":\"host\"}}," << std::endl;
+  loc_file << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << NU_TRACE_DEVICE
+           << ",\"args\":{\"name\":\"OpenCL device\"}}";
+
+  for(i = 0; i < span.size (); i++)                                                                 // Scanning spans...
+  {
+    loc_name.clear ();                                                                              // Resetting escaped span name...
+
+    for(j = 0; j < span[i].name.size (); j++)                                                       // Escaping span name...
+    {
+      if((span[i].name[j] == '"') || (span[i].name[j] == '\\'))
+      {
+        loc_name += '\\';                                                                           // Adding escape character...
+      }
+
+      loc_name += span[i].name[j];                                                                  // Adding character...
+    }
+
+    snprintf (loc_line, sizeof(loc_line), ",\"ph\":\"X\",\"pid\":0,\"tid\":%zu,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"queued_us\":%.3f}}",
+              span[i].track,
+              ((double)span[i].begin - (double)origin)/1000.0,
+              ((double)span[i].end - (double)span[i].begin)/1000.0,
+              ((double)span[i].begin - (double)span[i].queued)/1000.0);
+    loc_file << "," << std::endl << "{\"name\":\"" << loc_name << "\",\"cat\":\""
+             << ((span[i].track == NU_TRACE_HOST) ? "host" : "device") << "\"" << loc_line;  // Writing span...
+  }
+
+  loc_file << std::endl << "]}" << std::endl;                                                       // Closing trace...
+  loc_file.close ();                                                                                // Closing file...
+
+  baseline->done ();                                                                                // Printing message...
+}
+
+tracer::~tracer()
+{
+  if(baseline != NULL)                                                                              // Checking initialization...
+  {
+    save ();                                                                                        // Saving trace...
+
+    baseline->tracing = NULL;                                                                       // Unregistering tracer from Neutrino baseline...
+  }
+}